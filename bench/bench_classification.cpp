@@ -0,0 +1,128 @@
+// vim: set sw=4 ts=4 sts=4 expandtab :
+
+#include "bench_common.hpp"
+
+#include "../tests/testing_structures.h"
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+
+static
+auto makeTestingSteps()
+{
+    return std::array<LLKA_Structure, 8>{
+        LLKA_makeStructure(REAL_1BNA_A_1_2_ATOMS, REAL_1BNA_A_1_2_ATOMS_LEN),
+        LLKA_makeStructure(REAL_1BNA_A_2_3_ATOMS, REAL_1BNA_A_2_3_ATOMS_LEN),
+        LLKA_makeStructure(REAL_1BNA_A_3_4_ATOMS, REAL_1BNA_A_3_4_ATOMS_LEN),
+        LLKA_makeStructure(REAL_1BNA_A_4_5_ATOMS, REAL_1BNA_A_4_5_ATOMS_LEN),
+        LLKA_makeStructure(REAL_1BNA_A_6_7_ATOMS, REAL_1BNA_A_6_7_ATOMS_LEN),
+        LLKA_makeStructure(REAL_1BNA_B_16_17_ATOMS, REAL_1BNA_B_16_17_ATOMS_LEN),
+        LLKA_makeStructure(REAL_3VOK_U_1_2_ATOMS, REAL_3VOK_U_1_2_ATOMS_LEN),
+        LLKA_makeStructure(REAL_1DK1_B_5_6_ATOMS, REAL_1DK1_B_5_6_ATOMS_LEN)
+    };
+}
+
+static
+auto benchClassifySteps(benchmark::State &state, const LLKA_Structures &steps)
+{
+    LLKABench::ClassificationResources resources{};
+    LLKA_ClassificationContext *ctx = nullptr;
+    if (resources.initializeContext(&ctx) != LLKA_OK)
+        LLKABench::die("cannot initialize classification context");
+
+    for (auto _ : state) {
+        LLKA_ClassifiedSteps classified{};
+        auto tRet = LLKA_classifyStepsMultiple(&steps, ctx, &classified);
+        if (tRet != LLKA_OK) {
+            state.SkipWithError("Cannot classify steps");
+            break;
+        }
+
+        LLKA_destroyClassifiedSteps(&classified);
+    }
+
+    state.SetItemsProcessed(int64_t(state.iterations()) * int64_t(steps.nStrus));
+
+    LLKA_destroyClassificationContext(ctx);
+}
+
+static
+auto BM_ClassifyStepsMultiple_TestingStructures(benchmark::State &state)
+{
+    auto strus = makeTestingSteps();
+    LLKA_Structures steps{ .strus = strus.data(), .nStrus = strus.size() };
+
+    benchClassifySteps(state, steps);
+
+    for (auto &stru : strus)
+        LLKA_destroyStructure(&stru);
+}
+BENCHMARK(BM_ClassifyStepsMultiple_TestingStructures)->Unit(benchmark::kMicrosecond);
+
+static
+auto BM_ClassifyStepsMultiple_1BNA(benchmark::State &state)
+{
+    auto imported = LLKABench::importCif(LLKABench::readAsset("test_cifs/1BNA.cif"));
+
+    LLKA_Structures steps{};
+    if (LLKA_splitStructureToDinucleotideSteps(&imported.structure, &steps) != LLKA_OK)
+        LLKABench::die("cannot split 1BNA to steps");
+
+    benchClassifySteps(state, steps);
+
+    LLKA_destroyStructures(&steps);
+    LLKA_destroyImportedStructure(&imported);
+}
+BENCHMARK(BM_ClassifyStepsMultiple_1BNA)->Unit(benchmark::kMicrosecond);
+
+static
+auto BM_InitializeClassificationContext(benchmark::State &state)
+{
+    LLKABench::ClassificationResources resources{};
+
+    for (auto _ : state) {
+        LLKA_ClassificationContext *ctx = nullptr;
+        if (resources.initializeContext(&ctx) != LLKA_OK) {
+            state.SkipWithError("Cannot initialize classification context");
+            break;
+        }
+
+        LLKA_destroyClassificationContext(ctx);
+    }
+}
+BENCHMARK(BM_InitializeClassificationContext)->Unit(benchmark::kMillisecond);
+
+static
+auto BM_LoadAndInitializeClassificationContext(benchmark::State &state)
+{
+    for (auto _ : state) {
+        LLKABench::ClassificationResources resources{};
+
+        LLKA_ClassificationContext *ctx = nullptr;
+        if (resources.initializeContext(&ctx) != LLKA_OK) {
+            state.SkipWithError("Cannot initialize classification context");
+            break;
+        }
+
+        LLKA_destroyClassificationContext(ctx);
+    }
+}
+BENCHMARK(BM_LoadAndInitializeClassificationContext)->Unit(benchmark::kMillisecond);
+
+static
+auto BM_InitializeClassificationContextFromDirectory(benchmark::State &state)
+{
+    const auto limits = LLKABench::classificationLimits();
+
+    for (auto _ : state) {
+        LLKA_ClassificationContext *ctx = nullptr;
+        if (LLKA_initializeClassificationContextFromDirectory(LLKA_BENCH_ASSETS_DIR, &limits, LLKABench::MAX_CLOSE_ENOUGH_RMSD, &ctx) != LLKA_OK) {
+            state.SkipWithError("Cannot initialize classification context");
+            break;
+        }
+
+        LLKA_destroyClassificationContext(ctx);
+    }
+}
+BENCHMARK(BM_InitializeClassificationContextFromDirectory)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,198 @@
+// vim: set sw=4 ts=4 sts=4 expandtab :
+
+#ifndef _LLKA_BENCH_COMMON_HPP
+#define _LLKA_BENCH_COMMON_HPP
+
+#include <llka_classification.h>
+#include <llka_minicif.h>
+#include <llka_resource_loaders.h>
+
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace LLKABench {
+
+[[noreturn]] inline
+auto die(const std::string &msg) -> void
+{
+    std::cerr << "Benchmark setup failed: " << msg << std::endl;
+    std::exit(EXIT_FAILURE);
+}
+
+inline
+auto readAsset(const std::string &name) -> std::string
+{
+    const std::string path = std::string{LLKA_BENCH_ASSETS_DIR} + "/" + name;
+
+    std::ifstream ifs{path, std::ios::binary};
+    if (!ifs.is_open())
+        die("cannot open " + path);
+
+    return std::string{std::istreambuf_iterator<char>{ifs}, std::istreambuf_iterator<char>{}};
+}
+
+/*
+ * Creates Cif text with at least the given number of atoms by repeating
+ * the atoms of 1BNA as additional models.
+ */
+inline
+auto makeSyntheticCif(size_t minAtoms) -> std::string
+{
+    const auto original = readAsset("test_cifs/1BNA.cif");
+
+    std::istringstream iss{original};
+    std::string line;
+    std::vector<std::vector<std::string>> atoms;
+    while (std::getline(iss, line)) {
+        if (!line.starts_with("ATOM "))
+            continue;
+
+        std::istringstream lss{line};
+        std::vector<std::string> columns{std::istream_iterator<std::string>{lss}, std::istream_iterator<std::string>{}};
+        atoms.push_back(std::move(columns));
+    }
+    if (atoms.empty())
+        die("1BNA contains no atoms");
+
+    std::ostringstream oss;
+    oss << "data_SYNTH\n"
+        << "#\n"
+        << "_entry.id SYNTH\n"
+        << "#\n"
+        << "loop_\n"
+        << "_atom_site.group_PDB\n"
+        << "_atom_site.id\n"
+        << "_atom_site.type_symbol\n"
+        << "_atom_site.label_atom_id\n"
+        << "_atom_site.label_alt_id\n"
+        << "_atom_site.label_comp_id\n"
+        << "_atom_site.label_asym_id\n"
+        << "_atom_site.label_entity_id\n"
+        << "_atom_site.label_seq_id\n"
+        << "_atom_site.pdbx_PDB_ins_code\n"
+        << "_atom_site.Cartn_x\n"
+        << "_atom_site.Cartn_y\n"
+        << "_atom_site.Cartn_z\n"
+        << "_atom_site.occupancy\n"
+        << "_atom_site.B_iso_or_equiv\n"
+        << "_atom_site.pdbx_formal_charge\n"
+        << "_atom_site.auth_seq_id\n"
+        << "_atom_site.auth_comp_id\n"
+        << "_atom_site.auth_asym_id\n"
+        << "_atom_site.auth_atom_id\n"
+        << "_atom_site.pdbx_PDB_model_num\n";
+
+    const size_t nModels = (minAtoms + atoms.size() - 1) / atoms.size();
+    size_t id = 1;
+    for (size_t model = 1; model <= nModels; model++) {
+        for (auto columns : atoms) {
+            columns[1] = std::to_string(id++);
+            columns.back() = std::to_string(model);
+
+            for (size_t idx = 0; idx < columns.size(); idx++)
+                oss << (idx > 0 ? " " : "") << columns[idx];
+            oss << "\n";
+        }
+    }
+    oss << "#\n";
+
+    return oss.str();
+}
+
+inline
+auto loadResource(const std::string &name, LLKA_ResourceType type) -> LLKA_Resource
+{
+    const auto text = readAsset(name);
+
+    LLKA_Resource res{};
+    res.type = type;
+    if (LLKA_loadResourceText(text.c_str(), &res) != LLKA_OK)
+        die("cannot load " + name);
+
+    return res;
+}
+
+inline constexpr double MAX_CLOSE_ENOUGH_RMSD = 0.5;
+
+inline
+auto classificationLimits() -> LLKA_ClassificationLimits
+{
+    LLKA_ClassificationLimits limits{};
+    limits.averageNeighborsTorsionCutoff = 28.0 * M_PI / 180.0;
+    limits.nearestNeighborTorsionsCutoff = 28.0 * M_PI / 180.0;
+    limits.totalDistanceCutoff = 60.0 * M_PI / 180.0;
+    limits.pseudorotationCutoff = 72.0 * M_PI / 180.0;
+    limits.minimumClusterVotes = 0.001111;
+    limits.minimumNearestNeighbors = 7;
+    limits.numberOfUsedNearestNeighbors = 11;
+
+    return limits;
+}
+
+class ClassificationResources {
+public:
+    ClassificationResources() :
+        goldenSteps{loadResource("golden_steps.csv", LLKA_RES_GOLDEN_STEPS)},
+        clusters{loadResource("clusters.csv", LLKA_RES_CLUSTERS)},
+        confals{loadResource("confals.csv", LLKA_RES_CONFALS)},
+        nuAngles{loadResource("nu_angles.csv", LLKA_RES_AVERAGE_NU_ANGLES)},
+        confalPercentiles{loadResource("confal_percentiles.csv", LLKA_RES_CONFAL_PERCENTILES)}
+    {
+    }
+
+    ClassificationResources(const ClassificationResources &) = delete;
+
+    ~ClassificationResources()
+    {
+        LLKA_destroyResource(&goldenSteps);
+        LLKA_destroyResource(&clusters);
+        LLKA_destroyResource(&confals);
+        LLKA_destroyResource(&nuAngles);
+        LLKA_destroyResource(&confalPercentiles);
+    }
+
+    auto operator=(const ClassificationResources &) -> ClassificationResources & = delete;
+
+    auto initializeContext(LLKA_ClassificationContext **ctx) const -> LLKA_RetCode
+    {
+        const auto limits = classificationLimits();
+
+        return LLKA_initializeClassificationContext(
+            clusters.data.clusters, clusters.count,
+            goldenSteps.data.goldenSteps, goldenSteps.count,
+            confals.data.confals, confals.count,
+            nuAngles.data.clusterNuAngles, nuAngles.count,
+            confalPercentiles.data.confalPercentiles, confalPercentiles.count,
+            &limits,
+            MAX_CLOSE_ENOUGH_RMSD,
+            ctx
+        );
+    }
+
+    LLKA_Resource goldenSteps;
+    LLKA_Resource clusters;
+    LLKA_Resource confals;
+    LLKA_Resource nuAngles;
+    LLKA_Resource confalPercentiles;
+};
+
+inline
+auto importCif(const std::string &text) -> LLKA_ImportedStructure
+{
+    LLKA_ImportedStructure imported{};
+    char *error = nullptr;
+    if (LLKA_cifTextToStructure(text.c_str(), &imported, &error, 0) != LLKA_OK)
+        die(std::string{"cannot import Cif: "} + (error != nullptr ? error : "unknown error"));
+
+    return imported;
+}
+
+} // namespace LLKABench
+
+#endif // _LLKA_BENCH_COMMON_HPP
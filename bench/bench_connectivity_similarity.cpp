@@ -0,0 +1,55 @@
+// vim: set sw=4 ts=4 sts=4 expandtab :
+
+#include "bench_common.hpp"
+
+#include "../tests/testing_structures.h"
+
+#include <llka_connectivity_similarity.h>
+
+#include <benchmark/benchmark.h>
+
+static
+auto BM_MeasureStepConnectivityNtCs(benchmark::State &state)
+{
+    auto first = LLKA_makeStructure(REAL_1BNA_A_2_3_ATOMS, REAL_1BNA_A_2_3_ATOMS_LEN);
+    auto second = LLKA_makeStructure(REAL_1BNA_A_3_4_ATOMS, REAL_1BNA_A_3_4_ATOMS_LEN);
+
+    for (auto _ : state) {
+        LLKA_Connectivity conn;
+        auto tRet = LLKA_measureStepConnectivityNtCs(&first, LLKA_BA01, &second, LLKA_AB01, &conn);
+        if (tRet != LLKA_OK) {
+            state.SkipWithError("Cannot measure connectivity");
+            break;
+        }
+
+        benchmark::DoNotOptimize(conn);
+    }
+
+    state.SetItemsProcessed(int64_t(state.iterations()));
+
+    LLKA_destroyStructure(&first);
+    LLKA_destroyStructure(&second);
+}
+BENCHMARK(BM_MeasureStepConnectivityNtCs);
+
+static
+auto BM_MeasureStepSimilarityNtC(benchmark::State &state)
+{
+    auto step = LLKA_makeStructure(REAL_1BNA_A_2_3_ATOMS, REAL_1BNA_A_2_3_ATOMS_LEN);
+
+    for (auto _ : state) {
+        LLKA_Similarity similarity;
+        auto tRet = LLKA_measureStepSimilarityNtC(&step, LLKA_BB00, &similarity);
+        if (tRet != LLKA_OK) {
+            state.SkipWithError("Cannot measure similarity");
+            break;
+        }
+
+        benchmark::DoNotOptimize(similarity);
+    }
+
+    state.SetItemsProcessed(int64_t(state.iterations()));
+
+    LLKA_destroyStructure(&step);
+}
+BENCHMARK(BM_MeasureStepSimilarityNtC);
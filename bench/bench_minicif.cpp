@@ -0,0 +1,61 @@
+// vim: set sw=4 ts=4 sts=4 expandtab :
+
+#include "bench_common.hpp"
+
+#include <benchmark/benchmark.h>
+
+static
+auto benchCifToStructure(benchmark::State &state, const std::string &text)
+{
+    for (auto _ : state) {
+        LLKA_ImportedStructure imported{};
+        char *error = nullptr;
+        auto tRet = LLKA_cifTextToStructure(text.c_str(), &imported, &error, 0);
+        if (tRet != LLKA_OK) {
+            state.SkipWithError("Cannot parse Cif");
+            break;
+        }
+
+        state.counters["atoms"] = double(imported.structure.nAtoms);
+        LLKA_destroyImportedStructure(&imported);
+    }
+
+    state.SetBytesProcessed(int64_t(state.iterations()) * int64_t(text.size()));
+}
+
+static
+auto BM_CifToStructure_1BNA(benchmark::State &state)
+{
+    const auto text = LLKABench::readAsset("test_cifs/1BNA.cif");
+    benchCifToStructure(state, text);
+}
+BENCHMARK(BM_CifToStructure_1BNA)->Unit(benchmark::kMicrosecond);
+
+static
+auto BM_CifToStructure_Synthetic100k(benchmark::State &state)
+{
+    const auto text = LLKABench::makeSyntheticCif(100000);
+    benchCifToStructure(state, text);
+}
+BENCHMARK(BM_CifToStructure_Synthetic100k)->Unit(benchmark::kMillisecond);
+
+static
+auto BM_CifToData_1BNA(benchmark::State &state)
+{
+    const auto text = LLKABench::readAsset("test_cifs/1BNA.cif");
+
+    for (auto _ : state) {
+        LLKA_CifData *data = nullptr;
+        char *error = nullptr;
+        auto tRet = LLKA_cifTextToData(text.c_str(), &data, &error);
+        if (tRet != LLKA_OK) {
+            state.SkipWithError("Cannot parse Cif");
+            break;
+        }
+
+        LLKA_destroyCifData(data);
+    }
+
+    state.SetBytesProcessed(int64_t(state.iterations()) * int64_t(text.size()));
+}
+BENCHMARK(BM_CifToData_1BNA)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,32 @@
+// vim: set sw=4 ts=4 sts=4 expandtab :
+
+#include "bench_common.hpp"
+
+#include <llka_structure.h>
+
+#include <benchmark/benchmark.h>
+
+static
+auto BM_SplitToDinucleotideSteps_1BNA(benchmark::State &state)
+{
+    auto imported = LLKABench::importCif(LLKABench::readAsset("test_cifs/1BNA.cif"));
+
+    size_t nSteps = 0;
+    for (auto _ : state) {
+        LLKA_Structures steps{};
+        auto tRet = LLKA_splitStructureToDinucleotideSteps(&imported.structure, &steps);
+        if (tRet != LLKA_OK) {
+            state.SkipWithError("Cannot split structure to steps");
+            break;
+        }
+
+        nSteps = steps.nStrus;
+        LLKA_destroyStructures(&steps);
+    }
+
+    state.SetItemsProcessed(int64_t(state.iterations()) * int64_t(nSteps));
+    state.counters["steps"] = double(nSteps);
+
+    LLKA_destroyImportedStructure(&imported);
+}
+BENCHMARK(BM_SplitToDinucleotideSteps_1BNA)->Unit(benchmark::kMicrosecond);
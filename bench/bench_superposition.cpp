@@ -0,0 +1,90 @@
+// vim: set sw=4 ts=4 sts=4 expandtab :
+
+#include "bench_common.hpp"
+
+#include "../tests/testing_structures.h"
+
+#include <llka_superposition.h>
+
+#include <benchmark/benchmark.h>
+
+static
+auto BM_SuperpositionMatrixStructures(benchmark::State &state)
+{
+    auto what = LLKA_makeStructure(REAL_1BNA_A_2_3_ATOMS, REAL_1BNA_A_2_3_ATOMS_LEN);
+    auto onto = LLKA_makeStructure(REAL_1BNA_A_3_4_ATOMS, REAL_1BNA_A_3_4_ATOMS_LEN);
+
+    for (auto _ : state) {
+        LLKA_Matrix matrix{};
+        auto tRet = LLKA_superpositionMatrixStructures(&what, &onto, &matrix);
+        if (tRet != LLKA_OK) {
+            state.SkipWithError("Cannot superpose structures");
+            break;
+        }
+
+        benchmark::DoNotOptimize(matrix.data);
+        LLKA_destroyMatrix(&matrix);
+    }
+
+    state.SetItemsProcessed(int64_t(state.iterations()));
+
+    LLKA_destroyStructure(&what);
+    LLKA_destroyStructure(&onto);
+}
+BENCHMARK(BM_SuperpositionMatrixStructures);
+
+static
+auto BM_SuperposeStructures(benchmark::State &state)
+{
+    auto original = LLKA_makeStructure(REAL_1BNA_A_2_3_ATOMS, REAL_1BNA_A_2_3_ATOMS_LEN);
+    auto onto = LLKA_makeStructure(REAL_1BNA_A_3_4_ATOMS, REAL_1BNA_A_3_4_ATOMS_LEN);
+    auto what = LLKA_makeStructure(REAL_1BNA_A_2_3_ATOMS, REAL_1BNA_A_2_3_ATOMS_LEN);
+
+    for (auto _ : state) {
+        // Start from the same coordinates in every iteration
+        state.PauseTiming();
+        for (size_t idx = 0; idx < what.nAtoms; idx++)
+            what.atoms[idx].coords = original.atoms[idx].coords;
+        state.ResumeTiming();
+
+        double rmsd;
+        auto tRet = LLKA_superposeStructures(&what, &onto, &rmsd);
+        if (tRet != LLKA_OK) {
+            state.SkipWithError("Cannot superpose structures");
+            break;
+        }
+
+        benchmark::DoNotOptimize(rmsd);
+    }
+
+    state.SetItemsProcessed(int64_t(state.iterations()));
+
+    LLKA_destroyStructure(&what);
+    LLKA_destroyStructure(&onto);
+    LLKA_destroyStructure(&original);
+}
+BENCHMARK(BM_SuperposeStructures);
+
+static
+auto BM_RmsdStructures(benchmark::State &state)
+{
+    auto a = LLKA_makeStructure(REAL_1BNA_A_2_3_ATOMS, REAL_1BNA_A_2_3_ATOMS_LEN);
+    auto b = LLKA_makeStructure(REAL_1BNA_A_3_4_ATOMS, REAL_1BNA_A_3_4_ATOMS_LEN);
+
+    for (auto _ : state) {
+        double rmsd;
+        auto tRet = LLKA_rmsdStructures(&a, &b, &rmsd);
+        if (tRet != LLKA_OK) {
+            state.SkipWithError("Cannot calculate RMSD");
+            break;
+        }
+
+        benchmark::DoNotOptimize(rmsd);
+    }
+
+    state.SetItemsProcessed(int64_t(state.iterations()));
+
+    LLKA_destroyStructure(&a);
+    LLKA_destroyStructure(&b);
+}
+BENCHMARK(BM_RmsdStructures);
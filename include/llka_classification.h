@@ -289,6 +289,23 @@ LLKA_API LLKA_AverageConfal LLKA_CC LLKA_averageConfalAttempted(const LLKA_Class
  */
 LLKA_API LLKA_RetCode LLKA_CC LLKA_classificationClusterForNtC(LLKA_NtC ntc, const LLKA_ClassificationContext *ctx, LLKA_ClassificationCluster *cluster);
 
+/*!
+ * Creates classification context from a snapshot that is already in memory.
+ * See \p LLKA_saveClassificationContext() for details about snapshots.
+ *
+ * The context does not copy the snapshot. The memory with the snapshot must stay valid and unmodified
+ * until the context is destroyed.
+ *
+ * @param[in] data Snapshot data. Must be aligned at least as strictly as memory returned by \p malloc().
+ * @param[in] size Size of the snapshot in bytes.
+ * @param[out] ctx Classification context backed by the snapshot.
+ *
+ * @retval LLKA_OK Success
+ * @retval LLKA_E_INVALID_ARGUMENT Snapshot data is not aligned correctly.
+ * @retval LLKA_E_BAD_DATA Data is not a valid snapshot or the snapshot was created by an incompatible build of the library.
+ */
+LLKA_API LLKA_RetCode LLKA_CC LLKA_classificationContextFromSnapshot(const void *data, size_t size, LLKA_ClassificationContext **ctx);
+
 /*!
  * Translates classification violation flag to string.
  *
@@ -400,6 +417,41 @@ LLKA_API LLKA_RetCode LLKA_CC LLKA_initializeClassificationContext(
     LLKA_ClassificationContext **ctx
 );
 
+#ifndef LLKA_FILESYSTEM_ACCESS_DISABLED
+/*!
+ * Creates classification context from a snapshot file created by \p LLKA_saveClassificationContext().
+ *
+ * The file is mapped to memory and the context uses it in place. Nothing needs to be parsed or precalculated
+ * and the memory of the mapping is shared by all processes that map the same file.
+ *
+ * @param[in] path Path to the snapshot file.
+ * @param[out] ctx Classification context backed by the snapshot.
+ *
+ * @retval LLKA_OK Success
+ * @retval LLKA_E_NO_FILE File does not exist.
+ * @retval LLKA_E_CANNOT_READ_FILE File cannot be mapped.
+ * @retval LLKA_E_BAD_DATA File is not a valid snapshot or the snapshot was created by an incompatible build of the library.
+ */
+LLKA_API LLKA_RetCode LLKA_CC LLKA_mapClassificationContext(const LLKA_PathChar *path, LLKA_ClassificationContext **ctx);
+
+/*!
+ * Saves a snapshot of an initialized classification context to a file.
+ *
+ * Snapshot contains all tables of the context exactly as the classifier uses them, including all precalculated values.
+ * Snapshot is versioned and stores the data in the native memory layout. It can be loaded only by a build
+ * of the library for the same CPU architecture and ABI. Incompatible snapshots are rejected when loaded.
+ *
+ * An existing file is replaced atomically. Processes that have the previous file mapped keep using the previous data.
+ *
+ * @param[in] ctx Classification context to save.
+ * @param[in] path Path to the snapshot file.
+ *
+ * @retval LLKA_OK Success
+ * @retval LLKA_E_CANNOT_WRITE_FILE Snapshot file cannot be written.
+ */
+LLKA_API LLKA_RetCode LLKA_CC LLKA_saveClassificationContext(const LLKA_ClassificationContext *ctx, const LLKA_PathChar *path);
+#endif /* LLKA_FILESYSTEM_ACCESS_DISABLED */
+
 LLKA_END_API_FUNCTIONS
 
 #endif /* _LLKA_CLASSIFICATION_H */
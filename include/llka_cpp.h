@@ -20,12 +20,15 @@
 #include "llka_ntc.h"
 #include "llka_structure.h"
 
+#include <algorithm>
 #include <cassert>
 #ifndef LLKA_FILESYSTEM_ACCESS_DISABLED
 #include <filesystem>
 #endif // LLKA_FILESYSTEM_ACCESS_DISABLED
 #include <map>
+#include <span>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #ifdef LLKA_PLATFORM_EMSCRIPTEN
@@ -546,6 +549,22 @@ auto compareAtoms(const Atom &a, const Atom &b, bool ignoreId) noexcept -> bool;
 LLKA_CPP_API
 auto makeStructure(const LLKA_Atom *atoms, size_t nAtoms) -> Structure;
 
+LLKA_CPP_API
+auto removeAtomsByIds(Structure &stru, const std::vector<uint32_t> &ids) -> size_t;
+
+// Removes all atoms for which the predicate returns true while keeping
+// the relative order of the remaining atoms. Returns the number of removed atoms.
+template <typename Pred>
+inline
+auto removeAtomsIf(Structure &stru, Pred &&predicate) -> size_t
+{
+    auto it = std::remove_if(stru.begin(), stru.end(), std::forward<Pred>(predicate));
+    const size_t removed = std::distance(it, stru.end());
+    stru.erase(it, stru.end());
+
+    return removed;
+}
+
 LLKA_CPP_API
 auto splitByAltIds(const Structure &stru) -> std::vector<AltIdSplit>;
 
@@ -972,6 +991,27 @@ auto loadConfalPercentiles(const std::string &path) -> RCResult<std::vector<LLKA
 LLKA_CPP_API
 auto loadGoldenSteps(const std::string &text) -> RCResult<std::vector<GoldenStep>>;
 
+//
+// Profiling
+//
+
+class ProfileCounter {
+public:
+    int32_t phase;
+    std::string name;
+    uint64_t calls;
+    uint64_t nanoseconds;
+};
+
+LLKA_CPP_API
+auto profileCounters() -> std::vector<ProfileCounter>;
+
+LLKA_CPP_API
+auto profilingEnabled() -> bool;
+
+LLKA_CPP_API
+auto resetProfileCounters() -> void;
+
 //
 // Tracing
 //
@@ -980,6 +1020,18 @@ class TracepointInfo {
 public:
     int32_t TPID;
     std::string description;
+    std::string recordLayout;
+};
+
+class TraceRecord {
+public:
+    int32_t TPID;
+    uint64_t contextId;
+    uint64_t stepIdx;
+    std::vector<double> values;
+    std::vector<int64_t> indices;
+    std::string label;
+    std::string text;
 };
 
 LLKA_CPP_API
@@ -991,6 +1043,9 @@ auto toggleTracepoint(int32_t TPID, bool enable) -> void;
 LLKA_CPP_API
 auto trace(bool dontClear = false) -> std::string;
 
+LLKA_CPP_API
+auto traceRecords(bool dontClear = false) -> std::vector<TraceRecord>;
+
 LLKA_CPP_API
 auto tracepointInfo() -> std::vector<TracepointInfo>;
 
@@ -1135,6 +1190,301 @@ auto initializeClassificationContext(
     double maxCloseEnoughRmsd
 ) -> RCResult<ClassificationContext>;
 
+LLKA_CPP_API
+auto initializeClassificationContextFromBundle(
+    const std::string &clusters,
+    const std::string &goldenSteps,
+    const std::string &confals,
+    const std::string &clusterNuAngles,
+    const std::string &confalPercentiles,
+    const LLKA_ClassificationLimits &limits,
+    double maxCloseEnoughRmsd
+) -> RCResult<ClassificationContext>;
+
+#ifndef LLKA_FILESYSTEM_ACCESS_DISABLED
+
+LLKA_CPP_API
+auto initializeClassificationContextFromDirectory(
+    const std::filesystem::path &path,
+    const LLKA_ClassificationLimits &limits,
+    double maxCloseEnoughRmsd
+) -> RCResult<ClassificationContext>;
+
+#endif // LLKA_FILESYSTEM_ACCESS_DISABLED
+
+//
+// Handles
+//
+
+// Handles own the objects returned by the C API and give access to them without converting
+// them to the value types above. Handles can be moved but not copied. A moved-from handle
+// is empty, its accessors return empty spans. They are not available in Emscripten builds
+// because Embind cannot pass move-only types around.
+#ifndef LLKA_PLATFORM_EMSCRIPTEN
+
+template <typename T, auto Destroy>
+class OwningHandle {
+public:
+    OwningHandle() noexcept :
+        m_obj{},
+        m_owns{false}
+    {
+    }
+
+    explicit OwningHandle(T obj) noexcept :
+        m_obj{obj},
+        m_owns{true}
+    {
+    }
+
+    OwningHandle(const OwningHandle &) = delete;
+
+    OwningHandle(OwningHandle &&other) noexcept :
+        m_obj{other.m_obj},
+        m_owns{other.m_owns}
+    {
+        other.m_obj = {};
+        other.m_owns = false;
+    }
+
+    ~OwningHandle()
+    {
+        if (m_owns)
+            Destroy(&m_obj);
+    }
+
+    OwningHandle & operator=(const OwningHandle &) = delete;
+
+    OwningHandle & operator=(OwningHandle &&other) noexcept
+    {
+        if (this != &other) {
+            if (m_owns)
+                Destroy(&m_obj);
+
+            m_obj = other.m_obj;
+            m_owns = other.m_owns;
+            other.m_obj = {};
+            other.m_owns = false;
+        }
+
+        return *this;
+    }
+
+    auto get() const noexcept -> const T &
+    {
+        assert(m_owns);
+        return m_obj;
+    }
+
+    auto isValid() const noexcept -> bool
+    {
+        return m_owns;
+    }
+
+protected:
+    T m_obj;
+    bool m_owns;
+};
+
+class StructureHandle : public OwningHandle<LLKA_Structure, &LLKA_destroyStructure> {
+public:
+    using OwningHandle::OwningHandle;
+
+    auto atoms() const noexcept -> std::span<const LLKA_Atom>
+    {
+        return { m_obj.atoms, m_obj.nAtoms };
+    }
+
+    auto size() const noexcept -> size_t
+    {
+        return m_obj.nAtoms;
+    }
+
+    LLKA_CPP_API
+    auto toStructure() const -> Structure;
+};
+
+class StructuresHandle : public OwningHandle<LLKA_Structures, &LLKA_destroyStructures> {
+public:
+    using OwningHandle::OwningHandle;
+
+    auto operator[](size_t idx) const noexcept -> const LLKA_Structure &
+    {
+        assert(idx < m_obj.nStrus);
+        return m_obj.strus[idx];
+    }
+
+    auto size() const noexcept -> size_t
+    {
+        return m_obj.nStrus;
+    }
+
+    auto structures() const noexcept -> std::span<const LLKA_Structure>
+    {
+        return { m_obj.strus, m_obj.nStrus };
+    }
+};
+
+class ImportedStructureHandle : public OwningHandle<LLKA_ImportedStructure, &LLKA_destroyImportedStructure> {
+public:
+    using OwningHandle::OwningHandle;
+
+    auto atoms() const noexcept -> std::span<const LLKA_Atom>
+    {
+        return { m_obj.structure.atoms, m_obj.structure.nAtoms };
+    }
+
+    // May be nullptr if the structure was not imported with LLKA_MINICIF_GET_CIFDATA
+    auto cifData() const noexcept -> const LLKA_CifData *
+    {
+        return m_obj.cifData;
+    }
+
+    auto id() const noexcept -> std::string_view
+    {
+        return m_obj.entry.id != nullptr ? m_obj.entry.id : std::string_view{};
+    }
+
+    auto structure() const noexcept -> const LLKA_Structure &
+    {
+        return m_obj.structure;
+    }
+};
+using ImportedStructureHandleResult = Result<ImportedStructureHandle, CifError>;
+
+class ClassifiedStepsHandle : public OwningHandle<LLKA_ClassifiedSteps, &LLKA_destroyClassifiedSteps> {
+public:
+    using OwningHandle::OwningHandle;
+
+    // Names of the closest golden steps point to the classification context. The context must outlive the steps.
+    auto steps() const noexcept -> std::span<const LLKA_AttemptedClassifiedStep>
+    {
+        return { m_obj.attemptedSteps, m_obj.nAttemptedSteps };
+    }
+};
+
+#ifndef LLKA_FILESYSTEM_ACCESS_DISABLED
+
+LLKA_CPP_API
+auto cifToStructureHandle(const std::filesystem::path &path, int32_t options = 0) -> ImportedStructureHandleResult;
+
+#endif // LLKA_FILESYSTEM_ACCESS_DISABLED
+
+LLKA_CPP_API
+auto cifToStructureHandle(const std::string &text, int32_t options = 0) -> ImportedStructureHandleResult;
+
+LLKA_CPP_API
+auto classifyStep(const LLKA_Structure &stru, const ClassificationContext &ctx) -> RCResult<LLKA_ClassifiedStep>;
+
+LLKA_CPP_API
+auto classifySteps(const StructuresHandle &strus, const ClassificationContext &ctx) -> RCResult<ClassifiedStepsHandle>;
+
+LLKA_CPP_API
+auto extractBackbone(const LLKA_Structure &stru) -> RCResult<StructureHandle>;
+
+LLKA_CPP_API
+auto splitStructureToDinucleotideSteps(const LLKA_Structure &stru) -> RCResult<StructuresHandle>;
+
+#endif // LLKA_PLATFORM_EMSCRIPTEN
+
+//
+// Columnar export
+//
+
+// Structures and classification results stored as columns. Each column is a contiguous array
+// with one value per atom or per step. In Emscripten builds the columns are exposed to JavaScript
+// as typed arrays over the WASM memory so that they can be consumed without per-object conversion.
+class LLKA_CPP_API StructureColumns {
+public:
+    StructureColumns() = default;
+    explicit StructureColumns(const LLKA_Structure &stru);
+    explicit StructureColumns(const Structure &stru);
+
+    auto nAtoms() const -> size_t;
+
+    std::vector<double> x;
+    std::vector<double> y;
+    std::vector<double> z;
+    std::vector<int32_t> ids;
+    std::vector<int32_t> labelSeqIds;
+    std::vector<int32_t> authSeqIds;
+    std::vector<int32_t> modelNumbers;
+};
+using StructureColumnsResult = Result<StructureColumns, CifError>;
+
+// Identity of dinucleotide steps, one value per step. Per-step results can be joined back
+// to the residues of the structure through these columns. "First" and "second" refer
+// to the residues of the step. Alternate position ids and insertion codes are empty if not set.
+class LLKA_CPP_API StepIdentityColumns {
+public:
+    StepIdentityColumns() = default;
+    // Step names follow the DNATCO convention and start with the lowercase entry id unless it is empty
+    StepIdentityColumns(const LLKA_Structures &steps, const std::string &entryId);
+
+    std::vector<int32_t> modelNumbers;
+    std::vector<std::string> labelAsymIds;
+    std::vector<std::string> authAsymIds;
+    std::vector<int32_t> labelSeqIdsFirst;
+    std::vector<int32_t> labelSeqIdsSecond;
+    std::vector<int32_t> authSeqIdsFirst;
+    std::vector<int32_t> authSeqIdsSecond;
+    std::vector<std::string> compIdsFirst;
+    std::vector<std::string> compIdsSecond;
+    std::vector<std::string> altIdsFirst;
+    std::vector<std::string> altIdsSecond;
+    std::vector<std::string> insCodesFirst;
+    std::vector<std::string> insCodesSecond;
+    std::vector<std::string> stepNames;
+};
+
+class LLKA_CPP_API ClassifiedStepsColumns : public StepIdentityColumns {
+public:
+    static constexpr size_t NUM_METRICS = 12;
+
+    ClassifiedStepsColumns() = default;
+    // Creates only the result columns, the identity columns are left empty
+    explicit ClassifiedStepsColumns(const LLKA_ClassifiedSteps &steps);
+    ClassifiedStepsColumns(const LLKA_Structures &steps, const LLKA_ClassifiedSteps &classified, const std::string &entryId);
+
+    auto nSteps() const -> size_t;
+
+    // Values of one metric of all steps. Metrics are indexed in the order of the fields of LLKA_StepMetrics.
+    auto metric(size_t idx) const -> std::span<const double>;
+
+    // Steps that could not be classified have their NtCs and CANAs set to the invalid values
+    // and their numeric values set to NaN.
+    std::vector<int32_t> statuses;
+    std::vector<int32_t> assignedNtCs;
+    std::vector<int32_t> assignedCANAs;
+    std::vector<int32_t> closestNtCs;
+    std::vector<int32_t> closestCANAs;
+    std::vector<int32_t> violations;
+    std::vector<double> confalScores;
+    std::vector<double> rmsdsToClosestNtC;
+    std::vector<double> metrics;    // NUM_METRICS columns, one after another
+};
+
+using ClassifiedStepsColumnsResult = Result<ClassifiedStepsColumns, CifError>;
+
+// Step names of steps classified from value types do not contain the entry id
+LLKA_CPP_API
+auto classifyStepsColumns(const Structures &strus, const ClassificationContext &ctx) -> RCResult<ClassifiedStepsColumns>;
+
+#ifndef LLKA_PLATFORM_EMSCRIPTEN
+
+LLKA_CPP_API
+auto classifyStepsColumns(const StructuresHandle &strus, const ClassificationContext &ctx, const std::string &entryId = {}) -> RCResult<ClassifiedStepsColumns>;
+
+#endif // LLKA_PLATFORM_EMSCRIPTEN
+
+// Imports the structure, splits it to steps and classifies them without converting anything to the value types.
+// Failures of the splitting or of the classification are reported with an empty error string.
+LLKA_CPP_API
+auto classifyCifColumns(const std::string &text, const ClassificationContext &ctx, int32_t options = 0) -> ClassifiedStepsColumnsResult;
+
+LLKA_CPP_API
+auto cifToStructureColumns(const std::string &text, int32_t options = 0) -> StructureColumnsResult;
+
 } // namespace LLKA
 
 
@@ -1171,6 +1521,7 @@ template LLKA_CPP_API auto makeStdVector<int32_t>();
 #define _EMX_CLS_PROP_READONLY(prop, cls) .property(#prop, &cls::_emsGet_##prop)
 #define _EMX_ENUM_VAL(ev) .value(#ev, ev)
 #define _EMX_VOF(f, vo) .field(#f, &vo::f)
+#define _EMX_CLS_COLUMN(type, cls, col) .function(#col, &_emxColumnView<cls, type, &cls::col>)
 #define _EMX_MK_RCRESULT(S) \
     emscripten::class_<LLKA::RCResult<S>>("RCResult_"#S) \
         .constructor<S>() \
@@ -1180,6 +1531,22 @@ template LLKA_CPP_API auto makeStdVector<int32_t>();
         .function("const_success", std::function<const S &(const LLKA::RCResult<S>&)>(&LLKA::RCResult<S>::const_success)) \
         .function("isSuccess", &LLKA::RCResult<S>::isSuccess)
 
+// The views are valid only until the memory of the WASM module grows. Callers must copy or consume
+// them before they call into the module again.
+template <typename Cls, typename T, std::vector<T> Cls::* Column>
+auto _emxColumnView(const Cls &obj) -> emscripten::val
+{
+    const auto &column = obj.*Column;
+    return emscripten::val{emscripten::typed_memory_view(column.size(), column.data())};
+}
+
+inline
+auto _emxMetricView(const LLKA::ClassifiedStepsColumns &obj, size_t idx) -> emscripten::val
+{
+    const auto column = obj.metric(idx);
+    return emscripten::val{emscripten::typed_memory_view(column.size(), column.data())};
+}
+
 EMSCRIPTEN_BINDINGS(LLKA)
 {
     //
@@ -1207,6 +1574,7 @@ EMSCRIPTEN_BINDINGS(LLKA)
         _EMX_ENUM_VAL(LLKA_E_BAD_DATA)
         _EMX_ENUM_VAL(LLKA_E_NO_DATA)
         _EMX_ENUM_VAL(LLKA_E_NOTHING_TO_CLASSIFY)
+        _EMX_ENUM_VAL(LLKA_E_CANNOT_WRITE_FILE)
     ;
 
     emscripten::function("errorToString", &LLKA::errorToString);
@@ -1924,6 +2292,7 @@ EMSCRIPTEN_BINDINGS(LLKA)
     emscripten::value_object<LLKA::TracepointInfo>("TracepointInfo")
         _EMX_VOF(TPID, LLKA::TracepointInfo)
         _EMX_VOF(description, LLKA::TracepointInfo)
+        _EMX_VOF(recordLayout, LLKA::TracepointInfo)
     ;
 
     emscripten::function("toggleAllTracepoints", &LLKA::toggleAllTracepoints);
@@ -2007,6 +2376,82 @@ EMSCRIPTEN_BINDINGS(LLKA)
     emscripten::function("classifyStep", &LLKA::classifyStep);
     emscripten::function("classifySteps", &LLKA::classifySteps);
     emscripten::function("initializeClassificationContext", &LLKA::initializeClassificationContext);
+    emscripten::function("initializeClassificationContextFromBundle", &LLKA::initializeClassificationContextFromBundle);
+#ifndef LLKA_FILESYSTEM_ACCESS_DISABLED
+    emscripten::function("initializeClassificationContextFromDirectory", &LLKA::initializeClassificationContextFromDirectory);
+#endif // LLKA_FILESYSTEM_ACCESS_DISABLED
+
+    //
+    // Columnar export
+    //
+
+    emscripten::class_<LLKA::StructureColumns>("StructureColumns")
+        .constructor<>()
+        .function("nAtoms", &LLKA::StructureColumns::nAtoms)
+        _EMX_CLS_COLUMN(double, LLKA::StructureColumns, x)
+        _EMX_CLS_COLUMN(double, LLKA::StructureColumns, y)
+        _EMX_CLS_COLUMN(double, LLKA::StructureColumns, z)
+        _EMX_CLS_COLUMN(int32_t, LLKA::StructureColumns, ids)
+        _EMX_CLS_COLUMN(int32_t, LLKA::StructureColumns, labelSeqIds)
+        _EMX_CLS_COLUMN(int32_t, LLKA::StructureColumns, authSeqIds)
+        _EMX_CLS_COLUMN(int32_t, LLKA::StructureColumns, modelNumbers)
+    ;
+
+    emscripten::class_<LLKA::StructureColumnsResult>("StructureColumnsResult")
+        .constructor<LLKA::StructureColumns>()
+        .constructor<LLKA::CifError, bool>()
+        .function("failure", &LLKA::StructureColumnsResult::failure)
+        .function("success", std::function<typename LLKA::ResultSuccessReturnType<LLKA::StructureColumns, std::is_copy_constructible_v<LLKA::StructureColumns>>::RT (LLKA::StructureColumnsResult&)>(&LLKA::StructureColumnsResult::success))
+        .function("const_success", std::function<const LLKA::StructureColumns &(const LLKA::StructureColumnsResult&)>(&LLKA::StructureColumnsResult::const_success))
+        .function("isSuccess", &LLKA::StructureColumnsResult::isSuccess)
+    ;
+
+    // String columns cannot be viewed and are copied to a StringVector
+    emscripten::class_<LLKA::StepIdentityColumns>("StepIdentityColumns")
+        .constructor<>()
+        _EMX_CLS_COLUMN(int32_t, LLKA::StepIdentityColumns, modelNumbers)
+        .property("labelAsymIds", &LLKA::StepIdentityColumns::labelAsymIds)
+        .property("authAsymIds", &LLKA::StepIdentityColumns::authAsymIds)
+        _EMX_CLS_COLUMN(int32_t, LLKA::StepIdentityColumns, labelSeqIdsFirst)
+        _EMX_CLS_COLUMN(int32_t, LLKA::StepIdentityColumns, labelSeqIdsSecond)
+        _EMX_CLS_COLUMN(int32_t, LLKA::StepIdentityColumns, authSeqIdsFirst)
+        _EMX_CLS_COLUMN(int32_t, LLKA::StepIdentityColumns, authSeqIdsSecond)
+        .property("compIdsFirst", &LLKA::StepIdentityColumns::compIdsFirst)
+        .property("compIdsSecond", &LLKA::StepIdentityColumns::compIdsSecond)
+        .property("altIdsFirst", &LLKA::StepIdentityColumns::altIdsFirst)
+        .property("altIdsSecond", &LLKA::StepIdentityColumns::altIdsSecond)
+        .property("insCodesFirst", &LLKA::StepIdentityColumns::insCodesFirst)
+        .property("insCodesSecond", &LLKA::StepIdentityColumns::insCodesSecond)
+        .property("stepNames", &LLKA::StepIdentityColumns::stepNames)
+    ;
+
+    emscripten::class_<LLKA::ClassifiedStepsColumns, emscripten::base<LLKA::StepIdentityColumns>>("ClassifiedStepsColumns")
+        .constructor<>()
+        .function("nSteps", &LLKA::ClassifiedStepsColumns::nSteps)
+        .function("metric", &_emxMetricView)
+        _EMX_CLS_COLUMN(int32_t, LLKA::ClassifiedStepsColumns, statuses)
+        _EMX_CLS_COLUMN(int32_t, LLKA::ClassifiedStepsColumns, assignedNtCs)
+        _EMX_CLS_COLUMN(int32_t, LLKA::ClassifiedStepsColumns, assignedCANAs)
+        _EMX_CLS_COLUMN(int32_t, LLKA::ClassifiedStepsColumns, closestNtCs)
+        _EMX_CLS_COLUMN(int32_t, LLKA::ClassifiedStepsColumns, closestCANAs)
+        _EMX_CLS_COLUMN(int32_t, LLKA::ClassifiedStepsColumns, violations)
+        _EMX_CLS_COLUMN(double, LLKA::ClassifiedStepsColumns, confalScores)
+        _EMX_CLS_COLUMN(double, LLKA::ClassifiedStepsColumns, rmsdsToClosestNtC)
+    ;
+    _EMX_MK_RCRESULT(LLKA::ClassifiedStepsColumns);
+
+    emscripten::class_<LLKA::ClassifiedStepsColumnsResult>("ClassifiedStepsColumnsResult")
+        .constructor<LLKA::ClassifiedStepsColumns>()
+        .constructor<LLKA::CifError, bool>()
+        .function("failure", &LLKA::ClassifiedStepsColumnsResult::failure)
+        .function("success", std::function<typename LLKA::ResultSuccessReturnType<LLKA::ClassifiedStepsColumns, std::is_copy_constructible_v<LLKA::ClassifiedStepsColumns>>::RT (LLKA::ClassifiedStepsColumnsResult&)>(&LLKA::ClassifiedStepsColumnsResult::success))
+        .function("const_success", std::function<const LLKA::ClassifiedStepsColumns &(const LLKA::ClassifiedStepsColumnsResult&)>(&LLKA::ClassifiedStepsColumnsResult::const_success))
+        .function("isSuccess", &LLKA::ClassifiedStepsColumnsResult::isSuccess)
+    ;
+
+    emscripten::function("classifyStepsColumns", &LLKA::classifyStepsColumns);
+    emscripten::function("classifyCifColumns", &LLKA::classifyCifColumns);
+    emscripten::function("cifToStructureColumns", &LLKA::cifToStructureColumns);
 }
 
 #endif // LLKA_GENERATE_EMSCRIPTEN_BINDINGS
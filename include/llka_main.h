@@ -50,8 +50,9 @@ typedef enum LLKA_RetCode {
     LLKA_E_CANNOT_READ_FILE            = 0x13,    /*!< File exists but cannot be read */
     LLKA_E_BAD_DATA                    = 0x14,    /*!< Data contains wrong or unexpected values */
     LLKA_E_NO_DATA                     = 0x15,    /*!< Data block is empty when it should not be */
-    LLKA_E_NOTHING_TO_CLASSIFY         = 0x16     /*!< Empty data was passed to classification module
+    LLKA_E_NOTHING_TO_CLASSIFY         = 0x16,    /*!< Empty data was passed to classification module
                                                        The usual cause of this error is when at attempt is made to classify a structure that does not contain any nucleic acid residues */
+    LLKA_E_CANNOT_WRITE_FILE           = 0x17     /*!< File cannot be created or written to */
     ENUM_FORCE_INT32_SIZE(LLKA_RetCode)
 } LLKA_RetCode;
 
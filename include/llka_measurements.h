@@ -5,6 +5,8 @@
 
 #include "llka_structure.h"
 
+LLKA_BEGIN_API_FUNCTIONS
+
 LLKA_API float LLKA_CC LLKA_measureAnglef(const LLKA_Atom *a, const LLKA_Atom *b, const LLKA_Atom *c);
 LLKA_API double LLKA_CC LLKA_measureAngle(const LLKA_Atom *a, const LLKA_Atom *b, const LLKA_Atom *c);
 
@@ -14,4 +16,15 @@ LLKA_API double LLKA_CC LLKA_measureDihedral(const LLKA_Atom *a, const LLKA_Atom
 LLKA_API float LLKA_CC LLKA_measureDistancef(const LLKA_Atom *a, const LLKA_Atom *b);
 LLKA_API double LLKA_CC LLKA_measureDistance(const LLKA_Atom *a, const LLKA_Atom *b);
 
+/*!
+ * Batch variants. Points are passed as consecutive tuples, e.g. the i-th dihedral is
+ * defined by points quads[4*i] to quads[4*i + 3]. Output arrays must have room for \p n values.
+ * Dihedrals with three colinear points are reported as NAN.
+ */
+LLKA_API void LLKA_CC LLKA_measureAnglesBatch(const LLKA_Point *triples, size_t n, double *out);
+LLKA_API void LLKA_CC LLKA_measureDihedralsBatch(const LLKA_Point *quads, size_t n, double *out);
+LLKA_API void LLKA_CC LLKA_measureDistancesBatch(const LLKA_Point *pairs, size_t n, double *out);
+
+LLKA_END_API_FUNCTIONS
+
 #endif /* _LLKA_MEASUREMENTS_H */
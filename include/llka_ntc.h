@@ -3,6 +3,7 @@
 #ifndef _LLKA_NTC_H
 #define _LLKA_NTC_H
 
+#include "llka_nucleotide.h"
 #include "llka_structure.h"
 
 #define LLKA_INTERNAL_NTC_VERSION "3.5"
@@ -131,6 +132,41 @@ typedef struct LLKA_StepMetrics {
 } LLKA_StepMetrics;
 LLKA_IS_POD(LLKA_StepMetrics)
 
+/*!
+ * Atoms of a NtC step that are used to calculate the individual step metrics.
+ * The pointers refer to atoms in the structure the map was created from. The map becomes invalid
+ * once the structure is modified or destroyed.
+ */
+typedef struct LLKA_StepAtomMap {
+    const LLKA_Atom *torsions[9][4];    /*!< Atoms of dinucleotide torsions, indexed by LLKA_DinucleotideTorsion */
+    const LLKA_Atom *CC[2];             /*!< Atoms of the CC distance */
+    const LLKA_Atom *NN[2];             /*!< Atoms of the NN distance */
+    const LLKA_Atom *mu[4];             /*!< Atoms of the mu torsion */
+} LLKA_StepAtomMap;
+LLKA_IS_POD(LLKA_StepAtomMap)
+
+/*!
+ * Result of an attempt to calculate metrics of a single step of a structure combined with an error code.
+ * Used by \p LLKA_calculateStructureStepMetrics()
+ */
+typedef struct LLKA_AttemptedStepMetrics {
+    LLKA_StepMetrics metrics;       /*!< Step metrics */
+    LLKA_RiboseMetrics ribose_1;    /*!< Ribose metrics of the first nucleotide of the step */
+    LLKA_RiboseMetrics ribose_2;    /*!< Ribose metrics of the second nucleotide of the step */
+    LLKA_RetCode status;            /*!< Return code of the attempt. The metrics are valid only if this is \p LLKA_OK */
+} LLKA_AttemptedStepMetrics;
+LLKA_IS_POD(LLKA_AttemptedStepMetrics)
+
+/*!
+ * Metrics of all steps of a structure
+ */
+typedef struct LLKA_StructureStepMetrics {
+    LLKA_Structures steps;                          /*!< Steps the structure was split into */
+    LLKA_AttemptedStepMetrics *attemptedMetrics;    /*!< Array of attempted metrics, one item for each step in \p steps */
+    size_t nAttemptedMetrics;                       /*!< Number of items in \p attemptedMetrics array */
+} LLKA_StructureStepMetrics;
+LLKA_IS_POD(LLKA_StructureStepMetrics)
+
 #define LLKA_INVALID_BKBN_ATOM_INDEX (size_t)-1
 
 LLKA_BEGIN_API_FUNCTIONS
@@ -169,6 +205,17 @@ LLKA_API const char * LLKA_CC LLKA_CANAToName(LLKA_CANA cana);
  */
 LLKA_API LLKA_RetCode LLKA_CC LLKA_calculateStepMetrics(const LLKA_Structure *stru, LLKA_StepMetrics *metrics);
 
+/*!
+ * Calculates step metrics from a step atom map.
+ *
+ * @param[in] map Step atom map created by \p LLKA_stepAtomMap().
+ * @param[out] metrics Calculated metrics.
+ *
+ * @retval LLKA_OK Metrics was calculated successfully
+ * @retval LLKA_E_BAD_DATA Some of the metrics could not have been calculated from the atom coordinates.
+ */
+LLKA_API LLKA_RetCode LLKA_CC LLKA_calculateStepMetricsFromAtomMap(const LLKA_StepAtomMap *map, LLKA_StepMetrics *metrics);
+
 /*!
  * Calculates the difference between NtC step metrics of a given real step against a reference step
  *
@@ -187,6 +234,22 @@ LLKA_API LLKA_RetCode LLKA_CC LLKA_calculateStepMetrics(const LLKA_Structure *st
  */
 LLKA_API LLKA_RetCode LLKA_CC LLKA_calculateStepMetricsDifferenceAgainstReference(const LLKA_Structure *stru, LLKA_NtC ntc, LLKA_StepMetrics *metrics);
 
+/*!
+ * Splits a structure into NtC steps and calculates step and ribose metrics of all of them.
+ *
+ * This is faster than calling \p LLKA_calculateStepMetrics() on each step because the quantities
+ * that belong to a nucleotide shared by two adjacent steps (delta, chi and ribose metrics) are calculated just once.
+ *
+ * @param[in] stru Structure to calculate the metrics for.
+ * @param[out] metrics Calculated metrics. Status of each individual step is reported in the \p status field
+ *                     of the corresponding \p LLKA_AttemptedStepMetrics item. The object must be released
+ *                     with \p LLKA_destroyStructureStepMetrics().
+ *
+ * @retval LLKA_OK Structure was split into steps and the calculation was attempted for each step.
+ * @retval LLKA_E_BAD_DATA Structure could not have been split into steps.
+ */
+LLKA_API LLKA_RetCode LLKA_CC LLKA_calculateStructureStepMetrics(const LLKA_Structure *stru, LLKA_StructureStepMetrics *metrics);
+
 /*!
  * Returns atoms that are measured to calculate a particular NtC step metric.
  *
@@ -290,6 +353,13 @@ LLKA_API LLKA_RetCode LLKA_CC LLKA_dinucleotideTorsionAtomsFromStructure(const L
  */
 LLKA_API const char * LLKA_CC LLKA_dinucleotideTorsionName(LLKA_DinucleotideTorsion torsion, LLKA_Bool greek);
 
+/*!
+ * Destroys \p LLKA_StructureStepMetrics object.
+ *
+ * @param[in] metrics The object to destroy.
+ */
+LLKA_API void LLKA_CC LLKA_destroyStructureStepMetrics(LLKA_StructureStepMetrics *metrics);
+
 /*!
  * Extracts backbone from a step.
  *
@@ -412,6 +482,23 @@ LLKA_API LLKA_Structure LLKA_CC LLKA_NtCStructure(LLKA_NtC ntc);
  */
 LLKA_API const char * LLKA_CC LLKA_NtCToName(LLKA_NtC ntc);
 
+/*!
+ * Finds all atoms of a NtC step that are needed to calculate step metrics.
+ * All atoms are resolved in a single pass over the structure. The map can be reused
+ * to calculate the metrics repeatedly without having to look up the atoms again.
+ *
+ * @param[in] stru Structure to create the map for. This structure must be a valid single NtC step.
+ * @param[out] map The step atom map.
+ *
+ * @retval LLKA_OK Map was created successfully
+ * @retval LLKA_E_MISSING_ATOMS Passed structure is not a valid step.
+ * @retval LLKA_E_MISMATCHING_DATA Passed structure is not a valid step.
+ * @retval LLKA_E_MISMATCHING_SIZES Passed structure is not a step.
+ * @retval LLKA_E_MULTIPLE_ALT_IDS Passed structure is not a valid step.
+ * @retval LLKA_E_INVALID_ARGUMENT Passed structure is not a valid step.
+ */
+LLKA_API LLKA_RetCode LLKA_CC LLKA_stepAtomMap(const LLKA_Structure *stru, LLKA_StepAtomMap *map);
+
 /*!
  * Checks if a structure represents a single NtC step.
  *
@@ -42,6 +42,26 @@ typedef struct LLKA_RiboseMetrics {
 } LLKA_RiboseMetrics;
 LLKA_IS_POD(LLKA_RiboseMetrics)
 
+/*!
+ * Result of an attempt to calculate ribose metrics of one residue of a structure.
+ */
+typedef struct LLKA_AttemptedRiboseMetrics {
+    size_t firstAtomIdx;        /*!< Index of the first atom of the residue in the input structure */
+    size_t nAtoms;              /*!< Number of consecutive atoms of the residue in the input structure */
+    LLKA_RiboseMetrics metrics; /*!< Calculated ribose metrics. Valid only if \p status is \p LLKA_OK */
+    LLKA_RetCode status;        /*!< Result of the calculation */
+} LLKA_AttemptedRiboseMetrics;
+LLKA_IS_POD(LLKA_AttemptedRiboseMetrics)
+
+/*!
+ * Ribose metrics of all nucleotides of a structure.
+ */
+typedef struct LLKA_RiboseMetricsMultiple {
+    LLKA_AttemptedRiboseMetrics *attemptedMetrics;  /*!< Array of attempted calculations, one per nucleotide */
+    size_t nAttemptedMetrics;                       /*!< Number of attempted calculations */
+} LLKA_RiboseMetricsMultiple;
+LLKA_IS_POD(LLKA_RiboseMetricsMultiple)
+
 /*!
  * Levels of brevity of sugar pucker name
  */
@@ -53,6 +73,13 @@ typedef enum LLKA_SugarPuckerNameBrevity {
 
 LLKA_BEGIN_API_FUNCTIONS
 
+/*!
+ * Destroys \p LLKA_RiboseMetricsMultiple object.
+ *
+ * @param[in] metrics The object to destroy.
+ */
+LLKA_API void LLKA_CC LLKA_destroyRiboseMetricsMultiple(LLKA_RiboseMetricsMultiple *metrics);
+
 /*!
  * Extracts a single nucleotide from a structure as LLKA_Structure.
  *
@@ -138,6 +165,22 @@ LLKA_API LLKA_SugarPucker LLKA_CC LLKA_nameToSugarPucker(const char *name);
  */
 LLKA_API LLKA_RetCode LLKA_CC LLKA_riboseMetrics(const LLKA_Structure *stru, LLKA_RiboseMetrics *metrics);
 
+/*!
+ * Calculates metrics for the ribose cores of all nucleotides in a structure.
+ *
+ * Atoms of each nucleotide are expected to be stored next to each other, as they are in mmCIF files.
+ * Residues that are not nucleotides are skipped. This is considerably faster than extracting
+ * every nucleotide and calling \p LLKA_riboseMetrics() on it.
+ *
+ * @param[in] stru Structure with the nucleotides
+ * @param[out] metrics Calculated ribose metrics. Status of each nucleotide is reported in the \p status field
+ *                     of the corresponding \p LLKA_AttemptedRiboseMetrics item. The object must be released
+ *                     with \p LLKA_destroyRiboseMetricsMultiple().
+ *
+ * @retval LLKA_OK Calculation was attempted for all nucleotides in the structure
+ */
+LLKA_API LLKA_RetCode LLKA_CC LLKA_riboseMetricsMultiple(const LLKA_Structure *stru, LLKA_RiboseMetricsMultiple *metrics);
+
 /*!
  * Calculates metrics for the ribose core of a nucleotide view.
  * The input structure must contain exactly one ribose core, otherwise the result is undefined.
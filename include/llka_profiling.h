@@ -0,0 +1,76 @@
+/* vim: set sw=4 ts=4 sts=4 expandtab : */
+
+#ifndef _LLKA_PROFILING_H
+#define _LLKA_PROFILING_H
+
+#include "llka_main.h"
+
+/*!
+ * Phases of the processing whose duration can be measured.
+ * Time spent in a nested phase is included in the time of the enclosing phase.
+ */
+typedef enum LLKA_ProfilePhase {
+    LLKA_PROFILE_CIF_PARSE                  = 0,    /*!< Tokenizing and parsing of Cif text into data blocks */
+    LLKA_PROFILE_CIF_TO_STRUCTURE           = 1,    /*!< Conversion of Cif text to a structure, includes \p LLKA_PROFILE_CIF_PARSE */
+    LLKA_PROFILE_SPLIT_TO_STEPS             = 2,    /*!< Splitting of a structure to dinucleotide steps */
+    LLKA_PROFILE_CLASSIFY_STEP              = 3,    /*!< Classification of one step, includes all phases below */
+    LLKA_PROFILE_STEP_METRICS               = 4,    /*!< Calculation of step metrics */
+    LLKA_PROFILE_RIBOSE_METRICS             = 5,    /*!< Calculation of ribose geometry */
+    LLKA_PROFILE_GOLDEN_STEP_SCAN           = 6,    /*!< Search for the nearest golden steps */
+    LLKA_PROFILE_CLUSTER_VOTING             = 7,    /*!< Selection of the best cluster from the nearest golden steps */
+    LLKA_PROFILE_SUPERPOSITION              = 8,    /*!< Superposition of the step onto the reference NtC backbone */
+    LLKA_PROFILE_TOLERANCES                 = 9,    /*!< Checking of the step against NtC tolerances */
+    LLKA_PROFILE_CONFAL_SCORING             = 10,   /*!< Calculation of the confal score */
+    LLKA_PROFILE_NUM_PHASES                 = 11
+    ENUM_FORCE_INT32_SIZE(LLKA_ProfilePhase)
+} LLKA_ProfilePhase;
+
+typedef struct LLKA_ProfileCounter {
+    LLKA_ProfilePhase phase;    /*!< Measured phase */
+    const char *name;           /*!< Human-readable name of the phase. The string is statically allocated and must not be freed. */
+    uint64_t calls;             /*!< Number of times the phase was entered */
+    uint64_t nanoseconds;       /*!< Total time spent in the phase */
+} LLKA_ProfileCounter;
+LLKA_IS_POD(LLKA_ProfileCounter)
+
+typedef struct LLKA_ProfileCounters {
+    LLKA_ProfileCounter *counters;  /*!< Array of \p LLKA_ProfileCounter s */
+    size_t nCounters;               /*!< Length of the array */
+} LLKA_ProfileCounters;
+LLKA_IS_POD(LLKA_ProfileCounters)
+
+LLKA_BEGIN_API_FUNCTIONS
+
+/*!
+ * Destroys LLKA_ProfileCounters
+ *
+ * @param[in] counters LLKA_ProfileCounters object to destroy
+ */
+LLKA_API void LLKA_CC LLKA_destroyProfileCounters(LLKA_ProfileCounters *counters);
+
+/*!
+ * Returns the counters of all profiled phases.
+ *
+ * Every thread counts into its own set of counters. The counters of all threads,
+ * including the threads that have already exited, are summed up by this function.
+ * Profiling is available only if the library was built with \p LLKA_ENABLE_PROFILING defined.
+ *
+ * @return Counters of all phases ordered by \p LLKA_ProfilePhase. The array is empty if profiling is not available.
+ */
+LLKA_API LLKA_ProfileCounters LLKA_CC LLKA_profileCounters();
+
+/*!
+ * Returns whether the library was built with profiling.
+ *
+ * @retval true if profile counters are collected and vice versa.
+ */
+LLKA_API LLKA_Bool LLKA_CC LLKA_profilingEnabled();
+
+/*!
+ * Sets all profile counters to zero.
+ */
+LLKA_API void LLKA_CC LLKA_resetProfileCounters();
+
+LLKA_END_API_FUNCTIONS
+
+#endif /* _LLKA_PROFILING_H */
@@ -31,6 +31,19 @@ typedef struct LLKA_Resource {
 } LLKA_Resource;
 LLKA_IS_POD(LLKA_Resource)
 
+/*!
+ * Texts of all resources needed to initialize a classification context.
+ * The texts have the same format as the files loaded by \p LLKA_loadResourceFile().
+ */
+typedef struct LLKA_ClassificationResourceBundle {
+    const char *clusters;           /*!< Classification clusters */
+    const char *goldenSteps;        /*!< Golden steps */
+    const char *confals;            /*!< Confals */
+    const char *clusterNuAngles;    /*!< Average Nu angles */
+    const char *confalPercentiles;  /*!< Confal percentiles */
+} LLKA_ClassificationResourceBundle;
+LLKA_IS_POD(LLKA_ClassificationResourceBundle)
+
 LLKA_BEGIN_API_FUNCTIONS
 
 /*!
@@ -40,6 +53,70 @@ LLKA_BEGIN_API_FUNCTIONS
  */
 LLKA_API void LLKA_CC LLKA_destroyResource(LLKA_Resource *resource);
 
+/*!
+ * Creates classification context directly from the texts of the classification resources.
+ *
+ * This is equivalent to loading each resource with \p LLKA_loadResourceText() and passing the results
+ * to \p LLKA_initializeClassificationContext() but the resources are parsed concurrently and straight
+ * into the context without any intermediate copies.
+ *
+ * @param[in] bundle Texts of the resources. All texts must be set.
+ * @param[in] limits Classification limits.
+ * @param[in] maxCloseEnoughRmsd Maximum RMSD value of an unassigned step at which the step is considered as "unassigned but close"
+ * @param[out] ctx Initialized classification context.
+ *
+ * @retval LLKA_OK Success
+ * @retval LLKA_E_INVALID_ARGUMENT Some texts are not set or some arguments are invalid.
+ * @retval LLKA_E_BAD_DATA Input data is malformed.
+ * @retval LLKA_E_MISMATCHING_DATA Input data is malformed.
+ * @retval LLKA_E_MISMATCHING_SIZES Input data is malformed or the resources do not match each other.
+ * @retval LLKA_E_BAD_CLASSIFICATION_CLUSTERS Some clusters have invalid definitions.
+ * @retval LLKA_E_BAD_GOLDEN_STEPS Some golden steps have invalid definitions or unknown cluster numbers.
+ * @retval LLKA_E_BAD_CONFALS Some confals have invalid definitions or unknown cluster numbers.
+ * @retval LLKA_E_BAD_AVERAGE_NU_ANGLES Some cluster nu angles have invalid definitions or unknown cluster numbers.
+ * @retval LLKA_E_BAD_CLASSIFICATION_LIMITS Classification limits have invalid values.
+ */
+LLKA_API LLKA_RetCode LLKA_CC LLKA_initializeClassificationContextFromBundle(
+    const LLKA_ClassificationResourceBundle *bundle,
+    const LLKA_ClassificationLimits *limits,
+    double maxCloseEnoughRmsd,
+    LLKA_ClassificationContext **ctx
+);
+
+#ifndef LLKA_FILESYSTEM_ACCESS_DISABLED
+/*!
+ * Creates classification context from a directory with the classification resource files.
+ *
+ * The directory must contain files <tt>clusters.csv</tt>, <tt>golden_steps.csv</tt>, <tt>confals.csv</tt>,
+ * <tt>nu_angles.csv</tt> and <tt>confal_percentiles.csv</tt>. The files are loaded concurrently and parsed
+ * straight into the context without any intermediate copies.
+ *
+ * @param[in] path Path to the directory.
+ * @param[in] limits Classification limits.
+ * @param[in] maxCloseEnoughRmsd Maximum RMSD value of an unassigned step at which the step is considered as "unassigned but close"
+ * @param[out] ctx Initialized classification context.
+ *
+ * @retval LLKA_OK Success
+ * @retval LLKA_E_INVALID_ARGUMENT Some arguments are invalid.
+ * @retval LLKA_E_NO_FILE Some files were not found.
+ * @retval LLKA_E_CANNOT_READ_FILE Some files exist but cannot be read.
+ * @retval LLKA_E_BAD_DATA Input data is malformed.
+ * @retval LLKA_E_MISMATCHING_DATA Input data is malformed.
+ * @retval LLKA_E_MISMATCHING_SIZES Input data is malformed or the resources do not match each other.
+ * @retval LLKA_E_BAD_CLASSIFICATION_CLUSTERS Some clusters have invalid definitions.
+ * @retval LLKA_E_BAD_GOLDEN_STEPS Some golden steps have invalid definitions or unknown cluster numbers.
+ * @retval LLKA_E_BAD_CONFALS Some confals have invalid definitions or unknown cluster numbers.
+ * @retval LLKA_E_BAD_AVERAGE_NU_ANGLES Some cluster nu angles have invalid definitions or unknown cluster numbers.
+ * @retval LLKA_E_BAD_CLASSIFICATION_LIMITS Classification limits have invalid values.
+ */
+LLKA_API LLKA_RetCode LLKA_CC LLKA_initializeClassificationContextFromDirectory(
+    const LLKA_PathChar *path,
+    const LLKA_ClassificationLimits *limits,
+    double maxCloseEnoughRmsd,
+    LLKA_ClassificationContext **ctx
+);
+#endif /* LLKA_FILESYSTEM_ACCESS_DISABLED */
+
 #ifndef LLKA_FILESYSTEM_ACCESS_DISABLED
 /*!
  * Loads resource from file of a text string.
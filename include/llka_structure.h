@@ -72,6 +72,15 @@ typedef struct LLKA_StructureView {
 } LLKA_StructureView;
 LLKA_IS_POD(LLKA_StructureView)
 
+/*!
+ * A set of structure views
+ */
+typedef struct LLKA_StructureViews {
+    LLKA_StructureView *views;    /*!< Array of \p LLKA_StructureView s */
+    size_t nViews;                /*!< Number of views in the set */
+} LLKA_StructureViews;
+LLKA_IS_POD(LLKA_StructureViews)
+
 /*!
  * A set of structures
  */
@@ -81,6 +90,30 @@ typedef struct LLKA_Structures {
 } LLKA_Structures;
 LLKA_IS_POD(LLKA_Structures)
 
+/*!
+ * Helper object to assemble a \p LLKA_Structure atom by atom.
+ *
+ * Unlike \p LLKA_appendAtom(), appending to a builder does not reallocate the array of atoms
+ * on every call. The array grows geometrically, making the total cost of building a structure linear.
+ * Fields of the builder are managed by the library and shall not be modified directly.
+ */
+typedef struct LLKA_StructureBuilder {
+    LLKA_Atom *atoms;    /*!< Array of appended \p LLKA_Atom s */
+    size_t nAtoms;       /*!< Number of atoms appended so far */
+    size_t capacity;     /*!< Actual capacity of the atoms array */
+} LLKA_StructureBuilder;
+LLKA_IS_POD(LLKA_StructureBuilder)
+
+/*!
+ * Predicate that decides whether an atom shall be processed by a function such as \p LLKA_removeAtomsIf()
+ *
+ * @param[in] atom The atom to decide upon.
+ * @param[in] userData Arbitrary data passed by the caller. May be <tt>NULL</tt>.
+ *
+ * @return \p LLKA_TRUE if the atom matches the predicate, \p LLKA_FALSE otherwise.
+ */
+typedef LLKA_Bool (LLKA_CC *LLKA_AtomPredicate)(const LLKA_Atom *atom, void *userData);
+
 LLKA_BEGIN_API_FUNCTIONS
 
 /*!
@@ -134,8 +167,63 @@ LLKA_API void LLKA_CC LLKA_appendAtomFromParams(
     LLKA_Structure *stru
 );
 
+/*!
+ * Appends atom to a structure builder.
+ *
+ * Contents of the input <tt>LLKA_Atom</tt> are deep-copied to the builder.
+ *
+ * @param[in] atom LLKA_Atom to append.
+ * @param[in,out] builder LLKA_StructureBuilder to append the atom to.
+ */
+LLKA_API void LLKA_CC LLKA_appendAtomToBuilder(const LLKA_Atom *atom, LLKA_StructureBuilder *builder);
+
+/*!
+ * Appends atom to a structure builder.
+ *
+ * This is the \p LLKA_StructureBuilder counterpart of \p LLKA_appendAtomFromParams().
+ * Parameters have the same meaning as in \p LLKA_appendAtomFromParams().
+ *
+ * @param[in,out] builder LLKA_StructureBuilder to append the atom to.
+ */
+LLKA_API void LLKA_CC LLKA_appendAtomFromParamsToBuilder(
+    uint32_t id,
+    const char *type_symbol,
+    const char *label_atom_id,
+    const char *label_entity_id,
+    const char *label_comp_id,
+    const char *label_asym_id,
+    const char *auth_atom_id,
+    const char *auth_comp_id,
+    const char *auth_asym_id,
+    int32_t label_seq_id,
+    char label_alt_id,
+    int32_t auth_seq_id,
+    const char *pdbx_PDB_ins_code,
+    int32_t pdbx_PDB_model_num,
+    const LLKA_Point *coords,
+    LLKA_StructureBuilder *builder
+);
+
+/*!
+ * Appends all atoms of one structure to another.
+ *
+ * Atoms of \p appendend are deep-copied.
+ *
+ * @param[in] appendend LLKA_Structure whose atoms are appended.
+ * @param[in,out] appendee LLKA_Structure to append the atoms to.
+ */
 LLKA_API void LLKA_CC LLKA_appendStructure(const LLKA_Structure *appendend, LLKA_Structure *appendee);
 
+/*!
+ * Appends all atoms of a structure to a structure builder.
+ *
+ * Atoms of \p appendend are deep-copied.
+ *
+ * @param[in] appendend LLKA_Structure whose atoms are appended.
+ * @param[in,out] builder LLKA_StructureBuilder to append the atoms to.
+ */
+LLKA_API void LLKA_CC LLKA_appendStructureToBuilder(const LLKA_Structure *appendend, LLKA_StructureBuilder *builder);
+
 /*!
  * Returns whether a residue is either purine or pyrimidine base
  *
@@ -180,6 +268,14 @@ LLKA_API void LLKA_CC LLKA_destroyAtom(const LLKA_Atom *atom);
  */
 LLKA_API void LLKA_CC LLKA_destroyStructure(const LLKA_Structure *stru);
 
+/*!
+ * Releases all resources claimed by \p LLKA_StructureBuilder, including the atoms appended so far.
+ * Use this function only to discard a builder that has not been finished.
+ *
+ * @param[in] builder \p LLKA_StructureBuilder to release.
+ */
+LLKA_API void LLKA_CC LLKA_destroyStructureBuilder(const LLKA_StructureBuilder *builder);
+
 /*!
  * Releases all resources claimed by \p LLKA_StructureView.
  * Note that viewer atoms are *not* owned by \p LLKA_StructureView
@@ -188,6 +284,14 @@ LLKA_API void LLKA_CC LLKA_destroyStructure(const LLKA_Structure *stru);
  */
 LLKA_API void LLKA_CC LLKA_destroyStructureView(const LLKA_StructureView *stru);
 
+/*!
+ * Releases all resources claimed by a set of \p LLKA_StructureView s.
+ * Note that viewed atoms are *not* owned by the views.
+ *
+ * @param[in] views The set of views to destroy
+ */
+LLKA_API void LLKA_CC LLKA_destroyStructureViews(const LLKA_StructureViews *views);
+
 /*!
  * Releases all resources claimed by a set of \p LLKA_Structure s, including the structures and atoms it is made of.
  * Note that this function can be safely used only on LLKA_Structures objects that were initialized by libLLKA.
@@ -268,6 +372,18 @@ LLKA_API const LLKA_Atom * LLKA_findAtomView(
     int32_t pdbx_PDB_model_num
 );
 
+/*!
+ * Turns the content of a structure builder into a \p LLKA_Structure.
+ *
+ * The atoms are handed over to the returned structure without copying. The builder is reset
+ * to an empty state and may be reused.
+ *
+ * @param[in,out] builder LLKA_StructureBuilder to finish.
+ *
+ * @return LLKA_Structure with all atoms appended to the builder.
+ */
+LLKA_API LLKA_Structure LLKA_CC LLKA_finishStructureBuilder(LLKA_StructureBuilder *builder);
+
 /*!
  * Initializes \p LLKA_Atom with the given attributes.
  *
@@ -310,6 +426,14 @@ LLKA_API void LLKA_CC LLKA_initAtom(
 
 LLKA_API void LLKA_CC LLKA_initStructure(const LLKA_Atom *atoms, size_t nAtoms, LLKA_Structure *stru);
 
+/*!
+ * Initializes an empty \p LLKA_StructureBuilder.
+ *
+ * @param[in] capacity Number of atoms to preallocate space for. May be zero.
+ * @param[out] builder The builder to initialize.
+ */
+LLKA_API void LLKA_CC LLKA_initStructureBuilder(size_t capacity, LLKA_StructureBuilder *builder);
+
 /*!
  * Creates \p LLKA_Atom with the given a attributes.
  *
@@ -382,6 +506,41 @@ LLKA_API LLKA_Structure LLKA_CC LLKA_makeStructureFromPtrs(const LLKA_Atom *cons
  */
 LLKA_API void LLKA_CC LLKA_removeAtomById(uint32_t id, LLKA_Structure *stru);
 
+/*!
+ * Removes all atoms whose ids are listed in \p ids from the structure.
+ *
+ * The structure is compacted in a single pass. Relative order of the remaining atoms is preserved.
+ * Use this function instead of repeated calls of \p LLKA_removeAtomById() when removing many atoms.
+ *
+ * @param[in] ids Array of ids of the atoms to be removed. Ids that are not present in the structure are ignored.
+ * @param[in] nIds Number of elements in the \p ids array.
+ * @param[in,out] stru Structure to remove the atoms from.
+ *
+ * @return Number of removed atoms
+ */
+LLKA_API size_t LLKA_CC LLKA_removeAtomsByIds(const uint32_t *ids, size_t nIds, LLKA_Structure *stru);
+
+/*!
+ * Removes all atoms that match a predicate from the structure.
+ *
+ * The structure is compacted in a single pass. Relative order of the remaining atoms is preserved.
+ *
+ * @param[in] predicate Predicate called for each atom in the structure. Atoms for which the predicate returns \p LLKA_TRUE are removed.
+ * @param[in] userData Arbitrary data passed to \p predicate. May be <tt>NULL</tt>.
+ * @param[in,out] stru Structure to remove the atoms from.
+ *
+ * @return Number of removed atoms
+ */
+LLKA_API size_t LLKA_CC LLKA_removeAtomsIf(LLKA_AtomPredicate predicate, void *userData, LLKA_Structure *stru);
+
+/*!
+ * Makes sure that the structure builder can hold at least \p capacity atoms without reallocating.
+ *
+ * @param[in] capacity Requested capacity. If the builder already has a bigger capacity, this function does nothing.
+ * @param[in,out] builder LLKA_StructureBuilder to reserve the space in.
+ */
+LLKA_API void LLKA_CC LLKA_reserveStructureBuilder(size_t capacity, LLKA_StructureBuilder *builder);
+
 /*!
  * Splits the structure into multiple substructures.
  * Each substructure will contain only atom with one alternate position ID.
@@ -394,6 +553,20 @@ LLKA_API void LLKA_CC LLKA_removeAtomById(uint32_t id, LLKA_Structure *stru);
  */
 LLKA_API LLKA_Structures LLKA_CC LLKA_splitByAltIds(const LLKA_Structure *stru, LLKA_AlternatePositions *alts);
 
+/*!
+ * Splits the structure into multiple views of the structure.
+ * Each view will contain only atoms with one alternate position ID and atoms with no alternate position.
+ *
+ * Unlike \p LLKA_splitByAltIds(), this function does not copy any atoms. The source structure must remain
+ * valid for as long as the returned views are used.
+ *
+ * @param[in] stru structure to split.
+ * @param[out] alts List of alternate position IDs found in the structure as an array of chars (not zero-terminated).
+ *                  The list is ordered in the same way as the returned views.
+ * @returns \p LLKA_StructureViews with the views of the source structure
+ */
+LLKA_API LLKA_StructureViews LLKA_CC LLKA_splitByAltIdsView(const LLKA_Structure *stru, LLKA_AlternatePositions *alts);
+
 /*!
  * Splits structure into a list of dinucleotide steps. A dinucleotide step contains two nucleotides that spatially
  * follow one another in the structure. If there are alternate positions, only atoms with matching alternate position IDs
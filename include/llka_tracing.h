@@ -5,9 +5,14 @@
 
 #include "llka_main.h"
 
+#define LLKA_TRACE_RECORD_MAX_VALUES 36
+#define LLKA_TRACE_RECORD_MAX_INDICES 4
+#define LLKA_TRACE_RECORD_LABEL_LENGTH 32
+
 typedef struct LLKA_TracepointInfo {
     int32_t TPID;               /*!< ID of the tracepoint */
     const char *description;    /*!< Description of what kind of information or event is logged by the tracepoint */
+    const char *recordLayout;   /*!< Description of the meaning of values, indices and label in \p LLKA_TraceRecord s logged by the tracepoint */
 } LLKA_TracepointInfo;
 LLKA_IS_POD(LLKA_TracepointInfo)
 
@@ -17,6 +22,28 @@ typedef struct LLKA_TracepointInfos {
 } LLKA_TracepointInfos;
 LLKA_IS_POD(LLKA_TracepointInfos)
 
+/*!
+ * Raw data logged by a tracepoint
+ */
+typedef struct LLKA_TraceRecord {
+    int32_t TPID;                                       /*!< ID of the tracepoint that logged the record */
+    uint64_t contextId;                                 /*!< Records logged during classification of one step share the same context ID. Zero if the record was logged outside of step classification. */
+    uint64_t stepIdx;                                   /*!< Index of the step being classified by \p LLKA_classifyStepsMultiple(). Zero otherwise. */
+    size_t nValues;                                     /*!< Number of valid items in \p values */
+    double values[LLKA_TRACE_RECORD_MAX_VALUES];        /*!< Real values. Angles are in radians. */
+    size_t nIndices;                                    /*!< Number of valid items in \p indices */
+    int64_t indices[LLKA_TRACE_RECORD_MAX_INDICES];     /*!< Integral values such as indices or enum values */
+    char label[LLKA_TRACE_RECORD_LABEL_LENGTH];         /*!< NULL-terminated label such as a golden step name. Empty if not used. */
+    const char *text;                                   /*!< Free-form text for data that cannot be logged as values. \p NULL if not used. */
+} LLKA_TraceRecord;
+LLKA_IS_POD(LLKA_TraceRecord)
+
+typedef struct LLKA_TraceRecords {
+    LLKA_TraceRecord *records;    /*!< Array of \p LLKA_TraceRecord s */
+    size_t nRecords;              /*!< Length of the array */
+} LLKA_TraceRecords;
+LLKA_IS_POD(LLKA_TraceRecords)
+
 LLKA_BEGIN_API_FUNCTIONS
 
 /*!
@@ -33,6 +60,13 @@ LLKA_API void LLKA_CC LLKA_destroyTrace(const char *trace);
  */
 LLKA_API void LLKA_CC LLKA_destroyTracepointInfo(LLKA_TracepointInfos *infos);
 
+/*!
+ * Destroys LLKA_TraceRecords
+ *
+ * @param[in] records LLKA_TraceRecords object to destroy
+ */
+LLKA_API void LLKA_CC LLKA_destroyTraceRecords(LLKA_TraceRecords *records);
+
 /*!
  * Sets all tracepoints to the given state.
  *
@@ -51,12 +85,26 @@ LLKA_API void LLKA_CC LLKA_toggleTracepoint(int32_t TPID, LLKA_Bool state);
 /*!
  * Returns the complete trace.
  *
+ * Every thread logs into its own buffer. The buffers are merged when the trace is retrieved.
+ * Records logged during classification of one step are kept together, records logged
+ * outside of step classification are ordered as they were logged.
+ * Tracepoints log only raw data, the data is formatted as text by this function.
+ *
  * @param[in] dontClear If \p true the trace log will not be cleared.
  *
  * @return String containing the whole trace.
  */
 LLKA_API const char * LLKA_CC LLKA_trace(LLKA_Bool dontClear);
 
+/*!
+ * Returns all trace records as raw data. Records are ordered the same way as in \p LLKA_trace().
+ *
+ * @param[in] dontClear If \p true the trace log will not be cleared.
+ *
+ * @return Array of trace records. Use \p LLKA_TracepointInfo to find out the meaning of the data in records of each tracepoint.
+ */
+LLKA_API LLKA_TraceRecords LLKA_CC LLKA_traceRecords(LLKA_Bool dontClear);
+
 /*!
  * Returns information about available tracepoints.
  *
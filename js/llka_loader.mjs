@@ -0,0 +1,33 @@
+// Loads the multithreaded ES6 build of libLLKA (libLLKA_threads.js) if the environment
+// supports it and falls back to the single-threaded build (libLLKA.js) otherwise.
+//
+// Workers of the multithreaded build share the memory of the module through SharedArrayBuffer.
+// Browsers provide SharedArrayBuffer only to cross-origin isolated pages, that is pages served with
+//   Cross-Origin-Opener-Policy: same-origin
+//   Cross-Origin-Embedder-Policy: require-corp
+//
+// Usage:
+//   import loadLLKA from './llka_loader.mjs';
+//   const LLKA = await loadLLKA();
+
+export function threadsAvailable() {
+    if (typeof SharedArrayBuffer === 'undefined' || typeof Worker === 'undefined')
+        return false;
+
+    // crossOriginIsolated is not defined outside of browsers
+    return typeof crossOriginIsolated === 'undefined' ? true : crossOriginIsolated;
+}
+
+export default async function loadLLKA(moduleArgs = {}) {
+    if (threadsAvailable()) {
+        try {
+            const { default: factory } = await import('./libLLKA_threads.js');
+            return await factory(moduleArgs);
+        } catch (e) {
+            console.warn('Multithreaded libLLKA could not be loaded, using the single-threaded build', e);
+        }
+    }
+
+    const { default: factory } = await import('./libLLKA.js');
+    return factory(moduleArgs);
+}
@@ -0,0 +1,306 @@
+/* vim: set sw=4 ts=4 sts=4 expandtab : */
+
+#include <llka_cpp.h>
+#include <llka_util.h>
+
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+#include <pybind11/stl/filesystem.h>
+
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace py = pybind11;
+
+// Integer columns are exposed as int32 arrays directly over the C structs
+static_assert(sizeof(LLKA_NtC) == sizeof(int32_t));
+static_assert(sizeof(LLKA_CANA) == sizeof(int32_t));
+static_assert(sizeof(LLKA_RetCode) == sizeof(int32_t));
+// Step metrics are exposed as a two-dimensional array
+static_assert(sizeof(LLKA_StepMetrics) == 12 * sizeof(double));
+static_assert(sizeof(LLKA_Point) == 3 * sizeof(double));
+
+class LLKAError : public std::runtime_error {
+public:
+    using std::runtime_error::runtime_error;
+};
+
+/*
+ * Steps and classified steps carry the identity of each step so that the per-step
+ * arrays can be joined back to residues. Classified steps share the identity of the
+ * steps they were classified from.
+ */
+using SharedIdentity = std::shared_ptr<const LLKA::StepIdentityColumns>;
+
+struct Steps {
+    LLKA::StructuresHandle handle;
+    SharedIdentity identity;
+};
+
+struct ClassifiedSteps {
+    LLKA::ClassifiedStepsHandle handle;
+    SharedIdentity identity;
+};
+
+[[noreturn]] static
+auto raise(LLKA_RetCode tRet, const std::string &what) -> void
+{
+    throw LLKAError{what + ": " + LLKA::errorToString(tRet)};
+}
+
+template <typename S>
+static
+auto unwrap(LLKA::RCResult<S> &&res, const std::string &what) -> S
+{
+    if (!res.isSuccess())
+        raise(res.failure(), what);
+    return std::move(res.success());
+}
+
+static
+auto unwrap(LLKA::ImportedStructureHandleResult &&res) -> LLKA::ImportedStructureHandle
+{
+    if (!res.isSuccess()) {
+        const auto &err = res.failure();
+        throw LLKAError{"Cannot import Cif: " + LLKA::errorToString(err.tRet) + (err.error.empty() ? "" : ", " + err.error)};
+    }
+    return res.success();
+}
+
+/*
+ * Creates a read-only NumPy array over the data of a C struct array. The array keeps
+ * the owner alive so the data remains valid for as long as the array is referenced.
+ */
+template <typename T>
+static
+auto view(const void *first, const std::vector<py::ssize_t> &shape, const std::vector<py::ssize_t> &strides, py::handle owner) -> py::array
+{
+    py::array arr{py::dtype::of<T>(), shape, strides, first, owner};
+    arr.attr("setflags")(py::arg("write") = false);
+
+    return arr;
+}
+
+template <typename T, typename Elem>
+static
+auto column(std::span<const Elem> elems, size_t offset, py::handle owner) -> py::array
+{
+    const auto first = reinterpret_cast<const char *>(elems.data()) + offset;
+    return view<T>(first, { py::ssize_t(elems.size()) }, { py::ssize_t(sizeof(Elem)) }, owner);
+}
+
+#define ATOM_COLUMN(T, field) \
+    [](py::object self) { return column<T>(self.cast<const LLKA::ImportedStructureHandle &>().atoms(), offsetof(LLKA_Atom, field), self); }
+
+#define STEP_COLUMN(T, field) \
+    [](py::object self) { return column<T>(self.cast<const ClassifiedSteps &>().handle.steps(), offsetof(LLKA_AttemptedClassifiedStep, field), self); }
+
+#define UNDEFINED_IF_FAILED " Values of steps whose status is not zero are undefined."
+
+/*
+ * Adds the step identity attributes to both Steps and ClassifiedSteps. Numeric identities
+ * are arrays that view the identity columns, textual identities are lists of strings.
+ */
+template <typename S>
+static
+auto defineIdentity(py::class_<S> &cls) -> void
+{
+    auto intColumn = [&cls](const char *name, std::vector<int32_t> LLKA::StepIdentityColumns::*member, const char *doc) {
+        cls.def_property_readonly(
+            name,
+            [member](py::object self) {
+                const auto &values = (*self.cast<const S &>().identity).*member;
+                return column<int32_t>(std::span<const int32_t>{values}, 0, self);
+            },
+            doc
+        );
+    };
+    auto strColumn = [&cls](const char *name, std::vector<std::string> LLKA::StepIdentityColumns::*member, const char *doc) {
+        cls.def_property_readonly(name, [member](const S &self) { return (*self.identity).*member; }, doc);
+    };
+
+    intColumn("model_numbers", &LLKA::StepIdentityColumns::modelNumbers, "Model numbers of the steps");
+    strColumn("label_asym_ids", &LLKA::StepIdentityColumns::labelAsymIds, "label_asym_ids of the steps");
+    strColumn("auth_asym_ids", &LLKA::StepIdentityColumns::authAsymIds, "auth_asym_ids of the steps");
+    intColumn("label_seq_ids_first", &LLKA::StepIdentityColumns::labelSeqIdsFirst, "label_seq_ids of the first residues");
+    intColumn("label_seq_ids_second", &LLKA::StepIdentityColumns::labelSeqIdsSecond, "label_seq_ids of the second residues");
+    intColumn("auth_seq_ids_first", &LLKA::StepIdentityColumns::authSeqIdsFirst, "auth_seq_ids of the first residues");
+    intColumn("auth_seq_ids_second", &LLKA::StepIdentityColumns::authSeqIdsSecond, "auth_seq_ids of the second residues");
+    strColumn("comp_ids_first", &LLKA::StepIdentityColumns::compIdsFirst, "label_comp_ids of the first residues");
+    strColumn("comp_ids_second", &LLKA::StepIdentityColumns::compIdsSecond, "label_comp_ids of the second residues");
+    strColumn("alt_ids_first", &LLKA::StepIdentityColumns::altIdsFirst, "Alternate position ids of the first residues, empty if there is none");
+    strColumn("alt_ids_second", &LLKA::StepIdentityColumns::altIdsSecond, "Alternate position ids of the second residues, empty if there is none");
+    strColumn("ins_codes_first", &LLKA::StepIdentityColumns::insCodesFirst, "Insertion codes of the first residues");
+    strColumn("ins_codes_second", &LLKA::StepIdentityColumns::insCodesSecond, "Insertion codes of the second residues");
+    strColumn("step_names", &LLKA::StepIdentityColumns::stepNames, "DNATCO names of the steps, such as 1bna_A_DC_1_DG_2");
+}
+
+/*
+ * LLKA_NtCToName() and LLKA_CANAToName() index the tables of names without checking the bounds.
+ */
+template <typename E, E Last, E Invalid, auto ToName>
+static
+auto enumName(int32_t value, const char *what) -> std::string
+{
+    if (value != int32_t(Invalid) && (value < 0 || value > int32_t(Last)))
+        throw py::value_error{std::to_string(value) + " is not a valid " + what};
+
+    return ToName(E(value));
+}
+
+static
+auto defaultClassificationLimits() -> LLKA_ClassificationLimits
+{
+    LLKA_ClassificationLimits limits;
+    limits.averageNeighborsTorsionCutoff = LLKA_deg2rad(28.0);
+    limits.nearestNeighborTorsionsCutoff = LLKA_deg2rad(28.0);
+    limits.totalDistanceCutoff = LLKA_deg2rad(60.0);
+    limits.pseudorotationCutoff = LLKA_deg2rad(72.0);
+    limits.minimumClusterVotes = 0.001111;
+    limits.minimumNearestNeighbors = 7;
+    limits.numberOfUsedNearestNeighbors = 11;
+
+    return limits;
+}
+
+PYBIND11_MODULE(llka, m)
+{
+    m.doc() = "Python bindings of libLLKA. Coordinates and classification results are NumPy arrays that view the memory of libLLKA.";
+
+    py::register_exception<LLKAError>(m, "LLKAError", PyExc_RuntimeError);
+
+    //
+    // Classification context
+    //
+
+    py::class_<LLKA_ClassificationLimits>(m, "ClassificationLimits")
+        .def(py::init(&defaultClassificationLimits), "Limits used by DNATCO")
+        .def_readwrite("average_neighbors_torsion_cutoff", &LLKA_ClassificationLimits::averageNeighborsTorsionCutoff)
+        .def_readwrite("nearest_neighbor_torsions_cutoff", &LLKA_ClassificationLimits::nearestNeighborTorsionsCutoff)
+        .def_readwrite("total_distance_cutoff", &LLKA_ClassificationLimits::totalDistanceCutoff)
+        .def_readwrite("pseudorotation_cutoff", &LLKA_ClassificationLimits::pseudorotationCutoff)
+        .def_readwrite("minimum_cluster_votes", &LLKA_ClassificationLimits::minimumClusterVotes)
+        .def_readwrite("minimum_nearest_neighbors", &LLKA_ClassificationLimits::minimumNearestNeighbors)
+        .def_readwrite("number_of_used_nearest_neighbors", &LLKA_ClassificationLimits::numberOfUsedNearestNeighbors);
+
+    py::class_<LLKA::ClassificationContext>(m, "ClassificationContext")
+        .def_static(
+            "from_directory",
+            [](const std::filesystem::path &path, const LLKA_ClassificationLimits &limits, double maxCloseEnoughRmsd) {
+                py::gil_scoped_release release;
+                return unwrap(LLKA::initializeClassificationContextFromDirectory(path, limits, maxCloseEnoughRmsd), "Cannot initialize classification context");
+            },
+            py::arg("path"), py::arg("limits") = defaultClassificationLimits(), py::arg("max_close_enough_rmsd") = 0.5,
+            "Initializes the context from the CSV files with the classification parameters in the given directory"
+        );
+
+    //
+    // Structures
+    //
+
+    py::class_<LLKA::ImportedStructureHandle>(m, "Structure")
+        .def_property_readonly("id", [](const LLKA::ImportedStructureHandle &self) { return std::string{self.id()}; })
+        .def("__len__", [](const LLKA::ImportedStructureHandle &self) { return self.atoms().size(); })
+        .def_property_readonly(
+            "coords",
+            [](py::object self) {
+                const auto atoms = self.cast<const LLKA::ImportedStructureHandle &>().atoms();
+                const auto first = reinterpret_cast<const char *>(atoms.data()) + offsetof(LLKA_Atom, coords);
+                return view<double>(first, { py::ssize_t(atoms.size()), 3 }, { py::ssize_t(sizeof(LLKA_Atom)), py::ssize_t(sizeof(double)) }, self);
+            },
+            "Coordinates of the atoms as an (n_atoms, 3) array"
+        )
+        .def_property_readonly("ids", ATOM_COLUMN(uint32_t, id))
+        .def_property_readonly("label_seq_ids", ATOM_COLUMN(int32_t, label_seq_id))
+        .def_property_readonly("auth_seq_ids", ATOM_COLUMN(int32_t, auth_seq_id))
+        .def_property_readonly("model_numbers", ATOM_COLUMN(int32_t, pdbx_PDB_model_num));
+
+    py::class_<Steps> steps(m, "Steps");
+    steps.def("__len__", [](const Steps &self) { return self.handle.size(); });
+    defineIdentity(steps);
+
+    py::class_<ClassifiedSteps> classifiedSteps(m, "ClassifiedSteps");
+    classifiedSteps
+        .def("__len__", [](const ClassifiedSteps &self) { return self.handle.steps().size(); })
+        .def_property_readonly("statuses", STEP_COLUMN(int32_t, status), "Return codes of the classification of the steps")
+        .def_property_readonly("assigned_ntcs", STEP_COLUMN(int32_t, step.assignedNtC), "NtCs of the assigned clusters." UNDEFINED_IF_FAILED)
+        .def_property_readonly("assigned_canas", STEP_COLUMN(int32_t, step.assignedCANA), "CANAs of the assigned clusters." UNDEFINED_IF_FAILED)
+        .def_property_readonly("closest_ntcs", STEP_COLUMN(int32_t, step.closestNtC), "NtCs of the closest golden steps." UNDEFINED_IF_FAILED)
+        .def_property_readonly("closest_canas", STEP_COLUMN(int32_t, step.closestCANA), "CANAs of the closest golden steps." UNDEFINED_IF_FAILED)
+        .def_property_readonly("violations", STEP_COLUMN(int32_t, step.violations), "Bitfields of classification violations." UNDEFINED_IF_FAILED)
+        .def_property_readonly("confal_scores", STEP_COLUMN(double, step.confalScore.total), "Total confal scores." UNDEFINED_IF_FAILED)
+        .def_property_readonly("rmsds_to_closest_ntc", STEP_COLUMN(double, step.rmsdToClosestNtC), "RMSDs to the closest NtC representatives." UNDEFINED_IF_FAILED)
+        .def_property_readonly(
+            "metrics",
+            [](py::object self) {
+                const auto steps = self.cast<const ClassifiedSteps &>().handle.steps();
+                const auto first = reinterpret_cast<const char *>(steps.data()) + offsetof(LLKA_AttemptedClassifiedStep, step.metrics);
+                return view<double>(first, { py::ssize_t(steps.size()), 12 }, { py::ssize_t(sizeof(LLKA_AttemptedClassifiedStep)), py::ssize_t(sizeof(double)) }, self);
+            },
+            "Step metrics as an (n_steps, 12) array. Columns are ordered as the fields of LLKA_StepMetrics." UNDEFINED_IF_FAILED
+        );
+    defineIdentity(classifiedSteps);
+
+    //
+    // Processing
+    //
+
+    m.def(
+        "load_cif",
+        [](const std::filesystem::path &path) {
+            py::gil_scoped_release release;
+            return unwrap(LLKA::cifToStructureHandle(path));
+        },
+        py::arg("path")
+    );
+    m.def(
+        "load_cif_text",
+        [](const std::string &text) {
+            py::gil_scoped_release release;
+            return unwrap(LLKA::cifToStructureHandle(text));
+        },
+        py::arg("text")
+    );
+    m.def(
+        "split_to_steps",
+        [](const LLKA::ImportedStructureHandle &stru) {
+            py::gil_scoped_release release;
+            auto handle = unwrap(LLKA::splitStructureToDinucleotideSteps(stru.structure()), "Cannot split structure to steps");
+            auto identity = std::make_shared<const LLKA::StepIdentityColumns>(handle.get(), std::string{stru.id()});
+
+            return Steps{ std::move(handle), std::move(identity) };
+        },
+        py::arg("structure")
+    );
+    // Names of the closest golden steps point into the context, the steps must keep it alive
+    m.def(
+        "classify",
+        [](const Steps &steps, const LLKA::ClassificationContext &ctx) {
+            py::gil_scoped_release release;
+            return ClassifiedSteps{ unwrap(LLKA::classifySteps(steps.handle, ctx), "Cannot classify steps"), steps.identity };
+        },
+        py::arg("steps"), py::arg("context"),
+        py::keep_alive<0, 2>()
+    );
+
+    m.def(
+        "ntc_name",
+        [](int32_t ntc) { return enumName<LLKA_NtC, LLKA_LAST_NTC, LLKA_INVALID_NTC, LLKA_NtCToName>(ntc, "NtC"); },
+        py::arg("ntc"),
+        "Name of the NtC. Raises ValueError if the value is not an NtC"
+    );
+    m.def(
+        "cana_name",
+        [](int32_t cana) { return enumName<LLKA_CANA, LLKA_LAST_CANA, LLKA_INVALID_CANA, LLKA_CANAToName>(cana, "CANA"); },
+        py::arg("cana"),
+        "Name of the CANA. Raises ValueError if the value is not a CANA"
+    );
+
+    m.attr("INVALID_NTC") = int32_t(LLKA_INVALID_NTC);
+    m.attr("INVALID_CANA") = int32_t(LLKA_INVALID_CANA);
+}
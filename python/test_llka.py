@@ -0,0 +1,82 @@
+#! /usr/bin/env python3
+
+# Usage: test_llka.py ASSETS_DIR
+
+import os
+import sys
+from concurrent.futures import ThreadPoolExecutor
+
+import numpy as np
+
+import llka
+
+
+def expect(cond, msg):
+    if not cond:
+        print(f'Test failed: {msg}', file=sys.stderr)
+        sys.exit(1)
+
+
+def main():
+    assets = sys.argv[1]
+
+    ctx = llka.ClassificationContext.from_directory(assets)
+
+    stru = llka.load_cif(os.path.join(assets, 'test_cifs', '1BNA.cif'))
+    expect(stru.id == '1BNA', 'wrong entry id')
+    expect(len(stru) == 566, 'wrong number of atoms')
+    expect(stru.coords.shape == (566, 3), 'wrong shape of coordinates')
+    expect(stru.label_seq_ids[165] == 9, 'unexpected label_seq_id')
+    expect(not stru.coords.flags.writeable, 'coordinates are writeable')
+
+    # Arrays view the memory of the structure and keep it alive
+    coords = stru.coords
+    first = coords[0].copy()
+    del stru
+    expect(np.array_equal(coords[0], first), 'coordinates changed after the structure was released')
+
+    with open(os.path.join(assets, 'test_cifs', '1BNA.cif')) as fh:
+        stru = llka.load_cif_text(fh.read())
+    expect(np.array_equal(stru.coords[0], first), 'structures loaded from file and text differ')
+
+    steps = llka.split_to_steps(stru)
+    classified = llka.classify(steps, ctx)
+    expect(len(classified) == len(steps), 'wrong number of classified steps')
+    expect(classified.metrics.shape == (len(steps), 12), 'wrong shape of metrics')
+
+    # Identity of the steps joins the arrays back to residues
+    expect(steps.step_names[0] == '1bna_A_DC_1_DG_2', 'wrong step name')
+    expect(classified.step_names == steps.step_names, 'classified steps lost the step names')
+    expect(classified.label_seq_ids_first.shape == (len(steps),), 'wrong shape of label_seq_ids')
+    expect(classified.label_seq_ids_first[0] == 1 and classified.label_seq_ids_second[0] == 2, 'wrong label_seq_ids')
+    expect(classified.auth_asym_ids[0] == 'A' and classified.auth_asym_ids[-1] == 'B', 'wrong chain ids')
+    expect(classified.comp_ids_first[0] == 'DC' and classified.alt_ids_first[0] == '', 'wrong residue identity')
+
+    ok = classified.statuses == 0
+    expect(ok.any(), 'no step was classified')
+    expect(np.all(classified.confal_scores[ok] >= 0.0), 'invalid confal scores')
+    expect(llka.ntc_name(int(classified.closest_ntcs[0])) != '', 'empty NtC name')
+    expect(llka.ntc_name(llka.INVALID_NTC) == 'NANT', 'wrong name of invalid NtC')
+    expect(llka.cana_name(llka.INVALID_CANA) == 'NAN', 'wrong name of invalid CANA')
+    for func, value in ((llka.ntc_name, -1), (llka.ntc_name, 100000), (llka.cana_name, 100000)):
+        try:
+            func(value)
+            expect(False, f'{func.__name__} accepted {value}')
+        except ValueError:
+            pass
+
+    # Classification releases the GIL so that it can run on multiple threads
+    with ThreadPoolExecutor(max_workers=4) as pool:
+        results = list(pool.map(lambda _: llka.classify(steps, ctx), range(8)))
+    for res in results:
+        expect(np.array_equal(res.assigned_ntcs, classified.assigned_ntcs), 'concurrent classification differs')
+
+    try:
+        llka.load_cif(os.path.join(assets, 'test_cifs', '1BNA_broken.cif'))
+        expect(False, 'broken Cif was loaded')
+    except llka.LLKAError:
+        pass
+
+
+if __name__ == '__main__':
+    main()
@@ -8,60 +8,42 @@
 #include "util/arch.hpp"
 #include "util/elementaries.h"
 #include "util/geometry.h"
+#include "util/parallel.hpp"
 #include "util/printers.hpp"
 
 
 #include "tracing/llka_tracer.h"
 
 
+#include <algorithm>
 #include <array>
 #include <cassert>
 #include <map>
 #include <memory>
 #include <ranges>
+#include <span>
 #include <string>
 #include <tuple>
 #include <vector>
 
 
+#include "classification_context.hpp"
 #include "nucleotide.hpp"
 #include "ntc.hpp"
-#include "ntc_references.h"
+#include "ntc_constants.h"
+#include "profiling.hpp"
 #include "similarity.h"
+#include "superposition.hpp"
 
 
 #define CLASSIFICATION_VIOLATION_STR(x) case x: return #x
 
-struct LLKA_ClassificationContext {
-    // TODO: This is a very interim solution.
-    // This will be reworked once we get on with SIMD
-
-    ~LLKA_ClassificationContext()
-    {
-        for (auto &gs : goldenSteps)
-            LLKAInternal::destroyString(gs.name);
-
-        for (auto &p : ntcExtendedBackbonePoints)
-            delete [] p.points;
-    }
-
-    std::vector<LLKA_GoldenStep> goldenSteps{};
-    std::vector<LLKA_ClassificationCluster> clusters{};
-    std::vector<LLKA_Confal> confals{};
-    std::vector<double> confalPercentiles{};
-    LLKA_ClassificationLimits limits;
-
-    double maxCloseEnoughRmsd;
-
-    std::array<LLKA_Points, 96> ntcExtendedBackbonePoints{};
-};
-
 namespace LLKAInternal {
 
 inline constinit double MINIMUM_ALLOWED_DELTA = D2R(55.0);
 inline constinit double MAXIMUM_ALLOWED_DELTA = D2R(185.0);
 
-inline LLKA_SAD_CONSTINIT std::array<double LLKA_StepMetrics::*, 9> ALL_TORSIONS_STEP_METRIC_CLSPTRS{
+inline LLKA_SAD_CONSTINIT std::array<double LLKA_StepMetrics::*, NUM_CLASSIFICATION_TORSIONS> ALL_TORSIONS_STEP_METRIC_CLSPTRS{
     &LLKA_StepMetrics::delta_1, &LLKA_StepMetrics::epsilon_1, &LLKA_StepMetrics::zeta_1, &LLKA_StepMetrics::alpha_2, &LLKA_StepMetrics::beta_2,
     &LLKA_StepMetrics::gamma_2, &LLKA_StepMetrics::delta_2, &LLKA_StepMetrics::chi_1, &LLKA_StepMetrics::chi_2
 };
@@ -69,17 +51,28 @@ inline LLKA_SAD_CONSTINIT std::array<LLKA_ClassificationMetric LLKA_Classificati
     &LLKA_ClassificationCluster::delta_1, &LLKA_ClassificationCluster::epsilon_1, &LLKA_ClassificationCluster::zeta_1, &LLKA_ClassificationCluster::alpha_2, &LLKA_ClassificationCluster::beta_2,
     &LLKA_ClassificationCluster::gamma_2, &LLKA_ClassificationCluster::delta_2, &LLKA_ClassificationCluster::chi_1, &LLKA_ClassificationCluster::chi_2
 };
-inline LLKA_SAD_CONSTINIT std::array<double LLKA_Confal::*, 9> ALL_TORSIONS_CONFAL_CLSPTRS{
+// Metrics that make up the confal score. All but CC and NN are angles.
+inline LLKA_SAD_CONSTINIT std::array<double LLKA_StepMetrics::*, NUM_CONFAL_METRICS> CONFAL_STEP_METRIC_CLSPTRS{
+    &LLKA_StepMetrics::delta_1, &LLKA_StepMetrics::epsilon_1, &LLKA_StepMetrics::zeta_1, &LLKA_StepMetrics::alpha_2, &LLKA_StepMetrics::beta_2,
+    &LLKA_StepMetrics::gamma_2, &LLKA_StepMetrics::delta_2, &LLKA_StepMetrics::chi_1, &LLKA_StepMetrics::chi_2,
+    &LLKA_StepMetrics::CC, &LLKA_StepMetrics::NN, &LLKA_StepMetrics::mu
+};
+inline LLKA_SAD_CONSTINIT std::array<double LLKA_Confal::*, NUM_CONFAL_METRICS> CONFAL_CLSPTRS{
     &LLKA_Confal::delta_1, &LLKA_Confal::epsilon_1, &LLKA_Confal::zeta_1, &LLKA_Confal::alpha_2, &LLKA_Confal::beta_2,
-    &LLKA_Confal::gamma_2, &LLKA_Confal::delta_2, &LLKA_Confal::chi_1, &LLKA_Confal::chi_2
+    &LLKA_Confal::gamma_2, &LLKA_Confal::delta_2, &LLKA_Confal::chi_1, &LLKA_Confal::chi_2,
+    &LLKA_Confal::CC, &LLKA_Confal::NN, &LLKA_Confal::mu
 };
-inline LLKA_SAD_CONSTINIT std::array<double LLKA_ConfalScore::*, 9> ALL_TORSIONS_CONFAL_SCORE_CLSPTRS{
+inline LLKA_SAD_CONSTINIT std::array<double LLKA_ConfalScore::*, NUM_CONFAL_METRICS> CONFAL_SCORE_CLSPTRS{
     &LLKA_ConfalScore::delta_1, &LLKA_ConfalScore::epsilon_1, &LLKA_ConfalScore::zeta_1, &LLKA_ConfalScore::alpha_2, &LLKA_ConfalScore::beta_2,
-    &LLKA_ConfalScore::gamma_2, &LLKA_ConfalScore::delta_2, &LLKA_ConfalScore::chi_1, &LLKA_ConfalScore::chi_2
+    &LLKA_ConfalScore::gamma_2, &LLKA_ConfalScore::delta_2, &LLKA_ConfalScore::chi_1, &LLKA_ConfalScore::chi_2,
+    &LLKA_ConfalScore::CC, &LLKA_ConfalScore::NN, &LLKA_ConfalScore::mu
+};
+inline constexpr std::array<bool, NUM_CONFAL_METRICS> CONFAL_METRIC_IS_ANGLE{
+    true, true, true, true, true, true, true, true, true, false, false, true
 };
 static_assert(ALL_TORSIONS_STEP_METRIC_CLSPTRS.size() == ALL_TORSIONS_CLASSIFICATION_METRIC_CLSPTRS.size());
-static_assert(ALL_TORSIONS_STEP_METRIC_CLSPTRS.size() == ALL_TORSIONS_CONFAL_CLSPTRS.size());
-static_assert(ALL_TORSIONS_STEP_METRIC_CLSPTRS.size() == ALL_TORSIONS_CONFAL_SCORE_CLSPTRS.size());
+static_assert(CONFAL_STEP_METRIC_CLSPTRS.size() == CONFAL_CLSPTRS.size());
+static_assert(CONFAL_STEP_METRIC_CLSPTRS.size() == CONFAL_SCORE_CLSPTRS.size());
 
 inline LLKA_SAD_CONSTINIT std::array<double LLKA_StepMetrics::*, 10> TORSION_STEP_METRIC_CLSPTRS{
     &LLKA_StepMetrics::delta_1, &LLKA_StepMetrics::epsilon_1, &LLKA_StepMetrics::zeta_1, &LLKA_StepMetrics::alpha_2, &LLKA_StepMetrics::beta_2,
@@ -96,64 +89,74 @@ static_assert(TORSION_STEP_METRIC_CLSPTRS.size() == TORSION_CLASSIFICATION_METRI
 inline LLKA_SAD_CONSTINIT std::array<LLKA_ClassificationMetric LLKA_NuAnglesMetrics::*, 5> NU_ANGLES_METRICS_CLSPTRS{
     &LLKA_NuAnglesMetrics::nu_0, &LLKA_NuAnglesMetrics::nu_1, &LLKA_NuAnglesMetrics::nu_2, &LLKA_NuAnglesMetrics::nu_3, &LLKA_NuAnglesMetrics::nu_4
 };
-inline LLKA_SAD_CONSTINIT std::array<double LLKA_NuAngles::*, 5> NU_ANGLES_CLSPTRS{
-    &LLKA_NuAngles::nu_0, &LLKA_NuAngles::nu_1, &LLKA_NuAngles::nu_2, &LLKA_NuAngles::nu_3, &LLKA_NuAngles::nu_4
-};
 static_assert(NU_ANGLES_METRICS_CLSPTRS.size() == NU_ANGLES_CLSPTRS.size());
 
 class NearestNeighbor {
 public:
     NearestNeighbor() :
-        euclideanDistance{-1},
+        euclideanDistanceSquared{-1},
         goldenStepIdx{Arch::INVALID_SIZE_T}
     {}
 
-    auto isValid() { return euclideanDistance >= 0.0 && goldenStepIdx != Arch::INVALID_SIZE_T; }
+    NearestNeighbor(double euclideanDistanceSquared, size_t goldenStepIdx) :
+        euclideanDistanceSquared{euclideanDistanceSquared},
+        goldenStepIdx{goldenStepIdx}
+    {}
+
+    // Ties are resolved in favor of the golden step that comes first
+    auto isNearerThan(const NearestNeighbor &other) const
+    {
+        return euclideanDistanceSquared < other.euclideanDistanceSquared ||
+               (euclideanDistanceSquared == other.euclideanDistanceSquared && goldenStepIdx < other.goldenStepIdx);
+    }
 
-    LLKA_StepMetrics metricsDifference;
-    double euclideanDistance;
+    double euclideanDistanceSquared;
     size_t goldenStepIdx;
 };
 
+// Smallest number of steps worth a thread of its own when multiple steps are classified
+inline constexpr size_t MIN_STEPS_PER_THREAD = 16;
+
+/*
+ * Scratch buffers needed to classify a step. Classification of multiple
+ * steps reuses one workspace per thread to avoid allocating the buffers for every step.
+ */
+class ClassificationWorkspace {
+public:
+    ClassificationWorkspace(const LLKA_ClassificationContext *ctx) :
+        nearestNeighbors{},
+        clusterVotes(ctx->clusters.size(), 0.0)
+    {
+        nearestNeighbors.reserve(ctx->limits.numberOfUsedNearestNeighbors);
+    }
+
+    std::vector<NearestNeighbor> nearestNeighbors; // Max-heap by distance while the neighbors are being searched for
+    std::vector<double> clusterVotes; // Indexed by clusterIdx, all zeros between classifications
+};
+
 using NearestNeighborsView = std::span<const LLKAInternal::NearestNeighbor, Arch::ArraySize::MAX>;
 
 static
-auto calcConfalScore(const LLKA_StepMetrics &differencesFromNtCAverages, const LLKA_Confal &confal, bool noViolations)
+auto calcConfalScore(const LLKA_StepMetrics &differencesFromNtCAverages, const ConfalCoefficients &coefficients, bool noViolations)
 {
-    constexpr auto calcScore = [](auto diff, auto confal) {
-        auto diffSq = diff * diff;
-        auto confalSq = confal * confal; // PERF: Precalculate in init
+    std::array<double, NUM_CONFAL_METRICS> exponents;
+    for (size_t idx = 0; idx < NUM_CONFAL_METRICS; idx++) {
+        const auto diff = differencesFromNtCAverages.*CONFAL_STEP_METRIC_CLSPTRS[idx];
+        exponents[idx] = diff * diff * coefficients[idx];
+    }
 
-        // PERF: Look into replacing division by multiplication
-        return 100.0 * std::exp(-diffSq / (2.0 * confalSq));
-    };
+    std::array<double, NUM_CONFAL_METRICS> scores;
+    expBatch(exponents.data(), NUM_CONFAL_METRICS, scores.data());
 
     double invTotal = 0;
     LLKA_ConfalScore score;
-
-    for (size_t idx = 0; idx < ALL_TORSIONS_STEP_METRIC_CLSPTRS.size(); idx++) {
-        auto metricClsPtr = ALL_TORSIONS_STEP_METRIC_CLSPTRS[idx];
-        auto confalClsPtr = ALL_TORSIONS_CONFAL_CLSPTRS[idx];
-        auto confalScoreClsPtr = ALL_TORSIONS_CONFAL_SCORE_CLSPTRS[idx];
-
-
-        auto s = calcScore(R2D(differencesFromNtCAverages.*metricClsPtr), confal.*confalClsPtr);
+    for (size_t idx = 0; idx < NUM_CONFAL_METRICS; idx++) {
+        const auto s = 100.0 * scores[idx];
         invTotal += 1.0 / s;
 
-        score.*confalScoreClsPtr = s;
+        score.*CONFAL_SCORE_CLSPTRS[idx] = s;
     }
 
-    auto calcAndAccum = [&invTotal, &calcScore](auto diff, auto confal) {
-        auto s = calcScore(diff, confal);
-        invTotal += 1.0 / s;
-
-        return s;
-    };
-
-    score.CC = calcAndAccum(differencesFromNtCAverages.CC, confal.CC);
-    score.NN = calcAndAccum(differencesFromNtCAverages.NN, confal.NN);
-    score.mu = calcAndAccum(R2D(differencesFromNtCAverages.mu), confal.mu);
-
     score.total = ((12.0 / invTotal) + 0.5) * decltype(score.total)(noViolations);
 
     return score;
@@ -187,36 +190,32 @@ auto calcDistancesFromNtCAverages(const LLKA_StepMetrics &stepMetrics, const LLK
 }
 
 static
-auto calcRmsdToClosestNtC(const LLKA_Structure *stru, const LLKA_Points &ntcExtBkbnPts)
+auto calcRmsdToClosestNtC(const LLKA_Structure *stru, const NtCReferenceBackbone &ntcExtBkbn)
 {
-    // We expect that no structure will ever have extended backbone more that 50 atoms large
-    LLKA_Point scratchArray[50];
-    LLKA_Points scratchPts {
-        { scratchArray },
-        50
-    };
+    LLKA_StructureView extBkbn{};
 
-    LLKA_Structure extBkbn{};
+    auto tRet = LLKA_extractExtendedBackboneView(stru, &extBkbn);
+    assert(tRet == LLKA_OK);
+    assert(extBkbn.nAtoms == ntcExtBkbn.points.size());
 
     // PERF: This code right here indicates that we should split atoms and coordinates
     // to two arrays
-    LLKA_extractExtendedBackbone(stru, &extBkbn);
-    for (size_t idx = 0; idx < extBkbn.nAtoms; idx++)
-        scratchPts.points[idx] = extBkbn.atoms[idx].coords;
+    std::array<LLKA_Point, LLKABones::NUM_EXTENDED_ATOMS> pts;
+    for (size_t idx = 0; idx < pts.size(); idx++)
+        pts[idx] = extBkbn.atoms[idx]->coords;
 
-    LLKA_Points pts;
-    pts.raw = scratchPts.raw;
-    pts.nPoints = extBkbn.nAtoms;
+    LLKA_destroyStructureView(&extBkbn);
+
+    ConstMappedPointsUnaligned mPts(&pts[0].x, 3, pts.size());
+    ConstMappedPointsUnaligned mRef(&ntcExtBkbn.points[0].x, 3, ntcExtBkbn.points.size());
 
     double rmsd = 0;
-    auto tRet = LLKA_superposePoints(&pts, &ntcExtBkbnPts, &rmsd);
+    tRet = superposedRmsdOntoCentered(mPts, mRef, &rmsd);
     assert(tRet == LLKA_OK);
 #ifdef NDEBUG
     (void)tRet;
 #endif // NDEBUG
 
-    LLKA_destroyStructure(&extBkbn);
-
     return rmsd;
 }
 
@@ -232,54 +231,51 @@ auto checkNtCTolerances(
 {
     assert(nearestNeighbors.size() > 0);
 
-    // PERF: This will really benefit of SIMD once we get around to doing it
-
-    LLKA_StepMetrics sumsOfSinesOfTorsions = {};
-    LLKA_StepMetrics sumsOfCosinesOfTorsions = {};
-    LLKA_StepMetrics averageNeighborTorsions = {};
+    constexpr size_t N = NUM_CLASSIFICATION_TORSIONS;
+    static_assert(N == ALL_TORSIONS_STEP_METRIC_CLSPTRS.size());
 
     int32_t violations = 0;
-    int16_t violatingTorsionsAverage = 0;
-    int16_t violatingTorsionsNearest = 0;
 
-    // We rely on this to be 9
-    assert(ALL_TORSIONS_STEP_METRIC_CLSPTRS.size() == 9);
+    std::array<double, N> torsions;
+    for (size_t idx = 0; idx < N; idx++)
+        torsions[idx] = stepMetrics.*ALL_TORSIONS_STEP_METRIC_CLSPTRS[idx];
 
+    // Circular means of the torsions of the nearest neighbors
+    std::array<double, N> sumsOfSines{};
+    std::array<double, N> sumsOfCosines{};
     for (const auto &neigh : nearestNeighbors) {
-        const auto &gs = ctx->goldenSteps[neigh.goldenStepIdx];
+        const auto &trig = ctx->goldenStepsTorsionsTrig[neigh.goldenStepIdx];
 
-        for (const auto &clsPtr : ALL_TORSIONS_STEP_METRIC_CLSPTRS) {
-            sumsOfSinesOfTorsions.*clsPtr += std::sin(angleAsFull(gs.metrics.*clsPtr));
-            sumsOfCosinesOfTorsions.*clsPtr += std::cos(angleAsFull(gs.metrics.*clsPtr));
+        for (size_t idx = 0; idx < N; idx++) {
+            sumsOfSines[idx] += trig.sines[idx];
+            sumsOfCosines[idx] += trig.cosines[idx];
         }
     }
 
-    for (const auto &clsPtr : ALL_TORSIONS_STEP_METRIC_CLSPTRS) {
-        auto ang = angleAsFull(std::atan2(sumsOfSinesOfTorsions.*clsPtr, sumsOfCosinesOfTorsions.*clsPtr));
-        averageNeighborTorsions.*clsPtr = ang;
-    }
-
-    for (size_t idx = 0; idx < ALL_TORSIONS_STEP_METRIC_CLSPTRS.size(); idx++) {
-        auto clsPtr = ALL_TORSIONS_STEP_METRIC_CLSPTRS[idx];
-        auto angDiff = angleDifference(stepMetrics.*clsPtr, averageNeighborTorsions.*clsPtr);
-        if (std::abs(angDiff) > ctx->limits.averageNeighborsTorsionCutoff) {
-            violations |= LLKA_CLASSIFICATION_E_AVERAGE_NEAREST_NEIGHBORS_TORSIONS_TOO_DIFFERENT;
-            // This relies in BACKBONE_TORSIONS_STEP_METRIC_CLSPTRS and the errors enum to be in the same order
-            violatingTorsionsAverage |= (1 << idx);
-        }
+    std::array<double, N> diffsAverage;
+    for (size_t idx = 0; idx < N; idx++) {
+        const auto average = angleAsFull(std::atan2(sumsOfSines[idx], sumsOfCosines[idx]));
+        diffsAverage[idx] = std::abs(angleDifference(torsions[idx], average));
     }
 
     const auto &bestieGoldenStep = ctx->goldenSteps[nearestNeighbors[0].goldenStepIdx];
-    for (size_t idx = 0; idx < ALL_TORSIONS_STEP_METRIC_CLSPTRS.size(); idx++) {
-        auto clsPtr = ALL_TORSIONS_STEP_METRIC_CLSPTRS[idx];
-        auto angDiff = angleDifference(stepMetrics.*clsPtr, bestieGoldenStep.metrics.*clsPtr);
-        if (std::abs(angDiff) > ctx->limits.nearestNeighborTorsionsCutoff) {
-            violations |= LLKA_CLASSIFICATION_E_NEAREST_NEIGHBOR_TORSIONS_TOO_DIFFERENT;
-            // This relies in BACKBONE_TORSIONS_STEP_METRIC_CLSPTRS and the errors enum to be in the same order
-            violatingTorsionsNearest |= (1 << idx);
-        }
+    std::array<double, N> diffsNearest;
+    for (size_t idx = 0; idx < N; idx++)
+        diffsNearest[idx] = std::abs(angleDifference(torsions[idx], bestieGoldenStep.metrics.*ALL_TORSIONS_STEP_METRIC_CLSPTRS[idx]));
+
+    // Bits of the violating torsions masks rely on ALL_TORSIONS_STEP_METRIC_CLSPTRS and the errors enum to be in the same order
+    int16_t violatingTorsionsAverage = 0;
+    int16_t violatingTorsionsNearest = 0;
+    for (size_t idx = 0; idx < N; idx++) {
+        violatingTorsionsAverage |= int16_t(diffsAverage[idx] > ctx->limits.averageNeighborsTorsionCutoff) << idx;
+        violatingTorsionsNearest |= int16_t(diffsNearest[idx] > ctx->limits.nearestNeighborTorsionsCutoff) << idx;
     }
 
+    if (violatingTorsionsAverage)
+        violations |= LLKA_CLASSIFICATION_E_AVERAGE_NEAREST_NEIGHBORS_TORSIONS_TOO_DIFFERENT;
+    if (violatingTorsionsNearest)
+        violations |= LLKA_CLASSIFICATION_E_NEAREST_NEIGHBOR_TORSIONS_TOO_DIFFERENT;
+
     if (violations)
         return { violations, violatingTorsionsAverage, violatingTorsionsNearest };
 
@@ -342,9 +338,11 @@ auto checkNtCTolerances(
 }
 
 static
-auto determineBestieClusterIdx(const NearestNeighborsView &nearestNeighbors, const LLKA_ClassificationContext *ctx) -> std::tuple<size_t, double>
+auto determineBestieClusterIdx(const NearestNeighborsView &nearestNeighbors, std::vector<double> &clusterVotes, const LLKA_ClassificationContext *ctx) -> std::tuple<size_t, double>
 {
-    std::map<size_t, double> clusterVotes{}; // Key is clusterIdx, value the number of votes for each cluster
+    // The reference implementation scores the neighbors by squared distances in degrees.
+    // Our distances are in radians so we just rescale them.
+    constexpr double RAD_SQ_TO_DEG_SQ = R2D(1.0) * R2D(1.0);
 
     if (nearestNeighbors.size() == 0)
         return { 0, -1 };
@@ -353,83 +351,52 @@ auto determineBestieClusterIdx(const NearestNeighborsView &nearestNeighbors, con
         assert(nn.goldenStepIdx != Arch::INVALID_SIZE_T);
 
         const auto clusterIdx = ctx->goldenSteps[nn.goldenStepIdx].clusterIdx;
+        clusterVotes[clusterIdx] += 1.0 / (RAD_SQ_TO_DEG_SQ * nn.euclideanDistanceSquared);
+    }
 
-        // PERF: This is calculated in degrees instead of radians to match the scoring
-        // behavior of the reference implementation
-        double totalDiff = 0;
-        for (const auto &clsPtr : ALL_TORSIONS_STEP_METRIC_CLSPTRS) {
-            auto angDiffDeg = R2D(nn.metricsDifference.*clsPtr);
-            totalDiff += angDiffDeg * angDiffDeg;
-        }
-        totalDiff += XR_DISTANCE_MULTIPLIER * XR_DISTANCE_MULTIPLIER * nn.metricsDifference.CC * nn.metricsDifference.CC;
-        totalDiff += XR_DISTANCE_MULTIPLIER * XR_DISTANCE_MULTIPLIER * nn.metricsDifference.NN * nn.metricsDifference.NN;
-        totalDiff += R2D(nn.metricsDifference.mu) * R2D(nn.metricsDifference.mu);
+    // Only the clusters of the nearest neighbors may have any votes.
+    // Pick the one with the most votes and reset the tally for the next step.
+    size_t bestieClusterIdx = Arch::INVALID_SIZE_T;
+    double bestieVotes = -1;
+    for (const auto &nn : nearestNeighbors) {
+        const auto clusterIdx = ctx->goldenSteps[nn.goldenStepIdx].clusterIdx;
+        const auto votes = clusterVotes[clusterIdx];
 
-        auto score = 1.0 / totalDiff;
-        clusterVotes[clusterIdx] += score;
+        if (votes > bestieVotes || (votes == bestieVotes && clusterIdx < bestieClusterIdx)) {
+            bestieClusterIdx = clusterIdx;
+            bestieVotes = votes;
+        }
     }
+    for (const auto &nn : nearestNeighbors)
+        clusterVotes[ctx->goldenSteps[nn.goldenStepIdx].clusterIdx] = 0.0;
 
-    // TODO: Rework
-    // Clusters sorted by the highest score
-    std::vector<std::pair<size_t, double>> sorted{}; // first: clusterNumber, second: score
-    for (const auto &[clusterNumber, votes] : clusterVotes)
-        sorted.emplace_back(clusterNumber, votes);
-    std::sort(sorted.begin(), sorted.end(), [](const auto &lhs, const auto &rhs) { return rhs.second < lhs.second; });
-
-    return { sorted[0].first, sorted[0].second };
+    return { bestieClusterIdx, bestieVotes };
 }
 
 /*
- * Inserts \p NearestNeighbor into a vector of NearestNeighbors
- * in a way that the vector is always sorted by nearestDistance.
- *
- * We expect the vector to be allocated in advance with a known size.
- * Therefore, in may contain invalid (empty) values. Since we always keep
- * the vector sorted, we only need to look at the last valid element.
+ * Offers a golden step as one of the \p maxNeighbors nearest neighbors.
+ * The neighbors are kept in a max-heap so the farthest one is always
+ * at the front and can be replaced in logarithmic time.
  *
  * NOTE: This function is defined out-of-order to avoid forward declarations.
  */
 static
-auto insertNearestNeighbor(const NearestNeighbor &nn, std::vector<NearestNeighbor> &vec, const size_t nValidNeighbors) -> size_t
+auto offerNearestNeighbor(const NearestNeighbor &nn, std::vector<NearestNeighbor> &heap, const size_t maxNeighbors)
 {
-    assert(vec.size() >= nValidNeighbors);
-
-    if (nValidNeighbors == 0) {
-        vec[0] = nn;
-        return 1UL;
-    }
-
-    const size_t lastValidIdx = nValidNeighbors - 1;
-
-    size_t idx = 0;
-    for (; idx <= lastValidIdx; idx++) {
-        if (nn.euclideanDistance < vec[idx].euclideanDistance)
-            break;
-    }
-
-    if (idx > lastValidIdx) {
-        if (idx < vec.size()) {
-            // Append
-            vec[idx] = nn;
-            return nValidNeighbors + 1;
-        } else {
-            // Vector is full and this item has greater nearestNeighborDistance than all elements it contains so just disregard it
-            return nValidNeighbors;
-        }
-    } else {
-        // Insert-sort
-        const bool vecIsFull = nValidNeighbors == vec.size();
-        // Make room to insert our item by moving things up
-        for (size_t jdx = (vecIsFull ? lastValidIdx : lastValidIdx + 1); jdx > idx; jdx--)
-            vec[jdx] = vec[jdx - 1];
-        vec[idx] = nn;
-
-        return nValidNeighbors + !vecIsFull;
+    constexpr auto isNearer = [](const NearestNeighbor &lhs, const NearestNeighbor &rhs) { return lhs.isNearerThan(rhs); };
+
+    if (heap.size() < maxNeighbors) {
+        heap.push_back(nn);
+        std::push_heap(heap.begin(), heap.end(), isNearer);
+    } else if (nn.isNearerThan(heap.front())) {
+        std::pop_heap(heap.begin(), heap.end(), isNearer);
+        heap.back() = nn;
+        std::push_heap(heap.begin(), heap.end(), isNearer);
     }
 }
 
 static
-auto findClosestNtC(const LLKA_StepMetrics &stepMetrics, const LLKA_ClassificationContext *ctx)
+auto findClosestNtC(const LLKA_StepMetrics &stepMetrics, std::vector<NearestNeighbor> &nearestNeighbors, const LLKA_ClassificationContext *ctx)
 {
     bool rejectDelta = false;
     if (
@@ -440,9 +407,8 @@ auto findClosestNtC(const LLKA_StepMetrics &stepMetrics, const LLKA_Classificati
 
     // PERF: This is sadly slow. Rewrite this to use SIMD once we have the basic implementation working and tested
 
-    std::vector<NearestNeighbor> nearestNeighbors(ctx->limits.numberOfUsedNearestNeighbors);
-    size_t nValidNearestNeighbors = 0;
-    double shortestEuclideanDistance = std::numeric_limits<double>::max();
+    const size_t maxNearestNeighbors = ctx->limits.numberOfUsedNearestNeighbors;
+    double shortestEuclideanDistanceSquared = std::numeric_limits<double>::max();
     size_t closestGoldenStepIdx = Arch::INVALID_SIZE_T;
     int32_t lastClusterNumber = -1;
     bool rejectCluster = rejectDelta; // Do not calculate any metrics because we will reject the step
@@ -450,16 +416,17 @@ auto findClosestNtC(const LLKA_StepMetrics &stepMetrics, const LLKA_Classificati
     NearestNeighbor emergencyNearestNeighbor{}; // Used as the nearest neighbor of there are no candidates that meet all
                                                 // of the matching criteria. This emergency neighbor will have the lowest euclidean distance
                                                 // to the measured step.
+    nearestNeighbors.clear();
     for (size_t gsIdx = 0; gsIdx < ctx->goldenSteps.size(); gsIdx++) {
         const auto &gs = ctx->goldenSteps[gsIdx];
         const auto &gsMetrics = gs.metrics;
 
-        NearestNeighbor nearestNeighbor{};
+        LLKA_StepMetrics metricsDifference;
 
         double totalDiffSquared = 0;
         for (const auto &clsPtr : ALL_TORSIONS_STEP_METRIC_CLSPTRS) {
             auto angDiff = angleDifference(stepMetrics.*clsPtr, gsMetrics.*clsPtr);
-            nearestNeighbor.metricsDifference.*clsPtr = angDiff;
+            metricsDifference.*clsPtr = angDiff;
             totalDiffSquared += angDiff * angDiff;
         }
 
@@ -486,26 +453,22 @@ auto findClosestNtC(const LLKA_StepMetrics &stepMetrics, const LLKA_Classificati
         const auto nnDiff = stepMetrics.NN - gsMetrics.NN;
         const auto muDiff = angleDifference(stepMetrics.mu, gsMetrics.mu);
 
-        // PERF: This is sort of excessive but we will not keep this code anyway
-        nearestNeighbor.metricsDifference.CC = ccDiff;
-        nearestNeighbor.metricsDifference.NN = nnDiff;
-        nearestNeighbor.metricsDifference.mu = muDiff;
+        metricsDifference.CC = ccDiff;
+        metricsDifference.NN = nnDiff;
+        metricsDifference.mu = muDiff;
 
-        ECHMET_TRACE(LLKATracing, CLASSIFICATION_METRICS_DIFFERENCES, stepMetrics, gs, nearestNeighbor.metricsDifference);
+        ECHMET_TRACE(LLKATracing, CLASSIFICATION_METRICS_DIFFERENCES, stepMetrics, gs, ctx->goldenStepNames[gsIdx], metricsDifference);
 
         const auto cc = D2R(XR_DISTANCE_MULTIPLIER) * ccDiff;
         const auto nn = D2R(XR_DISTANCE_MULTIPLIER) * nnDiff;
 
         totalDiffSquared += (cc * cc) + (nn * nn) + (muDiff * muDiff);
 
-        const auto totalEuclideanDistance = std::sqrt(totalDiffSquared);
-
-        nearestNeighbor.euclideanDistance = totalEuclideanDistance;
-        nearestNeighbor.goldenStepIdx = gsIdx;
+        const NearestNeighbor nearestNeighbor{totalDiffSquared, gsIdx};
 
-        if (totalEuclideanDistance < shortestEuclideanDistance) {
+        if (totalDiffSquared < shortestEuclideanDistanceSquared) {
             closestGoldenStepIdx = gsIdx;
-            shortestEuclideanDistance = totalEuclideanDistance;
+            shortestEuclideanDistanceSquared = totalDiffSquared;
             emergencyNearestNeighbor = nearestNeighbor;
         }
 
@@ -564,8 +527,7 @@ auto findClosestNtC(const LLKA_StepMetrics &stepMetrics, const LLKA_Classificati
             }
         }
 
-        // NOTE: We could do the insertion without copying but it probably would not make much difference
-        nValidNearestNeighbors = insertNearestNeighbor(nearestNeighbor, nearestNeighbors, nValidNearestNeighbors);
+        offerNearestNeighbor(nearestNeighbor, nearestNeighbors, maxNearestNeighbors);
 reject_golden_step:;
         // Jump right to the end of the loop if we reject the golden step
     }
@@ -573,16 +535,25 @@ reject_golden_step:;
     if (closestGoldenStepIdx == Arch::INVALID_SIZE_T)
         throw LLKA_CLASSIFICATION_E_WRONG_METRICS;
 
-    ECHMET_TRACE(LLKATracing, ALL_NEAREST_NEIGHBORS, nearestNeighbors, nValidNearestNeighbors, ctx);
+    // Turn the heap into a list sorted from the nearest to the farthest neighbor
+    std::sort_heap(
+        nearestNeighbors.begin(),
+        nearestNeighbors.end(),
+        [](const NearestNeighbor &lhs, const NearestNeighbor &rhs) { return lhs.isNearerThan(rhs); }
+    );
+    size_t nValidNearestNeighbors = nearestNeighbors.size();
+
+    for (size_t idx = 0; idx < nValidNearestNeighbors; idx++)
+        ECHMET_TRACE(LLKATracing, ALL_NEAREST_NEIGHBORS, idx, std::sqrt(nearestNeighbors[idx].euclideanDistanceSquared), ctx->goldenStepNames[nearestNeighbors[idx].goldenStepIdx]);
 
     if (nValidNearestNeighbors == 0) {
         assert(emergencyNearestNeighbor.goldenStepIdx != Arch::INVALID_SIZE_T);
 
-        nearestNeighbors[0] = std::move(emergencyNearestNeighbor);
+        nearestNeighbors.push_back(emergencyNearestNeighbor);
         nValidNearestNeighbors = 1;
     }
 
-    return std::make_tuple(std::move(nearestNeighbors), nValidNearestNeighbors, closestGoldenStepIdx, rejectDelta);
+    return std::make_tuple(nValidNearestNeighbors, closestGoldenStepIdx, rejectDelta);
 }
 
 static
@@ -596,39 +567,12 @@ auto invalidateClassifiedStep(LLKA_ClassifiedStep &classifiedStep)
     classifiedStep.closestGoldenStep = "";
 }
 
-static
-auto precalculateNtCExtendedBackbones()
-{
-    std::array<LLKA_Points, 96> precalculated{};
-
-    for (size_t idx = 0; idx < 96; idx++) {
-        LLKA_Structure ntcStru{
-            const_cast<LLKA_Atom *>(NTC_RAW_REFS[idx].atoms),
-            NTC_RAW_REFS[idx].nAtoms,
-        };
-        LLKA_Structure extBkbnStru{};
-
-        auto tRet = LLKA_extractExtendedBackbone(&ntcStru, &extBkbnStru);
-        assert(tRet == LLKA_OK);
-#ifdef NDEBUG
-        (void)tRet;
-#endif // NDEBUG
-
-        precalculated[idx].points = new LLKA_Point[extBkbnStru.nAtoms];
-        for (size_t pdx = 0; pdx < extBkbnStru.nAtoms; pdx++)
-            precalculated[idx].points[pdx] = extBkbnStru.atoms[pdx].coords;
-        precalculated[idx].nPoints = extBkbnStru.nAtoms;
-
-        LLKA_destroyStructure(&extBkbnStru);
-    }
-
-    return precalculated;
-}
-
 // NOTE: This function is defined out-of-order to avoid forward declarations */
 static
-LLKA_RetCode classifyStep(const LLKA_Structure &stru, const LLKA_ClassificationContext *ctx, LLKA_ClassifiedStep &classifiedStep)
+LLKA_RetCode classifyStep(const LLKA_Structure &stru, const LLKA_ClassificationContext *ctx, ClassificationWorkspace &workspace, LLKA_ClassifiedStep &classifiedStep)
 {
+    LLKA_PROFILE_SCOPE(LLKA_PROFILE_CLASSIFY_STEP);
+
     invalidateClassifiedStep(classifiedStep);
 
     // PERF: We should internalize these functions to avoid doing unnecessary checks over and over again
@@ -639,65 +583,47 @@ LLKA_RetCode classifyStep(const LLKA_Structure &stru, const LLKA_ClassificationC
     if (tRet != LLKA_OK)
         return tRet;
 
-    // These two must be the same for all atoms in the structure (unless there is something really odd going on)
-    const auto modelNum = stru.atoms[0].pdbx_PDB_model_num;
-    const auto asymId = stru.atoms[0].label_asym_id;
-
-    // Split the step up to individual nucleotides
-    LLKA_StructureView nuclFirst = LLKAInternal::extractNucleotideView(&stru, modelNum, asymId, info.firstSeqId);
-    LLKA_StructureView nuclSecond = LLKAInternal::extractNucleotideView(&stru, modelNum, asymId, info.secondSeqId);
-
-    LLKA_StructureView riboseViewFirst = {};
-    LLKA_StructureView riboseViewSecond = {};
-
-    tRet = LLKAInternal::extractRibose(&nuclFirst, &riboseViewFirst);
-    if (tRet != LLKA_OK) {
-        LLKA_destroyStructureView(&nuclSecond);
-        LLKA_destroyStructureView(&nuclFirst);
-
-        return tRet;
-    }
-
-    tRet = LLKAInternal::extractRibose(&nuclSecond, &riboseViewSecond);
-    if (tRet != LLKA_OK) {
-        LLKA_destroyStructureView(&riboseViewFirst);
-        LLKA_destroyStructureView(&nuclSecond);
-        LLKA_destroyStructureView(&nuclFirst);
-
+    // Pick the ribose atoms of both nucleotides in one go
+    std::array<std::array<LLKA_Point, 5>, 2> riboses;
+    tRet = LLKAInternal::stepRiboseCorePoints_unchecked(stru, riboses[0], riboses[1]);
+    if (tRet != LLKA_OK)
         return tRet;
-    }
 
     LLKA_StepMetrics stepMetrics{};
 
-    tRet = LLKAInternal::calculateStepMetrics_unchecked(&stru, &stepMetrics);
-    if (tRet != LLKA_OK) {
-        LLKA_destroyStructureView(&riboseViewSecond);
-        LLKA_destroyStructureView(&riboseViewFirst);
-        LLKA_destroyStructureView(&nuclSecond);
-        LLKA_destroyStructureView(&nuclFirst);
-
+    tRet = LLKA_PROFILED(LLKA_PROFILE_STEP_METRICS, LLKAInternal::calculateStepMetrics_unchecked(&stru, &stepMetrics));
+    if (tRet != LLKA_OK)
         return tRet;
-    }
 
     try {
         // Measure ribose geometry. We will use this regardless of how the NtC assignment turns out
-        LLKA_RiboseMetrics riboseMetrics;
+        std::array<LLKA_RiboseMetrics, 2> riboseMetrics;
 
-        LLKAInternal::riboseMetrics(riboseViewFirst, riboseMetrics);
-        classifiedStep.nuAngles_1 = riboseMetrics.nus;
-        classifiedStep.ribosePseudorotation_1 = riboseMetrics.P;
-        classifiedStep.tau_1 = riboseMetrics.tMax;
-        classifiedStep.sugarPucker_1 = riboseMetrics.pucker;
+        LLKA_PROFILED(LLKA_PROFILE_RIBOSE_METRICS, LLKAInternal::riboseMetricsBatch(riboses.data(), riboses.size(), riboseMetrics.data()));
+        classifiedStep.nuAngles_1 = riboseMetrics[0].nus;
+        classifiedStep.ribosePseudorotation_1 = riboseMetrics[0].P;
+        classifiedStep.tau_1 = riboseMetrics[0].tMax;
+        classifiedStep.sugarPucker_1 = riboseMetrics[0].pucker;
 
-        LLKAInternal::riboseMetrics(riboseViewSecond, riboseMetrics);
-        classifiedStep.nuAngles_2 = riboseMetrics.nus;
-        classifiedStep.ribosePseudorotation_2 = riboseMetrics.P;
-        classifiedStep.tau_2 = riboseMetrics.tMax;
-        classifiedStep.sugarPucker_2 = riboseMetrics.pucker;
+        classifiedStep.nuAngles_2 = riboseMetrics[1].nus;
+        classifiedStep.ribosePseudorotation_2 = riboseMetrics[1].P;
+        classifiedStep.tau_2 = riboseMetrics[1].tMax;
+        classifiedStep.sugarPucker_2 = riboseMetrics[1].pucker;
 
         // Look for best matching NtC and golden step
-        auto [ nearestNeighbors, nValidNearestNeighbors, closestGoldenStepIdx, rejectDelta ] = findClosestNtC(stepMetrics, ctx);
-        auto [ bestieClusterIdx, bestieVotes ] = determineBestieClusterIdx(std::views::counted(nearestNeighbors.cbegin(), nValidNearestNeighbors), ctx);
+        const auto &nearestNeighbors = workspace.nearestNeighbors;
+        auto [ nValidNearestNeighbors, closestGoldenStepIdx, rejectDelta ] = LLKA_PROFILED(
+            LLKA_PROFILE_GOLDEN_STEP_SCAN,
+            findClosestNtC(stepMetrics, workspace.nearestNeighbors, ctx)
+        );
+        auto [ bestieClusterIdx, bestieVotes ] = LLKA_PROFILED(
+            LLKA_PROFILE_CLUSTER_VOTING,
+            determineBestieClusterIdx(
+                std::views::counted(nearestNeighbors.cbegin(), nValidNearestNeighbors),
+                workspace.clusterVotes,
+                ctx
+            )
+        );
 
         if (nValidNearestNeighbors == 0)
             ECHMET_TRACE(LLKATracing, DETAILS_STEPS_WITH_NO_NEIGHBORS, stru, stepMetrics);
@@ -739,12 +665,12 @@ LLKA_RetCode classifyStep(const LLKA_Structure &stru, const LLKA_ClassificationC
         }
 
         ECHMET_TRACE(LLKATracing, BESTIE_CLUSTER_INFO, bestieCluster, notEnoughNearestNeigbors, notEnoughVotes);
-        ECHMET_TRACE(LLKATracing, CLOSEST_GOLDEN_STEP_INFO, ctx->goldenSteps[closestGoldenStepIdx], ctx->clusters);
+        ECHMET_TRACE(LLKATracing, CLOSEST_GOLDEN_STEP_INFO, ctx->goldenSteps[closestGoldenStepIdx], ctx->goldenStepNames[closestGoldenStepIdx], ctx->clusters);
 
         classifiedStep.closestNtC = bestieCluster.NtC;
         classifiedStep.closestCANA = bestieCluster.CANA;
         classifiedStep.confalScore = {};
-        classifiedStep.closestGoldenStep = ctx->goldenSteps[closestGoldenStepIdx].name;
+        classifiedStep.closestGoldenStep = ctx->goldenStepNames[closestGoldenStepIdx];
 
         auto [ distancesFromNtCAverages, euclideanDistanceIdeal ] = calcDistancesFromNtCAverages(stepMetrics, bestieCluster);
 
@@ -754,26 +680,35 @@ LLKA_RetCode classifyStep(const LLKA_Structure &stru, const LLKA_ClassificationC
         classifiedStep.differencesFromNtCAverages = distancesFromNtCAverages;
         classifiedStep.euclideanDistanceNtCIdeal = euclideanDistanceIdeal;
 
-        classifiedStep.rmsdToClosestNtC = calcRmsdToClosestNtC(&stru, ctx->ntcExtendedBackbonePoints[classifiedStep.closestNtC]);
+        classifiedStep.rmsdToClosestNtC = LLKA_PROFILED(
+            LLKA_PROFILE_SUPERPOSITION,
+            calcRmsdToClosestNtC(&stru, NTC_REFERENCE_BACKBONES[classifiedStep.closestNtC])
+        );
 
         if (nValidNearestNeighbors > 0) {
-            auto [ violations, violatingTorsionsAverage, violatingTorsionsNearest ] = checkNtCTolerances(
-                stepMetrics,
-                bestieCluster,
-                std::views::counted(nearestNeighbors.cbegin(), nValidNearestNeighbors),
-                classifiedStep.ribosePseudorotation_1,
-                classifiedStep.ribosePseudorotation_2,
-                ctx
+            auto [ violations, violatingTorsionsAverage, violatingTorsionsNearest ] = LLKA_PROFILED(
+                LLKA_PROFILE_TOLERANCES,
+                checkNtCTolerances(
+                    stepMetrics,
+                    bestieCluster,
+                    std::views::counted(nearestNeighbors.cbegin(), nValidNearestNeighbors),
+                    classifiedStep.ribosePseudorotation_1,
+                    classifiedStep.ribosePseudorotation_2,
+                    ctx
+                )
             );
 
             classifiedStep.violations |= violations;
             classifiedStep.violatingTorsionsAverage = violatingTorsionsAverage;
             classifiedStep.violatingTorsionsNearest = violatingTorsionsNearest;
 
-            classifiedStep.confalScore = calcConfalScore(
-                classifiedStep.differencesFromNtCAverages,
-                ctx->confals[bestieClusterIdx],
-                classifiedStep.violations == LLKA_CLASSIFICATION_OK
+            classifiedStep.confalScore = LLKA_PROFILED(
+                LLKA_PROFILE_CONFAL_SCORING,
+                calcConfalScore(
+                    classifiedStep.differencesFromNtCAverages,
+                    ctx->confalCoefficients[bestieClusterIdx],
+                    classifiedStep.violations == LLKA_CLASSIFICATION_OK
+                )
             );
 
             if (classifiedStep.violations == LLKA_CLASSIFICATION_OK) {
@@ -785,25 +720,168 @@ LLKA_RetCode classifyStep(const LLKA_Structure &stru, const LLKA_ClassificationC
             }
         }
 
-        LLKA_destroyStructureView(&riboseViewSecond);
-        LLKA_destroyStructureView(&riboseViewFirst);
-
-        LLKA_destroyStructureView(&nuclSecond);
-        LLKA_destroyStructureView(&nuclFirst);
-
         return LLKA_OK;
     } catch (const decltype(LLKA_CLASSIFICATION_OK) violations) {
         LLKAInternal::invalidateClassifiedStep(classifiedStep);
         classifiedStep.violations = violations;
 
-        LLKA_destroyStructureView(&riboseViewSecond);
-        LLKA_destroyStructureView(&riboseViewFirst);
+        return LLKA_OK;
+    }
+}
+
+auto initializeClassificationContext(
+    LLKA_ClassificationContext &ctx,
+    const std::span<const LLKA_Confal> &confals,
+    const std::span<const LLKA_ClusterNuAngles> &clusterNuAngles,
+    const std::span<const LLKA_ConfalPercentile> &confalPercentiles,
+    const LLKA_ClassificationLimits &limits,
+    double maxCloseEnoughRmsd
+) -> LLKA_RetCode
+{
+    auto &storage = ctx.storage;
+    const auto nClusters = storage.clusters.size();
 
-        LLKA_destroyStructureView(&nuclSecond);
-        LLKA_destroyStructureView(&nuclFirst);
+    if (storage.goldenSteps.empty() || nClusters == 0 || confals.empty() || clusterNuAngles.empty())
+        return LLKA_E_INVALID_ARGUMENT;
+    if (maxCloseEnoughRmsd <= 0.0)
+        return LLKA_E_INVALID_ARGUMENT;
 
-        return LLKA_OK;
+    if (nClusters != confals.size())
+        return LLKA_E_MISMATCHING_SIZES;
+    if (nClusters != clusterNuAngles.size())
+        return LLKA_E_MISMATCHING_SIZES;
+
+    if (confalPercentiles.size() != 101)
+        return LLKA_E_BAD_DATA;
+
+    // Track which cluster numbers correspond to indices in the clusters vector.
+    // We can use this to tell golden steps where to get their respective clusters.
+    std::map<int32_t, size_t> clusterNumberToIndexMapping{};
+
+    for (size_t idx = 0; idx < nClusters; idx++) {
+        auto &cluster = storage.clusters[idx];
+
+        if (containsKey(clusterNumberToIndexMapping, cluster.number))
+            return LLKA_E_BAD_CLASSIFICATION_CLUSTERS;
+        clusterNumberToIndexMapping[cluster.number] = idx;
+
+        for (const auto clsPtr : ALL_TORSIONS_CLASSIFICATION_METRIC_CLSPTRS) {
+            auto &metric = cluster.*clsPtr;
+
+            if (metric.meanValue < 0.0 || metric.deviation < 0.0)
+                return LLKA_E_BAD_CLASSIFICATION_CLUSTERS;
+
+            metric.deviation *= BACKBONE_TORSIONS_DEVIATION_MULTIPLIER;
+            metric.minValue = clampAngle(angleAsFull(metric.meanValue - metric.deviation));
+            metric.maxValue = clampAngle(angleAsFull(metric.meanValue + metric.deviation));
+        }
+
+        cluster.CC.deviation *= XR_DISTANCE_DEVIATION_MULTIPLIER;
+        cluster.CC.minValue = cluster.CC.meanValue - cluster.CC.deviation;
+        cluster.CC.maxValue = cluster.CC.meanValue + cluster.CC.deviation;
+
+        cluster.NN.deviation *= XR_DISTANCE_DEVIATION_MULTIPLIER;
+        cluster.NN.minValue = cluster.NN.meanValue - cluster.NN.deviation;
+        cluster.NN.maxValue = cluster.NN.meanValue + cluster.NN.deviation;
+
+        cluster.mu.deviation *= MU_TORSION_DEVIATION_MULTIPLIER;
+        cluster.mu.minValue = clampAngle(angleAsFull(cluster.mu.meanValue - cluster.mu.deviation));
+        cluster.mu.maxValue = clampAngle(angleAsFull(cluster.mu.meanValue + cluster.mu.deviation));
     }
+
+    for (auto &gs : storage.goldenSteps) {
+        if (!containsKey(clusterNumberToIndexMapping, gs.clusterNumber))
+            return LLKA_E_BAD_GOLDEN_STEPS;
+
+        gs.clusterIdx = clusterNumberToIndexMapping[gs.clusterNumber];
+    }
+
+    // Sort the golden steps by cluster number. This will allow us to quicky reject an entire cluster
+    // in the classification process.
+    std::sort(
+        storage.goldenSteps.begin(),
+        storage.goldenSteps.end(),
+        [](const auto &lhs, const auto &rhs) {
+            return lhs.clusterNumber < rhs.clusterNumber;
+        }
+    );
+
+    // Precalculate sines and cosines of golden step torsions. These are needed to get the circular means
+    // of nearest neighbors torsions. The golden steps must already be sorted at this point.
+    storage.goldenStepsTorsionsTrig.resize(storage.goldenSteps.size());
+    for (size_t idx = 0; idx < storage.goldenSteps.size(); idx++) {
+        const auto &metrics = storage.goldenSteps[idx].metrics;
+        auto &trig = storage.goldenStepsTorsionsTrig[idx];
+
+        for (size_t jdx = 0; jdx < NUM_CLASSIFICATION_TORSIONS; jdx++) {
+            const auto torsion = angleAsFull(metrics.*ALL_TORSIONS_STEP_METRIC_CLSPTRS[jdx]);
+            trig.sines[jdx] = std::sin(torsion);
+            trig.cosines[jdx] = std::cos(torsion);
+        }
+    }
+
+    storage.confals.resize(confals.size());
+    for (size_t idx = 0; idx < confals.size(); idx++) {
+        const auto &confal = confals[idx];
+
+        if (!containsKey(clusterNumberToIndexMapping, confal.clusterNumber))
+            return LLKA_E_BAD_CONFALS;
+        const auto clusterIdx = clusterNumberToIndexMapping[confal.clusterNumber];
+
+        storage.confals[clusterIdx] = confal;
+    }
+
+    // Precalculate the coefficients of the confal score Gaussians
+    storage.confalCoefficients.resize(confals.size());
+    for (size_t idx = 0; idx < confals.size(); idx++) {
+        const auto &confal = storage.confals[idx];
+        auto &coefficients = storage.confalCoefficients[idx];
+
+        for (size_t jdx = 0; jdx < NUM_CONFAL_METRICS; jdx++) {
+            const auto sigma = confal.*CONFAL_CLSPTRS[jdx];
+            const auto unitScale = CONFAL_METRIC_IS_ANGLE[jdx] ? R2D(1.0) : 1.0;
+
+            coefficients[jdx] = -(unitScale * unitScale) / (2.0 * sigma * sigma);
+        }
+    }
+
+    for (size_t idx = 0; idx < clusterNuAngles.size(); idx++) {
+        const auto &nus = clusterNuAngles[idx];
+
+        if (!containsKey(clusterNumberToIndexMapping, nus.clusterNumber))
+            return LLKA_E_BAD_AVERAGE_NU_ANGLES;
+        const auto clusterIdx = clusterNumberToIndexMapping[nus.clusterNumber];
+        auto &cluster = storage.clusters[clusterIdx];
+
+        cluster.nusFirst = nus.firstNucleotide;
+        cluster.nusSecond = nus.secondNucleotide;
+
+        // Initialize Nu angles data
+        for (const auto &clsPtr : NU_ANGLES_METRICS_CLSPTRS) {
+            auto &first = cluster.nusFirst.*clsPtr;
+            first.meanValue = angleAsFull(first.meanValue);
+            first.minValue = clampAngle(angleAsFull(first.meanValue - first.deviation));
+            first.maxValue = clampAngle(angleAsFull(first.meanValue + first.deviation));
+
+            auto &second = cluster.nusSecond.*clsPtr;
+            second.meanValue = angleAsFull(second.meanValue);
+            second.minValue = clampAngle(angleAsFull(second.meanValue - second.deviation));
+            second.maxValue = clampAngle(angleAsFull(second.meanValue + second.deviation));
+        }
+    }
+
+    storage.confalPercentiles.resize(confalPercentiles.size());
+    for (size_t idx = 0; idx < confalPercentiles.size(); idx++)
+        storage.confalPercentiles[idx] = confalPercentiles[idx].value;
+
+    if (!areClassificationLimitsValid(limits))
+        return LLKA_E_BAD_CLASSIFICATION_LIMITS;
+
+    ctx.limits = limits;
+    ctx.maxCloseEnoughRmsd = maxCloseEnoughRmsd;
+    ctx.bindStorage();
+
+    return LLKA_OK;
 }
 
 } // namespace LLKAInternal
@@ -827,7 +905,7 @@ LLKA_AverageConfal LLKA_CC LLKA_averageConfal(const LLKA_ClassifiedStep *classif
 
     return {
         .score = averageConfal,
-        .percentile = ctx->confalPercentiles.at(percentileIndex)
+        .percentile = ctx->confalPercentiles[percentileIndex]
     };
 }
 
@@ -854,7 +932,7 @@ LLKA_API LLKA_AverageConfal LLKA_CC LLKA_averageConfalAttempted(const LLKA_Class
 
     return {
         .score = averageConfal,
-        .percentile = ctx->confalPercentiles.at(percentileIndex)
+        .percentile = ctx->confalPercentiles[percentileIndex]
     };
 }
 
@@ -897,7 +975,10 @@ const char * LLKA_CC LLKA_classificationViolationToName(int32_t violation)
 
 LLKA_RetCode LLKA_CC LLKA_classifyStep(const LLKA_Structure *stru, const LLKA_ClassificationContext *ctx, LLKA_ClassifiedStep *classifiedStep)
 {
-    return LLKAInternal::classifyStep(*stru, ctx, *classifiedStep);
+    ECHMET_TRACE_CONTEXT(LLKATracing, 0);
+    LLKAInternal::ClassificationWorkspace workspace{ctx};
+
+    return LLKAInternal::classifyStep(*stru, ctx, workspace, *classifiedStep);
 }
 
 LLKA_RetCode LLKA_CC LLKA_classifyStepsMultiple(const LLKA_Structures *strus, const LLKA_ClassificationContext *ctx, LLKA_ClassifiedSteps *classifiedSteps)
@@ -905,17 +986,22 @@ LLKA_RetCode LLKA_CC LLKA_classifyStepsMultiple(const LLKA_Structures *strus, co
     if (strus->nStrus == 0)
         return LLKA_E_NOTHING_TO_CLASSIFY;
 
-    classifiedSteps->attemptedSteps = new LLKA_AttemptedClassifiedStep[strus->nStrus];
+    classifiedSteps->attemptedSteps = new LLKA_AttemptedClassifiedStep[strus->nStrus]{};
     classifiedSteps->nAttemptedSteps = strus->nStrus;
 
-    for (size_t idx = 0; idx < strus->nStrus; idx++) {
-        ECHMET_TRACE(LLKATracing, BEGIN_STEP_CLASSIFICATION_MULTIPLE, idx);
+    // Steps are classified independently, each thread needs only its own workspace
+    LLKAInternal::parallelFor(strus->nStrus, LLKAInternal::MIN_STEPS_PER_THREAD, [strus, ctx, classifiedSteps](size_t first, size_t last) {
+        LLKAInternal::ClassificationWorkspace workspace{ctx};
+        for (size_t idx = first; idx < last; idx++) {
+            ECHMET_TRACE_CONTEXT(LLKATracing, idx);
+            ECHMET_TRACE(LLKATracing, BEGIN_STEP_CLASSIFICATION_MULTIPLE, idx);
 
-        const auto &stru = strus->strus[idx];
-        auto &attempt = classifiedSteps->attemptedSteps[idx];
+            const auto &stru = strus->strus[idx];
+            auto &attempt = classifiedSteps->attemptedSteps[idx];
 
-        attempt.status = LLKAInternal::classifyStep(stru, ctx, attempt.step);
-    }
+            attempt.status = LLKAInternal::classifyStep(stru, ctx, workspace, attempt.step);
+        }
+    });
 
     return LLKA_OK;
 }
@@ -949,7 +1035,7 @@ double LLKA_CC LLKA_confalPercentile(double confalScore, const LLKA_Classificati
     if (confalScore < 0 || confalScore > 100)
         return -1;
 
-    return ctx->confalPercentiles.at(std::floor(confalScore));
+    return ctx->confalPercentiles[size_t(std::floor(confalScore))];
 }
 
 void LLKA_CC LLKA_destroyClassificationContext(LLKA_ClassificationContext *ctx)
@@ -973,134 +1059,23 @@ LLKA_RetCode LLKA_CC LLKA_initializeClassificationContext(
     double maxCloseEnoughRmsd,
     LLKA_ClassificationContext **ctx
 ) {
-    if (nGoldenSteps == 0 || nClusters == 0 || nConfals == 0 || nClusterNuAngles == 0)
-        return LLKA_E_INVALID_ARGUMENT;
-    if (maxCloseEnoughRmsd <= 0.0)
-        return LLKA_E_INVALID_ARGUMENT;
-
-    if (nClusters != nConfals)
-        return LLKA_E_MISMATCHING_SIZES;
-    if (nClusters != nClusterNuAngles)
-        return LLKA_E_MISMATCHING_SIZES;
-
-    if (nConfalPercentiles != 101)
-        return LLKA_E_BAD_DATA;
-
     auto _ctx = std::make_unique<LLKA_ClassificationContext>();
 
-    _ctx->clusters.resize(nClusters);
-
-    // Track which cluster numbers correspond to indices in the clusters vector.
-    // We can use this to tell golden steps where to get their respective clusters.
-    std::map<int32_t, size_t> clusterNumberToIndexMapping{};
-
-    for (size_t idx = 0; idx < nClusters; idx++) {
-        const auto &c = clusters[idx];
-
-        if (LLKAInternal::containsKey(clusterNumberToIndexMapping, c.number))
-            return LLKA_E_BAD_CLASSIFICATION_CLUSTERS;
-        clusterNumberToIndexMapping[c.number] = idx;
-
-        _ctx->clusters[idx] = c;
-
-        auto &cluster = _ctx->clusters[idx];
-        for (const auto clsPtr : LLKAInternal::ALL_TORSIONS_CLASSIFICATION_METRIC_CLSPTRS) {
-            auto &metric = cluster.*clsPtr;
-
-            if (metric.meanValue < 0.0 || metric.deviation < 0.0)
-                return LLKA_E_BAD_CLASSIFICATION_CLUSTERS;
-
-            metric.deviation *= LLKAInternal::BACKBONE_TORSIONS_DEVIATION_MULTIPLIER;
-            metric.minValue = LLKAInternal::clampAngle(LLKAInternal::angleAsFull(metric.meanValue - metric.deviation));
-            metric.maxValue = LLKAInternal::clampAngle(LLKAInternal::angleAsFull(metric.meanValue + metric.deviation));
-        }
-
-        cluster.CC.deviation *= LLKAInternal::XR_DISTANCE_DEVIATION_MULTIPLIER;
-        cluster.CC.minValue = cluster.CC.meanValue - cluster.CC.deviation;
-        cluster.CC.maxValue = cluster.CC.meanValue + cluster.CC.deviation;
-
-        cluster.NN.deviation *= LLKAInternal::XR_DISTANCE_DEVIATION_MULTIPLIER;
-        cluster.NN.minValue = cluster.NN.meanValue - cluster.NN.deviation;
-        cluster.NN.maxValue = cluster.NN.meanValue + cluster.NN.deviation;
-
-        cluster.mu.deviation *= LLKAInternal::MU_TORSION_DEVIATION_MULTIPLIER;
-        cluster.mu.minValue = LLKAInternal::clampAngle(LLKAInternal::angleAsFull(cluster.mu.meanValue - cluster.mu.deviation));
-        cluster.mu.maxValue = LLKAInternal::clampAngle(LLKAInternal::angleAsFull(cluster.mu.meanValue + cluster.mu.deviation));
-    }
-
-    _ctx->goldenSteps.resize(nGoldenSteps);
-    for (size_t idx = 0; idx < nGoldenSteps; idx++) {
-        const auto &gs = goldenSteps[idx];
-
-        if (!LLKAInternal::containsKey(clusterNumberToIndexMapping, gs.clusterNumber))
-            return LLKA_E_BAD_GOLDEN_STEPS;
-
-        _ctx->goldenSteps[idx] = gs;
-        _ctx->goldenSteps[idx].name = LLKAInternal::duplicateString(gs.name);
-        _ctx->goldenSteps[idx].clusterIdx = clusterNumberToIndexMapping[gs.clusterNumber];
-    }
-
-    // Sort the golden steps by cluster number. This will allow us to quicky reject an entire cluster
-    // in the classification process.
-    std::sort(
-        _ctx->goldenSteps.begin(),
-        _ctx->goldenSteps.end(),
-        [](const auto &lhs, const auto &rhs) {
-            return lhs.clusterNumber < rhs.clusterNumber;
-        }
+    _ctx->storage.clusters.assign(clusters, clusters + nClusters);
+    _ctx->storage.goldenSteps.assign(goldenSteps, goldenSteps + nGoldenSteps);
+    for (auto &gs : _ctx->storage.goldenSteps)
+        gs.name = LLKAInternal::duplicateString(gs.name);
+
+    auto tRet = LLKAInternal::initializeClassificationContext(
+        *_ctx,
+        { confals, nConfals },
+        { clusterNuAngles, nClusterNuAngles },
+        { confalPercentiles, nConfalPercentiles },
+        *limits,
+        maxCloseEnoughRmsd
     );
-
-    _ctx->confals.resize(nConfals);
-    for (size_t idx = 0; idx < nConfals; idx++) {
-        const auto &confal = confals[idx];
-
-        if (!LLKAInternal::containsKey(clusterNumberToIndexMapping, confal.clusterNumber))
-            return LLKA_E_BAD_CONFALS;
-        const auto clusterIdx = clusterNumberToIndexMapping[confal.clusterNumber];
-
-        _ctx->confals[clusterIdx] = confal;
-    }
-
-    for (size_t idx = 0; idx < nClusterNuAngles; idx++) {
-        const auto &nus = clusterNuAngles[idx];
-
-        if (!LLKAInternal::containsKey(clusterNumberToIndexMapping, nus.clusterNumber))
-            return LLKA_E_BAD_AVERAGE_NU_ANGLES;
-        const auto clusterIdx = clusterNumberToIndexMapping[nus.clusterNumber];
-        auto &cluster = _ctx->clusters[clusterIdx];
-
-        cluster.nusFirst = nus.firstNucleotide;
-        cluster.nusSecond = nus.secondNucleotide;
-
-        // Initialize Nu angles data
-        for (const auto &clsPtr : LLKAInternal::NU_ANGLES_METRICS_CLSPTRS) {
-            auto &first = cluster.nusFirst.*clsPtr;
-            first.meanValue = LLKAInternal::angleAsFull(first.meanValue);
-            first.minValue = LLKAInternal::clampAngle(LLKAInternal::angleAsFull(first.meanValue - first.deviation));
-            first.maxValue = LLKAInternal::clampAngle(LLKAInternal::angleAsFull(first.meanValue + first.deviation));
-
-            auto &second = cluster.nusSecond.*clsPtr;
-            second.meanValue = LLKAInternal::angleAsFull(second.meanValue);
-            second.minValue = LLKAInternal::clampAngle(LLKAInternal::angleAsFull(second.meanValue - second.deviation));
-            second.maxValue = LLKAInternal::clampAngle(LLKAInternal::angleAsFull(second.meanValue + second.deviation));
-        }
-    }
-
-    _ctx->confalPercentiles.resize(nConfalPercentiles);
-    for (size_t idx = 0; idx < nConfalPercentiles; idx++)
-        _ctx->confalPercentiles[idx] = confalPercentiles[idx].value;
-
-    if (
-        limits->averageNeighborsTorsionCutoff <= 0.0 || limits->nearestNeighborTorsionsCutoff <= 0.0 || limits->totalDistanceCutoff <= 0.0 || limits->pseudorotationCutoff <= 0.0 ||
-        limits->minimumClusterVotes <= 0.0 ||
-        limits->minimumNearestNeighbors < 1 || limits->numberOfUsedNearestNeighbors < limits->minimumNearestNeighbors
-    )
-        return LLKA_E_BAD_CLASSIFICATION_LIMITS;
-
-    _ctx->limits = *limits;
-    _ctx->maxCloseEnoughRmsd = maxCloseEnoughRmsd;
-
-    _ctx->ntcExtendedBackbonePoints = LLKAInternal::precalculateNtCExtendedBackbones();
+    if (tRet != LLKA_OK)
+        return tRet;
 
     *ctx = _ctx.release();
 
@@ -1114,160 +1089,244 @@ LLKA_RetCode LLKA_CC LLKA_initializeClassificationContext(
 
 namespace ECHMET {
 
-ECHMET_MAKE_TRACEPOINT_NOINLINE(LLKATracing, CLASSIFICATION_METRICS_DIFFERENCES, "Classification metrics differences")
-ECHMET_BEGIN_MAKE_LOGGER(LLKATracing, CLASSIFICATION_METRICS_DIFFERENCES, const LLKA_StepMetrics &stepMetrics, const LLKA_GoldenStep &gs, const LLKA_StepMetrics &differences)
+// Step metrics are recorded in the order of CONFAL_STEP_METRIC_CLSPTRS
+inline constexpr std::array<const char *, LLKAInternal::NUM_CONFAL_METRICS> TRACED_STEP_METRICS_NAMES{
+    "delta_1:   ", "epsilon_1: ", "zeta_1:    ", "alpha_2:   ", "beta_2:    ", "gamma_2:   ",
+    "delta_2:   ", "chi_1:     ", "chi_2:     ", "CC:        ", "NN:        ", "mu:        "
+};
+
+static
+auto recordStepMetrics(TraceRecord &record, const LLKA_StepMetrics &metrics)
 {
-    const auto &gsMetrics = gs.metrics;
+    for (const auto clsPtr : LLKAInternal::CONFAL_STEP_METRIC_CLSPTRS)
+        record.addValue(metrics.*clsPtr);
+}
 
-    std::ostringstream oss{};
+static
+auto formatStepMetrics(std::ostringstream &oss, const TraceRecord &record, const size_t nColumns)
+{
+    const size_t N = LLKAInternal::NUM_CONFAL_METRICS;
 
-    oss
-        << "Measuring against golden step " << gs.name << "\n"
-        << "delta_1:   " << stepMetrics.delta_1 << ", " << gsMetrics.delta_1 << ", " << differences.delta_1 << "\n"
-        << "epsilon_1: " << stepMetrics.epsilon_1 << ", " << gsMetrics.epsilon_1  << ", "  << differences.epsilon_1 << "\n"
-        << "zeta_1:    " << stepMetrics.zeta_1 << ", " << gsMetrics.zeta_1 << ", " << differences.zeta_1 << "\n"
-        << "alpha_2:   " << stepMetrics.alpha_2 << ", " << gsMetrics.alpha_2 << ", " << differences.alpha_2 << "\n"
-        << "beta_2:    " << stepMetrics.beta_2 << ", " << gsMetrics.beta_2 << ", "  << differences.beta_2 << "\n"
-        << "gamma_2:   " << stepMetrics.gamma_2 << ", " << gsMetrics.gamma_2 << ", " << differences.gamma_2 << "\n"
-        << "delta_2:   " << stepMetrics.delta_2 << ", " << gsMetrics.delta_2 << ", " << differences.delta_2 << "\n"
-        << "chi_1:     " << stepMetrics.chi_1 << ", " << gsMetrics.chi_1 << ", " << differences.chi_1 << "\n"
-        << "chi_2:     " << stepMetrics.chi_2 << ", " << gsMetrics.chi_2 << ", " << differences.chi_2 << "\n"
-        << "CC:        " << stepMetrics.CC << ", " << gsMetrics.CC << ", " << differences.CC << "\n"
-        << "NN:        " << stepMetrics.NN << ", " << gsMetrics.NN << ", " << differences.NN << "\n"
-        << "mu:        " << stepMetrics.mu << ", " << gsMetrics.mu << ", "  << differences.mu << "\n";
-
-	return oss.str();
+    for (size_t idx = 0; idx < N; idx++) {
+        oss << TRACED_STEP_METRICS_NAMES[idx] << record.values[idx];
+        for (size_t col = 1; col < nColumns; col++)
+            oss << ", " << record.values[col * N + idx];
+        oss << "\n";
+    }
+}
+
+ECHMET_MAKE_TRACEPOINT_NOINLINE(
+    LLKATracing, CLASSIFICATION_METRICS_DIFFERENCES, "Classification metrics differences",
+    "values: step metrics, golden step metrics and their differences, 12 each, ordered as delta_1, epsilon_1, zeta_1, alpha_2, beta_2, gamma_2, delta_2, chi_1, chi_2, CC, NN, mu; label: golden step name"
+)
+ECHMET_BEGIN_MAKE_LOGGER(LLKATracing, CLASSIFICATION_METRICS_DIFFERENCES, const LLKA_StepMetrics &stepMetrics, const LLKA_GoldenStep &gs, const char *name, const LLKA_StepMetrics &differences)
+{
+    recordStepMetrics(record, stepMetrics);
+    recordStepMetrics(record, gs.metrics);
+    recordStepMetrics(record, differences);
+    record.setLabel(name);
 }
 ECHMET_END_MAKE_LOGGER
 
-ECHMET_MAKE_TRACEPOINT_NOINLINE(LLKATracing, ALL_NEAREST_NEIGHBORS, "All nearest neighbors of a step that will be voted for")
-ECHMET_BEGIN_MAKE_LOGGER(LLKATracing, ALL_NEAREST_NEIGHBORS, const std::vector<LLKAInternal::NearestNeighbor> &nearestNeighbors, size_t nValidNearestNeighbors, const LLKA_ClassificationContext *ctx)
+ECHMET_MAKE_FORMATTER_NOINLINE(LLKATracing, CLASSIFICATION_METRICS_DIFFERENCES, record)
 {
     std::ostringstream oss{};
 
-    oss << "--- Nearest neighbors to vote for ---\n";
-    oss << "No.\tEucl. dist.\tGolden step\n";
+    oss << "Measuring against golden step " << record.label.data() << "\n";
+    formatStepMetrics(oss, record, 3);
+
+    return oss.str();
+}
+
+ECHMET_MAKE_TRACEPOINT_NOINLINE(
+    LLKATracing, ALL_NEAREST_NEIGHBORS, "All nearest neighbors of a step that will be voted for",
+    "indices: order of the neighbor; values: euclidean distance; label: golden step name"
+)
+ECHMET_BEGIN_MAKE_LOGGER(LLKATracing, ALL_NEAREST_NEIGHBORS, size_t idx, double euclideanDistance, const char *name)
+{
+    record.addIndex(idx);
+    record.addValue(euclideanDistance);
+    record.setLabel(name);
+}
+ECHMET_END_MAKE_LOGGER
 
-    for (size_t idx = 0; idx < nValidNearestNeighbors; idx++) {
-        const auto &nn = nearestNeighbors[idx];
+ECHMET_MAKE_FORMATTER_NOINLINE(LLKATracing, ALL_NEAREST_NEIGHBORS, record)
+{
+    std::ostringstream oss{};
 
-        oss << idx << "\t" << std::setprecision(7) << nn.euclideanDistance << "\t" << ctx->goldenSteps[nn.goldenStepIdx].name << "\n";
+    if (record.indices[0] == 0) {
+        oss << "--- Nearest neighbors to vote for ---\n";
+        oss << "No.\tEucl. dist.\tGolden step\n";
     }
+    oss << record.indices[0] << "\t" << std::setprecision(7) << record.values[0] << "\t" << record.label.data();
 
     return oss.str();
 }
-ECHMET_END_MAKE_LOGGER
 
-ECHMET_MAKE_TRACEPOINT_NOINLINE(LLKATracing, BEGIN_STEP_CLASSIFICATION_MULTIPLE, "Report the beginning of a step classification from a function that classifies multiple steps in sequence")
+ECHMET_MAKE_TRACEPOINT_NOINLINE(
+    LLKATracing, BEGIN_STEP_CLASSIFICATION_MULTIPLE, "Report the beginning of a step classification from a function that classifies multiple steps in sequence",
+    "indices: index of the step"
+)
 ECHMET_BEGIN_MAKE_LOGGER(LLKATracing, BEGIN_STEP_CLASSIFICATION_MULTIPLE, size_t idx)
 {
-    return "Attempting to classify step " + std::to_string(idx) + "\n";
+    record.addIndex(idx);
 }
 ECHMET_END_MAKE_LOGGER
 
-ECHMET_MAKE_TRACEPOINT_NOINLINE(LLKATracing, DIFFERENCES_FROM_NTC_AVERAGES, "Differences between step metrics values and averages for the closest NtC class")
+ECHMET_MAKE_FORMATTER_NOINLINE(LLKATracing, BEGIN_STEP_CLASSIFICATION_MULTIPLE, record)
+{
+    return "Attempting to classify step " + std::to_string(record.indices[0]) + "\n";
+}
+
+ECHMET_MAKE_TRACEPOINT_NOINLINE(
+    LLKATracing, DIFFERENCES_FROM_NTC_AVERAGES, "Differences between step metrics values and averages for the closest NtC class",
+    "values: 12 differences ordered as delta_1, epsilon_1, zeta_1, alpha_2, beta_2, gamma_2, delta_2, chi_1, chi_2, CC, NN, mu; indices: closest NtC"
+)
 ECHMET_BEGIN_MAKE_LOGGER(LLKATracing, DIFFERENCES_FROM_NTC_AVERAGES, LLKA_StepMetrics &diffs, const LLKA_NtC ntc)
+{
+    recordStepMetrics(record, diffs);
+    record.addIndex(ntc);
+}
+ECHMET_END_MAKE_LOGGER
+
+ECHMET_MAKE_FORMATTER_NOINLINE(LLKATracing, DIFFERENCES_FROM_NTC_AVERAGES, record)
 {
     std::ostringstream oss{};
 
-    oss
-        << "Differences between NtC averages (closest NtC " << LLKA_NtCToName(ntc) << ")\n"
-        << "delta_1:   " << diffs.delta_1 << "\n"
-        << "epsilon_1: " << diffs.epsilon_1 << "\n"
-        << "zeta_1:    " << diffs.zeta_1 << "\n"
-        << "alpha_2:   " << diffs.alpha_2 << "\n"
-        << "beta_2:    " << diffs.beta_2 << "\n"
-        << "gamma_2:   " << diffs.gamma_2 << "\n"
-        << "delta_2:   " << diffs.delta_2 << "\n"
-        << "chi_1:     " << diffs.chi_1 << "\n"
-        << "chi_2:     " << diffs.chi_2 << "\n"
-        << "CC:        " << diffs.CC << "\n"
-        << "NN:        " << diffs.NN << "\n"
-        << "mu:        " << diffs.mu << "\n";
+    oss << "Differences between NtC averages (closest NtC " << LLKA_NtCToName(LLKA_NtC(record.indices[0])) << ")\n";
+    formatStepMetrics(oss, record, 1);
 
     return oss.str();
 }
+
+ECHMET_MAKE_TRACEPOINT_NOINLINE(
+    LLKATracing, GOLDEN_STEP_REJECTED_TOLERANCE_EXCEEDED, "Golden step was rejected as neighbor because some metrics exceeds tolerance",
+    "values: actual, low, high; indices: metrics index, cluster index, cluster NtC"
+)
+ECHMET_BEGIN_MAKE_LOGGER(LLKATracing, GOLDEN_STEP_REJECTED_TOLERANCE_EXCEEDED, double actual, double low, double high, size_t metricsIdx, size_t clusterIdx, std::span<const LLKA_ClassificationCluster> clusters)
+{
+    record.addValue(actual);
+    record.addValue(low);
+    record.addValue(high);
+    record.addIndex(metricsIdx);
+    record.addIndex(clusterIdx);
+    record.addIndex(clusters[clusterIdx].NtC);
+}
 ECHMET_END_MAKE_LOGGER
 
-ECHMET_MAKE_TRACEPOINT_NOINLINE(LLKATracing, GOLDEN_STEP_REJECTED_TOLERANCE_EXCEEDED, "Golden step was rejected as neighbor because some metrics exceeds tolerance")
-ECHMET_BEGIN_MAKE_LOGGER(LLKATracing, GOLDEN_STEP_REJECTED_TOLERANCE_EXCEEDED, double actual, double low, double high, size_t metricsIdx, size_t clusterIdx, const std::vector<LLKA_ClassificationCluster> &clusters)
+ECHMET_MAKE_FORMATTER_NOINLINE(LLKATracing, GOLDEN_STEP_REJECTED_TOLERANCE_EXCEEDED, record)
 {
     std::ostringstream oss{};
 
     oss
-        << "Rejecting cluster " << clusterIdx << " (" << LLKA_NtCToName(clusters[clusterIdx].NtC) << ") " << " because metrics " << metricsIdx << " exceeds tolerance (low, actual, high): [ "
-        << low << "; " << actual << "; " << high << " ]\n";
+        << "Rejecting cluster " << record.indices[1] << " (" << LLKA_NtCToName(LLKA_NtC(record.indices[2])) << ") " << " because metrics " << record.indices[0] << " exceeds tolerance (low, actual, high): [ "
+        << record.values[1] << "; " << record.values[0] << "; " << record.values[2] << " ]\n";
 
     return oss.str();
 }
-ECHMET_END_MAKE_LOGGER
 
-ECHMET_MAKE_TRACEPOINT_NOINLINE(LLKATracing, DETAILS_STEPS_WITH_NO_NEIGHBORS, "Print detailed information about step that does not have any neighbors")
+ECHMET_MAKE_TRACEPOINT_NOINLINE(
+    LLKATracing, DETAILS_STEPS_WITH_NO_NEIGHBORS, "Print detailed information about step that does not have any neighbors",
+    "values: 12 step metrics ordered as delta_1, epsilon_1, zeta_1, alpha_2, beta_2, gamma_2, delta_2, chi_1, chi_2, CC, NN, mu; text: the step"
+)
 ECHMET_BEGIN_MAKE_LOGGER(LLKATracing, DETAILS_STEPS_WITH_NO_NEIGHBORS, const LLKA_Structure &step, const LLKA_StepMetrics &metrics)
 {
     std::ostringstream oss{};
+    oss << step;
 
-    oss
-        << "--- This step does not have any neighbors ---\n" << step << "\n"
-        << "delta_1:   " << metrics.delta_1 << "\n"
-        << "epsilon_1: " << metrics.epsilon_1 << "\n"
-        << "zeta_1:    " << metrics.zeta_1 << "\n"
-        << "alpha_2:   " << metrics.alpha_2 << "\n"
-        << "beta_2:    " << metrics.beta_2 << "\n"
-        << "gamma_2:   " << metrics.gamma_2 << "\n"
-        << "delta_2:   " << metrics.delta_2 << "\n"
-        << "chi_1:     " << metrics.chi_1 << "\n"
-        << "chi_2:     " << metrics.chi_2 << "\n"
-        << "CC:        " << metrics.CC << "\n"
-        << "NN:        " << metrics.NN << "\n"
-        << "mu:        " << metrics.mu << "\n";
+    recordStepMetrics(record, metrics);
+    record.text = oss.str();
+}
+ECHMET_END_MAKE_LOGGER
+
+ECHMET_MAKE_FORMATTER_NOINLINE(LLKATracing, DETAILS_STEPS_WITH_NO_NEIGHBORS, record)
+{
+    std::ostringstream oss{};
+
+    oss << "--- This step does not have any neighbors ---\n" << record.text << "\n";
+    formatStepMetrics(oss, record, 1);
 
     return oss.str();
 }
-ECHMET_END_MAKE_LOGGER
 
-ECHMET_MAKE_TRACEPOINT_NOINLINE(LLKATracing, BESTIE_CLUSTER_INFO, "Information about the chosen classification cluster")
+ECHMET_MAKE_TRACEPOINT_NOINLINE(
+    LLKATracing, BESTIE_CLUSTER_INFO, "Information about the chosen classification cluster",
+    "indices: cluster number, NtC, CANA, flags (bit 0: not enough nearest neighbors, bit 1: not enough votes)"
+)
 ECHMET_BEGIN_MAKE_LOGGER(LLKATracing, BESTIE_CLUSTER_INFO, const LLKA_ClassificationCluster &cluster, const bool notEnoughNN, const bool notEnoughVotes)
+{
+    record.addIndex(cluster.number);
+    record.addIndex(cluster.NtC);
+    record.addIndex(cluster.CANA);
+    record.addIndex(int64_t(notEnoughNN) | (int64_t(notEnoughVotes) << 1));
+}
+ECHMET_END_MAKE_LOGGER
+
+ECHMET_MAKE_FORMATTER_NOINLINE(LLKATracing, BESTIE_CLUSTER_INFO, record)
 {
     std::ostringstream oss{};
 
+    const bool notEnoughNN = record.indices[3] & 1;
+    const bool notEnoughVotes = record.indices[3] & 2;
+
     oss
-        << "Selected best matching cluster: " << cluster.number << ", " << LLKA_NtCToName(cluster.NtC) << ", " << LLKA_CANAToName(cluster.CANA) << "\n"
+        << "Selected best matching cluster: " << record.indices[0] << ", " << LLKA_NtCToName(LLKA_NtC(record.indices[1])) << ", " << LLKA_CANAToName(LLKA_CANA(record.indices[2])) << "\n"
         << "Selected from enough neighbors: " << (notEnoughNN ? "No" : "Yes") << "\n"
         << "Got enough votes: " << (notEnoughVotes ? "No" : "Yes") << "\n";
 
     return oss.str();
 }
-ECHMET_END_MAKE_LOGGER
 
-ECHMET_MAKE_TRACEPOINT_NOINLINE(LLKATracing, PSEUDOROTATION_TOO_DIFFERENT, "Details about pseudorotations exceeding tolerance")
+ECHMET_MAKE_TRACEPOINT_NOINLINE(
+    LLKATracing, PSEUDOROTATION_TOO_DIFFERENT, "Details about pseudorotations exceeding tolerance",
+    "values: actual, reference and difference of the first pseudorotation, the same for the second pseudorotation, tolerance"
+)
 ECHMET_BEGIN_MAKE_LOGGER(LLKATracing, PSEUDOROTATION_TOO_DIFFERENT, double actual1, double reference1, double difference1, double actual2, double reference2, double difference2, double tolerance)
+{
+    for (const auto v : { actual1, reference1, difference1, actual2, reference2, difference2, tolerance })
+        record.addValue(v);
+}
+ECHMET_END_MAKE_LOGGER
+
+ECHMET_MAKE_FORMATTER_NOINLINE(LLKATracing, PSEUDOROTATION_TOO_DIFFERENT, record)
 {
     std::ostringstream oss{};
 
+    const auto &v = record.values;
+    const double tolerance = v[6];
+
     oss
-        << "Pseudorotation 1 (actual, ref, diff): " << actual1 << ", " << reference1 << ", " << difference1 << (difference1 > tolerance ? " (exceeds)" : "") << "\n"
-        << "Pseudorotation 2 (actual, ref, diff): " << actual2 << ", " << reference2 << ", " << difference2 << (difference2 > tolerance ? " (exceeds)" : "") << "\n"
+        << "Pseudorotation 1 (actual, ref, diff): " << v[0] << ", " << v[1] << ", " << v[2] << (v[2] > tolerance ? " (exceeds)" : "") << "\n"
+        << "Pseudorotation 2 (actual, ref, diff): " << v[3] << ", " << v[4] << ", " << v[5] << (v[5] > tolerance ? " (exceeds)" : "") << "\n"
         << "Maximum difference: " << tolerance << "\n";
 
     return oss.str();
 }
+
+ECHMET_MAKE_TRACEPOINT_NOINLINE(
+    LLKATracing, CLOSEST_GOLDEN_STEP_INFO, "Details about the closest golden step",
+    "indices: cluster NtC, cluster CANA; label: golden step name"
+)
+ECHMET_BEGIN_MAKE_LOGGER(LLKATracing, CLOSEST_GOLDEN_STEP_INFO, const LLKA_GoldenStep &gs, const char *name, std::span<const LLKA_ClassificationCluster> clusters)
+{
+    record.addIndex(clusters[gs.clusterIdx].NtC);
+    record.addIndex(clusters[gs.clusterIdx].CANA);
+    record.setLabel(name);
+}
 ECHMET_END_MAKE_LOGGER
 
-ECHMET_MAKE_TRACEPOINT_NOINLINE(LLKATracing, CLOSEST_GOLDEN_STEP_INFO, "Details about the closest golden step")
-ECHMET_BEGIN_MAKE_LOGGER(LLKATracing, CLOSEST_GOLDEN_STEP_INFO, const LLKA_GoldenStep &gs, const std::vector<LLKA_ClassificationCluster> &clusters)
+ECHMET_MAKE_FORMATTER_NOINLINE(LLKATracing, CLOSEST_GOLDEN_STEP_INFO, record)
 {
     std::ostringstream oss{};
 
     oss
         << " --- Closest golden step ---\n"
-        << "Name: " << gs.name << "\n"
-        << "Cluster NtC: " << LLKA_NtCToName(clusters[gs.clusterIdx].NtC) << "\n"
-        << "Cluster CANA: " << LLKA_CANAToName(clusters[gs.clusterIdx].CANA) << "\n";
+        << "Name: " << record.label.data() << "\n"
+        << "Cluster NtC: " << LLKA_NtCToName(LLKA_NtC(record.indices[0])) << "\n"
+        << "Cluster CANA: " << LLKA_CANAToName(LLKA_CANA(record.indices[1])) << "\n";
 
     return oss.str();
 }
-ECHMET_END_MAKE_LOGGER
 
 } // namespace ECHMET
 
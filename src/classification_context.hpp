@@ -0,0 +1,120 @@
+// vim: set sw=4 ts=4 sts=4 expandtab :
+
+#ifndef _LLKA_CLASSIFICATION_CONTEXT_HPP
+#define _LLKA_CLASSIFICATION_CONTEXT_HPP
+
+#include <llka_classification.h>
+
+#include "util/elementaries.h"
+
+#include <array>
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace LLKAInternal {
+
+inline constexpr size_t NUM_CONFAL_METRICS = 12;
+
+/*
+ * Per-cluster coefficients -1 / (2 * sigma^2) of the confal score Gaussians,
+ * ordered as CONFAL_STEP_METRIC_CLSPTRS. Coefficients of angular metrics also include
+ * the conversion of radians to degrees.
+ */
+using ConfalCoefficients = std::array<double, NUM_CONFAL_METRICS>;
+
+inline constexpr size_t NUM_CLASSIFICATION_TORSIONS = 9;
+
+/*
+ * Sines and cosines of the torsions of a golden step,
+ * ordered as ALL_TORSIONS_STEP_METRIC_CLSPTRS.
+ */
+class GoldenStepTorsionsTrig {
+public:
+    std::array<double, NUM_CLASSIFICATION_TORSIONS> sines;
+    std::array<double, NUM_CLASSIFICATION_TORSIONS> cosines;
+};
+
+inline
+auto areClassificationLimitsValid(const LLKA_ClassificationLimits &limits) -> bool
+{
+    return
+        limits.averageNeighborsTorsionCutoff > 0.0 && limits.nearestNeighborTorsionsCutoff > 0.0 && limits.totalDistanceCutoff > 0.0 && limits.pseudorotationCutoff > 0.0 &&
+        limits.minimumClusterVotes > 0.0 &&
+        limits.minimumNearestNeighbors >= 1 && limits.numberOfUsedNearestNeighbors >= limits.minimumNearestNeighbors;
+}
+
+/*
+ * Tables of a classification context that was initialized from the reference data.
+ */
+class ClassificationContextStorage {
+public:
+    ClassificationContextStorage() = default;
+    ClassificationContextStorage(const ClassificationContextStorage &) = delete;
+
+    ~ClassificationContextStorage()
+    {
+        for (auto &gs : goldenSteps)
+            destroyString(gs.name);
+    }
+
+    auto operator=(const ClassificationContextStorage &) -> ClassificationContextStorage & = delete;
+
+    std::vector<LLKA_GoldenStep> goldenSteps{};
+    std::vector<GoldenStepTorsionsTrig> goldenStepsTorsionsTrig{};
+    std::vector<LLKA_ClassificationCluster> clusters{};
+    std::vector<LLKA_Confal> confals{};
+    std::vector<ConfalCoefficients> confalCoefficients{};
+    std::vector<double> confalPercentiles{};
+};
+
+/*
+ * Finishes initialization of a context whose storage already contains the clusters and the golden steps.
+ * Clusters and golden steps are processed in place and the context takes ownership of the names of the golden steps.
+ */
+auto initializeClassificationContext(
+    LLKA_ClassificationContext &ctx,
+    const std::span<const LLKA_Confal> &confals,
+    const std::span<const LLKA_ClusterNuAngles> &clusterNuAngles,
+    const std::span<const LLKA_ConfalPercentile> &confalPercentiles,
+    const LLKA_ClassificationLimits &limits,
+    double maxCloseEnoughRmsd
+) -> LLKA_RetCode;
+
+} // namespace LLKAInternal
+
+/*
+ * The classifier reads the tables only through the spans. These point either to the storage
+ * of the context or directly into a snapshot of a context (see classification_snapshot.cpp).
+ */
+struct LLKA_ClassificationContext {
+    auto bindStorage() -> void
+    {
+        goldenSteps = storage.goldenSteps;
+        goldenStepsTorsionsTrig = storage.goldenStepsTorsionsTrig;
+        clusters = storage.clusters;
+        confals = storage.confals;
+        confalCoefficients = storage.confalCoefficients;
+        confalPercentiles = storage.confalPercentiles;
+
+        goldenStepNames.resize(storage.goldenSteps.size());
+        for (size_t idx = 0; idx < storage.goldenSteps.size(); idx++)
+            goldenStepNames[idx] = storage.goldenSteps[idx].name;
+    }
+
+    std::span<const LLKA_GoldenStep> goldenSteps{};                               // Use goldenStepNames to get the names of the golden steps
+    std::vector<const char *> goldenStepNames{};                                  // Indexed the same as goldenSteps
+    std::span<const LLKAInternal::GoldenStepTorsionsTrig> goldenStepsTorsionsTrig{}; // Indexed the same as goldenSteps
+    std::span<const LLKA_ClassificationCluster> clusters{};
+    std::span<const LLKA_Confal> confals{};
+    std::span<const LLKAInternal::ConfalCoefficients> confalCoefficients{};
+    std::span<const double> confalPercentiles{};
+    LLKA_ClassificationLimits limits;
+
+    double maxCloseEnoughRmsd;
+
+    LLKAInternal::ClassificationContextStorage storage{};
+    std::shared_ptr<const void> snapshot{}; // Keeps the memory of a mapped snapshot alive
+};
+
+#endif // _LLKA_CLASSIFICATION_CONTEXT_HPP
@@ -0,0 +1,334 @@
+/* vim: set sw=4 ts=4 sts=4 expandtab : */
+
+#include <llka_classification.h>
+
+#include "classification_context.hpp"
+
+#ifndef LLKA_FILESYSTEM_ACCESS_DISABLED
+#include "util/mapped_file.hpp"
+#endif // LLKA_FILESYSTEM_ACCESS_DISABLED
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <span>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#ifndef LLKA_FILESYSTEM_ACCESS_DISABLED
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <system_error>
+#endif // LLKA_FILESYSTEM_ACCESS_DISABLED
+
+/*
+ * Snapshot of a classification context is a single block of memory that begins with a SnapshotHeader.
+ * The header is followed by sections that contain the tables of the context exactly as the classifier
+ * uses them. A snapshot can therefore be used in place without any parsing or copying.
+ * Each section begins at an offset that is a multiple of SNAPSHOT_SECTION_ALIGNMENT.
+ *
+ * The records are stored in the native memory layout. A snapshot is thus usable only by builds
+ * of the library that have the same memory layout of the records. This is checked with the layout fingerprint.
+ */
+
+namespace LLKAInternal {
+
+inline constexpr std::array<char, 8> SNAPSHOT_MAGIC{ 'L', 'L', 'K', 'A', 'C', 'T', 'X', '\0' };
+inline constexpr uint32_t SNAPSHOT_VERSION = 1;
+inline constexpr uint64_t SNAPSHOT_SECTION_ALIGNMENT = 64;
+
+enum SnapshotSectionId : size_t {
+    SNAP_GOLDEN_STEPS,
+    SNAP_GOLDEN_STEPS_TORSIONS_TRIG,
+    SNAP_GOLDEN_STEP_NAME_OFFSETS,
+    SNAP_GOLDEN_STEP_NAMES,
+    SNAP_CLUSTERS,
+    SNAP_CONFALS,
+    SNAP_CONFAL_COEFFICIENTS,
+    SNAP_CONFAL_PERCENTILES,
+    NUM_SNAPSHOT_SECTIONS
+};
+
+class SnapshotSection {
+public:
+    uint64_t offset;
+    uint64_t count;
+};
+
+class SnapshotHeader {
+public:
+    std::array<char, 8> magic;
+    uint32_t version;
+    uint32_t layoutFingerprint;
+    uint64_t size;
+    std::array<SnapshotSection, NUM_SNAPSHOT_SECTIONS> sections;
+    LLKA_ClassificationLimits limits;
+    double maxCloseEnoughRmsd;
+};
+
+// Memory returned by the allocator and the mapped files is always aligned at least this strictly
+inline constexpr size_t SNAPSHOT_BASE_ALIGNMENT = std::max({
+    alignof(SnapshotHeader), alignof(LLKA_GoldenStep), alignof(GoldenStepTorsionsTrig),
+    alignof(LLKA_ClassificationCluster), alignof(LLKA_Confal), alignof(ConfalCoefficients)
+});
+static_assert(SNAPSHOT_SECTION_ALIGNMENT % SNAPSHOT_BASE_ALIGNMENT == 0);
+
+static
+constexpr auto snapshotLayoutFingerprint() -> uint32_t
+{
+    const std::array<uint64_t, 16> traits{
+        sizeof(void *),
+        std::endian::native == std::endian::little,
+        sizeof(SnapshotHeader),
+        sizeof(LLKA_GoldenStep), alignof(LLKA_GoldenStep),
+        sizeof(GoldenStepTorsionsTrig), alignof(GoldenStepTorsionsTrig),
+        sizeof(LLKA_ClassificationCluster), alignof(LLKA_ClassificationCluster),
+        sizeof(LLKA_Confal), alignof(LLKA_Confal),
+        sizeof(ConfalCoefficients), alignof(ConfalCoefficients),
+        sizeof(LLKA_ClassificationLimits),
+        NUM_CONFAL_METRICS,
+        NUM_CLASSIFICATION_TORSIONS
+    };
+
+    // FNV-1a
+    uint32_t hash = 2166136261u;
+    for (auto t : traits) {
+        for (int byte = 0; byte < 8; byte++) {
+            hash ^= uint32_t(t & 0xFF);
+            hash *= 16777619u;
+            t >>= 8;
+        }
+    }
+
+    return hash;
+}
+
+inline constexpr uint32_t SNAPSHOT_LAYOUT_FINGERPRINT = snapshotLayoutFingerprint();
+
+template <typename T>
+static
+auto sectionFits(const SnapshotSection &section, const uint64_t size) -> bool
+{
+    if (section.offset % SNAPSHOT_SECTION_ALIGNMENT != 0 || section.offset > size)
+        return false;
+    return section.count <= (size - section.offset) / sizeof(T);
+}
+
+template <typename T>
+static
+auto sectionSpan(const char *base, const SnapshotSection &section) -> std::span<const T>
+{
+    return { reinterpret_cast<const T *>(base + section.offset), size_t(section.count) };
+}
+
+static
+auto bindSnapshot(const void *data, const size_t size, LLKA_ClassificationContext &ctx) -> LLKA_RetCode
+{
+    if (reinterpret_cast<uintptr_t>(data) % SNAPSHOT_BASE_ALIGNMENT != 0)
+        return LLKA_E_INVALID_ARGUMENT;
+    if (size < sizeof(SnapshotHeader))
+        return LLKA_E_BAD_DATA;
+
+    const auto base = static_cast<const char *>(data);
+    const auto &header = *reinterpret_cast<const SnapshotHeader *>(base);
+
+    if (header.magic != SNAPSHOT_MAGIC || header.version != SNAPSHOT_VERSION || header.layoutFingerprint != SNAPSHOT_LAYOUT_FINGERPRINT)
+        return LLKA_E_BAD_DATA;
+    if (header.size != size)
+        return LLKA_E_BAD_DATA;
+
+    const auto &sections = header.sections;
+    if (
+        !sectionFits<LLKA_GoldenStep>(sections[SNAP_GOLDEN_STEPS], size) ||
+        !sectionFits<GoldenStepTorsionsTrig>(sections[SNAP_GOLDEN_STEPS_TORSIONS_TRIG], size) ||
+        !sectionFits<uint64_t>(sections[SNAP_GOLDEN_STEP_NAME_OFFSETS], size) ||
+        !sectionFits<char>(sections[SNAP_GOLDEN_STEP_NAMES], size) ||
+        !sectionFits<LLKA_ClassificationCluster>(sections[SNAP_CLUSTERS], size) ||
+        !sectionFits<LLKA_Confal>(sections[SNAP_CONFALS], size) ||
+        !sectionFits<ConfalCoefficients>(sections[SNAP_CONFAL_COEFFICIENTS], size) ||
+        !sectionFits<double>(sections[SNAP_CONFAL_PERCENTILES], size)
+    )
+        return LLKA_E_BAD_DATA;
+
+    const auto nGoldenSteps = sections[SNAP_GOLDEN_STEPS].count;
+    const auto nClusters = sections[SNAP_CLUSTERS].count;
+    if (nGoldenSteps == 0 || nClusters == 0)
+        return LLKA_E_BAD_DATA;
+    if (sections[SNAP_GOLDEN_STEPS_TORSIONS_TRIG].count != nGoldenSteps || sections[SNAP_GOLDEN_STEP_NAME_OFFSETS].count != nGoldenSteps)
+        return LLKA_E_BAD_DATA;
+    if (sections[SNAP_CONFALS].count != nClusters || sections[SNAP_CONFAL_COEFFICIENTS].count != nClusters)
+        return LLKA_E_BAD_DATA;
+    if (sections[SNAP_CONFAL_PERCENTILES].count != 101)
+        return LLKA_E_BAD_DATA;
+    if (!areClassificationLimitsValid(header.limits) || !(header.maxCloseEnoughRmsd > 0.0))
+        return LLKA_E_BAD_DATA;
+
+    const auto goldenSteps = sectionSpan<LLKA_GoldenStep>(base, sections[SNAP_GOLDEN_STEPS]);
+    for (const auto &gs : goldenSteps) {
+        if (gs.clusterIdx >= nClusters)
+            return LLKA_E_BAD_DATA;
+    }
+
+    // Every name must be terminated within the section. This holds if the offsets are in range and the last character is a terminator.
+    const auto nameOffsets = sectionSpan<uint64_t>(base, sections[SNAP_GOLDEN_STEP_NAME_OFFSETS]);
+    const auto names = sectionSpan<char>(base, sections[SNAP_GOLDEN_STEP_NAMES]);
+    if (names.empty() || names.back() != '\0')
+        return LLKA_E_BAD_DATA;
+
+    ctx.goldenStepNames.resize(nGoldenSteps);
+    for (size_t idx = 0; idx < nGoldenSteps; idx++) {
+        if (nameOffsets[idx] >= names.size())
+            return LLKA_E_BAD_DATA;
+        ctx.goldenStepNames[idx] = names.data() + nameOffsets[idx];
+    }
+
+    ctx.goldenSteps = goldenSteps;
+    ctx.goldenStepsTorsionsTrig = sectionSpan<GoldenStepTorsionsTrig>(base, sections[SNAP_GOLDEN_STEPS_TORSIONS_TRIG]);
+    ctx.clusters = sectionSpan<LLKA_ClassificationCluster>(base, sections[SNAP_CLUSTERS]);
+    ctx.confals = sectionSpan<LLKA_Confal>(base, sections[SNAP_CONFALS]);
+    ctx.confalCoefficients = sectionSpan<ConfalCoefficients>(base, sections[SNAP_CONFAL_COEFFICIENTS]);
+    ctx.confalPercentiles = sectionSpan<double>(base, sections[SNAP_CONFAL_PERCENTILES]);
+    ctx.limits = header.limits;
+    ctx.maxCloseEnoughRmsd = header.maxCloseEnoughRmsd;
+
+    return LLKA_OK;
+}
+
+#ifndef LLKA_FILESYSTEM_ACCESS_DISABLED
+static
+auto makeSnapshot(const LLKA_ClassificationContext &ctx) -> std::vector<char>
+{
+    // Golden steps are stored without the pointers to their names, the names are stored separately
+    std::vector<LLKA_GoldenStep> goldenSteps{ctx.goldenSteps.begin(), ctx.goldenSteps.end()};
+    std::vector<uint64_t> nameOffsets(goldenSteps.size());
+    std::string names{};
+    for (size_t idx = 0; idx < goldenSteps.size(); idx++) {
+        goldenSteps[idx].name = nullptr;
+        nameOffsets[idx] = names.size();
+        names += ctx.goldenStepNames[idx];
+        names.push_back('\0');
+    }
+
+    SnapshotHeader header{};
+    header.magic = SNAPSHOT_MAGIC;
+    header.version = SNAPSHOT_VERSION;
+    header.layoutFingerprint = SNAPSHOT_LAYOUT_FINGERPRINT;
+    header.limits = ctx.limits;
+    header.maxCloseEnoughRmsd = ctx.maxCloseEnoughRmsd;
+
+    const std::array<std::tuple<const void *, uint64_t, uint64_t>, NUM_SNAPSHOT_SECTIONS> contents{{
+        { goldenSteps.data(), goldenSteps.size(), sizeof(LLKA_GoldenStep) },
+        { ctx.goldenStepsTorsionsTrig.data(), ctx.goldenStepsTorsionsTrig.size(), sizeof(GoldenStepTorsionsTrig) },
+        { nameOffsets.data(), nameOffsets.size(), sizeof(uint64_t) },
+        { names.data(), names.size(), sizeof(char) },
+        { ctx.clusters.data(), ctx.clusters.size(), sizeof(LLKA_ClassificationCluster) },
+        { ctx.confals.data(), ctx.confals.size(), sizeof(LLKA_Confal) },
+        { ctx.confalCoefficients.data(), ctx.confalCoefficients.size(), sizeof(ConfalCoefficients) },
+        { ctx.confalPercentiles.data(), ctx.confalPercentiles.size(), sizeof(double) }
+    }};
+
+    uint64_t size = sizeof(SnapshotHeader);
+    for (size_t idx = 0; idx < NUM_SNAPSHOT_SECTIONS; idx++) {
+        const auto &[_, count, itemSize] = contents[idx];
+
+        size = (size + SNAPSHOT_SECTION_ALIGNMENT - 1) / SNAPSHOT_SECTION_ALIGNMENT * SNAPSHOT_SECTION_ALIGNMENT;
+        header.sections[idx] = { .offset = size, .count = count };
+        size += count * itemSize;
+    }
+    header.size = size;
+
+    std::vector<char> snapshot(size, 0);
+    std::memcpy(snapshot.data(), &header, sizeof(SnapshotHeader));
+    for (size_t idx = 0; idx < NUM_SNAPSHOT_SECTIONS; idx++) {
+        const auto &[src, count, itemSize] = contents[idx];
+        if (count > 0)
+            std::memcpy(snapshot.data() + header.sections[idx].offset, src, count * itemSize);
+    }
+
+    return snapshot;
+}
+#endif // LLKA_FILESYSTEM_ACCESS_DISABLED
+
+} // namespace LLKAInternal
+
+LLKA_RetCode LLKA_CC LLKA_classificationContextFromSnapshot(const void *data, size_t size, LLKA_ClassificationContext **ctx)
+{
+    if (data == nullptr)
+        return LLKA_E_INVALID_ARGUMENT;
+
+    auto _ctx = std::make_unique<LLKA_ClassificationContext>();
+    auto tRet = LLKAInternal::bindSnapshot(data, size, *_ctx);
+    if (tRet != LLKA_OK)
+        return tRet;
+
+    *ctx = _ctx.release();
+
+    return LLKA_OK;
+}
+
+#ifndef LLKA_FILESYSTEM_ACCESS_DISABLED
+LLKA_RetCode LLKA_CC LLKA_mapClassificationContext(const LLKA_PathChar *path, LLKA_ClassificationContext **ctx)
+{
+    try {
+        auto mapped = std::make_shared<LLKAInternal::MappedFile>(LLKAInternal::MappedFile::map(path));
+
+        auto _ctx = std::make_unique<LLKA_ClassificationContext>();
+        auto tRet = LLKAInternal::bindSnapshot(mapped->data(), mapped->size(), *_ctx);
+        if (tRet != LLKA_OK)
+            return tRet;
+        _ctx->snapshot = std::move(mapped);
+
+        *ctx = _ctx.release();
+
+        return LLKA_OK;
+    } catch (const LLKA_RetCode tRet) {
+        return tRet;
+    }
+}
+
+LLKA_RetCode LLKA_CC LLKA_saveClassificationContext(const LLKA_ClassificationContext *ctx, const LLKA_PathChar *path)
+{
+    const auto snapshot = LLKAInternal::makeSnapshot(*ctx);
+
+    // Write the snapshot to a temporary file first and then move it in place. Processes that have
+    // the previous version of the file mapped keep reading the old data instead of crashing
+    // on a file that is being truncated under them.
+    // The temporary file gets a random suffix so that concurrent writers of the same snapshot
+    // do not write into each other's temporary file.
+    const std::filesystem::path target{path};
+    std::filesystem::path temporary{target};
+    std::random_device rd{};
+    char suffix[32];
+    std::snprintf(suffix, sizeof(suffix), ".%08x%08x.tmp", unsigned(rd()), unsigned(rd()));
+    temporary += suffix;
+
+    {
+        std::ofstream ofs{temporary, std::ios::binary | std::ios::trunc};
+        if (!ofs)
+            return LLKA_E_CANNOT_WRITE_FILE;
+
+        ofs.write(snapshot.data(), std::streamsize(snapshot.size()));
+        ofs.close();
+        if (!ofs) {
+            std::error_code ec{};
+            std::filesystem::remove(temporary, ec);
+            return LLKA_E_CANNOT_WRITE_FILE;
+        }
+    }
+
+    std::error_code ec{};
+    std::filesystem::rename(temporary, target, ec);
+    if (ec) {
+        std::filesystem::remove(temporary, ec);
+        return LLKA_E_CANNOT_WRITE_FILE;
+    }
+
+    return LLKA_OK;
+}
+#endif // LLKA_FILESYSTEM_ACCESS_DISABLED
@@ -6,9 +6,11 @@
 
 #include "ntc_constants.h"
 #include "similarity.h"
+#include "superposition.hpp"
 #include "util/geometry.h"
 #include "util/templates.hpp"
 
+#include <array>
 #include <cassert>
 #include <memory>
 
@@ -79,6 +81,33 @@ auto measureStepConnectivity(const TA *bkbnPositionFirst, LLKA_Structure *bkbnFi
     return LLKA_OK;
 }
 
+static
+auto metricsEuclideanDistance(const LLKA_StepMetrics &stepMetrics, const LLKA_StepMetrics &refMetrics)
+{
+    double dist = 0;
+    // Dinucleotide torsions
+    for (
+        const auto &clsPtr :
+        { &LLKA_StepMetrics::delta_1, &LLKA_StepMetrics::epsilon_1, &LLKA_StepMetrics::zeta_1, &LLKA_StepMetrics::alpha_2, &LLKA_StepMetrics::beta_2,
+          &LLKA_StepMetrics::gamma_2, &LLKA_StepMetrics::delta_2, &LLKA_StepMetrics::chi_1, &LLKA_StepMetrics::chi_2 }
+    ) {
+        auto angDiff = LLKAInternal::R2D(LLKAInternal::angleDifference(stepMetrics.*clsPtr, refMetrics.*clsPtr));
+        dist += angDiff * angDiff;
+    }
+    // Cross-residue torsion
+    auto aux = LLKAInternal::R2D(LLKAInternal::angleDifference(stepMetrics.mu, refMetrics.mu));
+    dist += aux * aux;
+
+    // Cross-residue distances
+    aux = XR_DISTANCE_MULTIPLIER * std::abs(stepMetrics.CC - refMetrics.CC);
+    dist += aux * aux;
+
+    aux = XR_DISTANCE_MULTIPLIER * std::abs(stepMetrics.NN - refMetrics.NN);
+    dist += aux * aux;
+
+    return std::sqrt(dist);
+}
+
 template <LLKAStructureType T>
 static
 auto measureStepSimilarity(const LLKA_StepMetrics &stepMetrics, const T *bkbnStepStru, const LLKA_Structure *rmsdRefStru, const LLKA_StepMetrics &refMetrics, LLKA_Similarity *result)
@@ -101,28 +130,31 @@ auto measureStepSimilarity(const LLKA_StepMetrics &stepMetrics, const T *bkbnSte
     }
     LLKA_destroyStructure(&bkbnRmsdRefStru);
 
-    result->euclideanDistance = 0;
-    // Dinucleotide torsions
-    for (
-        const auto &clsPtr :
-        { &LLKA_StepMetrics::delta_1, &LLKA_StepMetrics::epsilon_1, &LLKA_StepMetrics::zeta_1, &LLKA_StepMetrics::alpha_2, &LLKA_StepMetrics::beta_2,
-          &LLKA_StepMetrics::gamma_2, &LLKA_StepMetrics::delta_2, &LLKA_StepMetrics::chi_1, &LLKA_StepMetrics::chi_2 }
-    ) {
-        auto angDiff = LLKAInternal::R2D(LLKAInternal::angleDifference(stepMetrics.*clsPtr, refMetrics.*clsPtr));
-        result->euclideanDistance += angDiff * angDiff;
-    }
-    // Cross-residue torsion
-    auto aux = LLKAInternal::R2D(LLKAInternal::angleDifference(stepMetrics.mu, refMetrics.mu));
-    result->euclideanDistance += aux * aux;
+    result->euclideanDistance = metricsEuclideanDistance(stepMetrics, refMetrics);
 
-    // Cross-residue distances
-    aux = XR_DISTANCE_MULTIPLIER * std::abs(stepMetrics.CC - refMetrics.CC);
-    result->euclideanDistance += aux * aux;
+    return LLKA_OK;
+}
 
-    aux = XR_DISTANCE_MULTIPLIER * std::abs(stepMetrics.NN - refMetrics.NN);
-    result->euclideanDistance += aux * aux;
+static
+auto measureStepSimilarityNtC(const LLKA_StepMetrics &stepMetrics, const LLKA_StructureView *bkbnStepStru, LLKA_NtC ntc, LLKA_Similarity *result)
+{
+    const auto &refBkbn = NTC_REFERENCE_BACKBONES[ntc];
+    if (bkbnStepStru->nAtoms != refBkbn.points.size())
+        return LLKA_E_MISMATCHING_SIZES;
+
+    std::array<LLKA_Point, LLKABones::NUM_EXTENDED_ATOMS> pts;
+    for (size_t idx = 0; idx < pts.size(); idx++)
+        pts[idx] = bkbnStepStru->atoms[idx]->coords;
 
-    result->euclideanDistance = std::sqrt(result->euclideanDistance);
+    // Reference backbones are stored centered so there is nothing to extract
+    ConstMappedPointsUnaligned mPts(&pts[0].x, 3, pts.size());
+    ConstMappedPointsUnaligned mRef(&refBkbn.points[0].x, 3, refBkbn.points.size());
+
+    auto tRet = superposedRmsdOntoCentered(mPts, mRef, &result->rmsd);
+    if (tRet != LLKA_OK)
+        return tRet;
+
+    result->euclideanDistance = metricsEuclideanDistance(stepMetrics, averagesToMetrics(NTC_AVERAGES[ntc]));
 
     return LLKA_OK;
 }
@@ -344,10 +376,7 @@ LLKA_RetCode LLKA_CC LLKA_measureStepSimilarityNtC(const LLKA_Structure *stepStr
     if (tRet != LLKA_OK)
         return tRet;
 
-    const auto &refStru = LLKAInternal::NTC_REFERENCES[ntc];
-    const auto &refMetrics = averagesToMetrics(LLKAInternal::NTC_AVERAGES[ntc]);
-
-    tRet = LLKAInternal::measureStepSimilarity(stepMetrics, &bkbnStepStru, &refStru, refMetrics, result);
+    tRet = LLKAInternal::measureStepSimilarityNtC(stepMetrics, &bkbnStepStru, ntc, result);
     LLKA_destroyStructureView(&bkbnStepStru);
 
     return tRet;
@@ -371,11 +400,7 @@ LLKA_RetCode LLKA_CC LLKA_measureStepSimilarityNtCMultiple(const LLKA_Structure
         if (idx >= results->nSimilars)
             return LLKA_E_MISMATCHING_SIZES;
 
-        const auto ntc = ntcs[idx];
-        const auto &refStru = LLKAInternal::NTC_REFERENCES[ntc];
-        const auto &refMetrics = averagesToMetrics(LLKAInternal::NTC_AVERAGES[ntc]);
-
-        tRet = LLKAInternal::measureStepSimilarity(stepMetrics, &bkbnStepStru, &refStru, refMetrics, &results->similars[idx]);
+        tRet = LLKAInternal::measureStepSimilarityNtC(stepMetrics, &bkbnStepStru, ntcs[idx], &results->similars[idx]);
         if (tRet != LLKA_OK)
             goto out;
 
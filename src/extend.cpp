@@ -53,4 +53,15 @@ LLKA_Structure extendToResidue(const ExtendSource &src, const int32_t pdbx_PDB_m
     return LLKA_makeStructureFromPtrs(atoms.data(), atoms.size());
 }
 
+LLKA_Structure residueSliceForward(const ExtendSource &src, const int32_t pdbx_PDB_model_num, const char *label_asym_id, int32_t label_seq_id, char label_alt_id)
+{
+    size_t idx = src.fromIndex + 1;
+    for (; idx < src.stru->nAtoms; idx++) {
+        if (!isSameResidue(src.stru->atoms[idx], pdbx_PDB_model_num, label_asym_id, label_seq_id, label_alt_id))
+            break;
+    }
+
+    return { &src.stru->atoms[src.fromIndex], idx - src.fromIndex };
+}
+
 } // namespace LLKAInternal
@@ -20,6 +20,10 @@ public:
 
 LLKA_Structure extendToResidue(const ExtendSource &src, const int32_t pdbx_PDB_model_num, const char *label_asym_id, int32_t label_seq_id, char label_alt_id, int direction = EXT_DIR_FWD | EXT_DIR_BACK);
 
+// Forward-only variant of extendToResidue() that does not copy any atoms.
+// The returned LLKA_Structure aliases the atoms of the source structure and must not be destroyed.
+LLKA_Structure residueSliceForward(const ExtendSource &src, const int32_t pdbx_PDB_model_num, const char *label_asym_id, int32_t label_seq_id, char label_alt_id);
+
 } // namespace LLKAInternal
 
 #endif // _LLKA_EXTEND_H
@@ -39,7 +39,7 @@ auto getAllMatchingAtoms(const LLKA_Structure *stru, const AtomToExtract &ate) -
         if (!ate.compId.empty())
             isCandidate &= std::strcmp(atom->label_comp_id, ate.compId.c_str()) == 0;
         if (!ate.name.empty())
-            isCandidate &= std::strcmp(atom->label_atom_id, ate.name.c_str()) == 0;
+            isCandidate &= ate.name.matches(atom->label_atom_id);
 
         if (!isCandidate)
             continue;
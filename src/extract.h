@@ -5,6 +5,8 @@
 
 #include <llka_structure.h>
 
+#include "ntc_bones.hpp"
+
 #include <cstdint>
 #include <string>
 #include <vector>
@@ -17,16 +19,16 @@ public:
         modelNum{-1},
         seqId{-1},
         asymId{""},
-        name{""},
+        name{},
         altId{LLKA_NO_ALTID}
     {}
 
-    AtomToExtract(int32_t modelNum, std::string asymId, int32_t seqId, std::string compId, std::string name = {}, char altId = LLKA_NO_ALTID) :
+    AtomToExtract(int32_t modelNum, std::string asymId, int32_t seqId, std::string compId, LLKABones::ANString name = {}, char altId = LLKA_NO_ALTID) :
         modelNum{modelNum},
         seqId{seqId},
         asymId{std::move(asymId)},
         compId{std::move(compId)},
-        name{std::move(name)},
+        name{name},
         altId{altId}
     {}
 
@@ -34,7 +36,7 @@ public:
     int32_t seqId;
     std::string asymId;
     std::string compId;
-    std::string name;
+    LLKABones::ANString name;
     char altId;
 };
 
@@ -18,7 +18,7 @@ auto _isAtomCandidate(const LLKA_Atom *atom, const LLKAInternal::AtomToExtract &
         atom->label_seq_id == ate.seqId &&
         (std::strcmp(atom->label_asym_id, ate.asymId.c_str()) == 0) &&
         (std::strcmp(atom->label_comp_id, ate.compId.c_str()) == 0) &&
-        (std::strcmp(atom->label_atom_id, ate.name.c_str()) == 0)
+        ate.name.matches(atom->label_atom_id)
     );
 
     return isCandidate;
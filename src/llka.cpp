@@ -48,6 +48,7 @@ const char * LLKA_CC LLKA_errorToString(LLKA_RetCode tRet)
     LLKA_RETCODE_CASE(LLKA_E_BAD_DATA);
     LLKA_RETCODE_CASE(LLKA_E_NO_DATA);
     LLKA_RETCODE_CASE(LLKA_E_NOTHING_TO_CLASSIFY);
+    LLKA_RETCODE_CASE(LLKA_E_CANNOT_WRITE_FILE);
     case ENUM_FORCE_INT32_SIZE_ITEM(LLKA_RetCode): return "Unknown return code";
     }
 
@@ -9,6 +9,7 @@
 
 #include <llka_cpp.h>
 #include <llka_nucleotide.h>
+#include <llka_profiling.h>
 #include <llka_resource_loaders.h>
 #include <llka_superposition.h>
 #include <llka_tracing.h>
@@ -17,10 +18,13 @@
 #include <util/geometry.h>
 
 #include <algorithm>
+#include <cctype>
 #include <cstring>
+#include <limits>
 #include <memory>
 #include <ostream>
 #include <span>
+#include <unordered_set>
 
 #ifdef LLKA_PLATFORM_EMSCRIPTEN
     #define _EMX_GET_DEF(type, cls, var) auto cls::_emsGet_##var() const -> const type & { return var; }
@@ -283,6 +287,16 @@ auto makeStructure(const LLKA_Atom *atoms, size_t nAtoms) -> Structure
     return stru;
 }
 
+auto removeAtomsByIds(Structure &stru, const std::vector<uint32_t> &ids) -> size_t
+{
+    if (ids.empty())
+        return 0;
+
+    const std::unordered_set<uint32_t> toRemove(ids.cbegin(), ids.cend());
+
+    return removeAtomsIf(stru, [&toRemove](const Atom &atom) { return toRemove.contains(atom.id); });
+}
+
 auto splitByAltIds(const Structure &stru) -> std::vector<AltIdSplit>
 {
     const auto wStru = helpers::struToWrappedCStru(stru);
@@ -1410,6 +1424,41 @@ auto loadGoldenSteps(const std::string &text) -> RCResult<std::vector<GoldenStep
     return RT::succeed(std::move(resource));
 }
 
+//
+// Profiling
+//
+
+auto profileCounters() -> std::vector<ProfileCounter>
+{
+    auto cCounters = LLKA_profileCounters();
+
+    std::vector<ProfileCounter> counters{};
+    counters.reserve(cCounters.nCounters);
+    for (size_t idx = 0; idx < cCounters.nCounters; idx++) {
+        const auto &cCounter = cCounters.counters[idx];
+        counters.push_back(ProfileCounter{
+            .phase = cCounter.phase,
+            .name = cCounter.name,
+            .calls = cCounter.calls,
+            .nanoseconds = cCounter.nanoseconds
+        });
+    }
+
+    LLKA_destroyProfileCounters(&cCounters);
+
+    return counters;
+}
+
+auto profilingEnabled() -> bool
+{
+    return LLKA_profilingEnabled();
+}
+
+auto resetProfileCounters() -> void
+{
+    LLKA_resetProfileCounters();
+}
+
 //
 // Tracing
 //
@@ -1434,6 +1483,31 @@ auto trace(bool dontClear) -> std::string
     return str;
 }
 
+auto traceRecords(bool dontClear) -> std::vector<TraceRecord>
+{
+    auto cRecords = LLKA_traceRecords(dontClear ? LLKA_TRUE : LLKA_FALSE);
+
+    std::vector<TraceRecord> records{};
+    records.reserve(cRecords.nRecords);
+    for (size_t idx = 0; idx < cRecords.nRecords; idx++) {
+        const auto &cRec = cRecords.records[idx];
+
+        records.push_back(TraceRecord{
+            .TPID = cRec.TPID,
+            .contextId = cRec.contextId,
+            .stepIdx = cRec.stepIdx,
+            .values = std::vector<double>(cRec.values, cRec.values + cRec.nValues),
+            .indices = std::vector<int64_t>(cRec.indices, cRec.indices + cRec.nIndices),
+            .label = cRec.label,
+            .text = cRec.text != nullptr ? cRec.text : ""
+        });
+    }
+
+    LLKA_destroyTraceRecords(&cRecords);
+
+    return records;
+}
+
 auto tracepointInfo() -> std::vector<TracepointInfo>
 {
   auto cTpInfos = LLKA_tracepointInfo();
@@ -1442,6 +1516,7 @@ auto tracepointInfo() -> std::vector<TracepointInfo>
   for (size_t idx = 0; idx < cTpInfos.nInfos; idx++) {
       tpInfos[idx].TPID = cTpInfos.infos[idx].TPID;
       tpInfos[idx].description = cTpInfos.infos[idx].description;
+      tpInfos[idx].recordLayout = cTpInfos.infos[idx].recordLayout;
   }
 
   LLKA_destroyTracepointInfo(&cTpInfos);
@@ -1725,6 +1800,49 @@ auto initializeClassificationContext(
     return RCResult<ClassificationContext>::succeed(ctx);
 }
 
+auto initializeClassificationContextFromBundle(
+    const std::string &clusters,
+    const std::string &goldenSteps,
+    const std::string &confals,
+    const std::string &clusterNuAngles,
+    const std::string &confalPercentiles,
+    const LLKA_ClassificationLimits &limits,
+    double maxCloseEnoughRmsd
+) -> RCResult<ClassificationContext>
+{
+    LLKA_ClassificationContext *ctx;
+
+    LLKA_ClassificationResourceBundle bundle{};
+    bundle.clusters = clusters.c_str();
+    bundle.goldenSteps = goldenSteps.c_str();
+    bundle.confals = confals.c_str();
+    bundle.clusterNuAngles = clusterNuAngles.c_str();
+    bundle.confalPercentiles = confalPercentiles.c_str();
+
+    auto tRet = LLKA_initializeClassificationContextFromBundle(&bundle, &limits, maxCloseEnoughRmsd, &ctx);
+    if (tRet != LLKA_OK)
+        return RCResult<ClassificationContext>::fail(tRet);
+    return RCResult<ClassificationContext>::succeed(ctx);
+}
+
+#ifndef LLKA_FILESYSTEM_ACCESS_DISABLED
+
+auto initializeClassificationContextFromDirectory(
+    const std::filesystem::path &path,
+    const LLKA_ClassificationLimits &limits,
+    double maxCloseEnoughRmsd
+) -> RCResult<ClassificationContext>
+{
+    LLKA_ClassificationContext *ctx;
+
+    auto tRet = LLKA_initializeClassificationContextFromDirectory(path.c_str(), &limits, maxCloseEnoughRmsd, &ctx);
+    if (tRet != LLKA_OK)
+        return RCResult<ClassificationContext>::fail(tRet);
+    return RCResult<ClassificationContext>::succeed(ctx);
+}
+
+#endif // LLKA_FILESYSTEM_ACCESS_DISABLED
+
 auto nameToSugarPucker(const std::string &name) -> LLKA_SugarPucker
 {
     return LLKA_nameToSugarPucker(name.c_str());
@@ -1735,6 +1853,398 @@ auto sugarPuckerToName(LLKA_SugarPucker pucker, LLKA_SugarPuckerNameBrevity brev
     return std::string{LLKA_sugarPuckerToName(pucker, brevity)};
 }
 
+//
+// Handles
+//
+
+#ifndef LLKA_PLATFORM_EMSCRIPTEN
+
+static
+auto cifToStructureHandleResult(LLKA_RetCode tRet, const LLKA_ImportedStructure &cImportedStru, char *error) -> ImportedStructureHandleResult
+{
+    if (tRet != LLKA_OK) {
+        CifError err;
+        err.tRet = tRet;
+
+        if (error) {
+            err.error = std::string{error};
+            LLKA_destroyString(error);
+        }
+
+        return ImportedStructureHandleResult::fail(std::move(err));
+    }
+
+    return ImportedStructureHandleResult::succeed(cImportedStru);
+}
+
+auto StructureHandle::toStructure() const -> Structure
+{
+    return helpers::cStruToStru(get());
+}
+
+#ifndef LLKA_FILESYSTEM_ACCESS_DISABLED
+
+auto cifToStructureHandle(const std::filesystem::path &path, int32_t options) -> ImportedStructureHandleResult
+{
+    LLKA_ImportedStructure cImportedStru;
+    char *error;
+
+    auto tRet = LLKA_cifFileToStructure(path.c_str(), &cImportedStru, &error, options);
+    return cifToStructureHandleResult(tRet, cImportedStru, error);
+}
+
+#endif // LLKA_FILESYSTEM_ACCESS_DISABLED
+
+auto cifToStructureHandle(const std::string &text, int32_t options) -> ImportedStructureHandleResult
+{
+    LLKA_ImportedStructure cImportedStru;
+    char *error;
+
+    auto tRet = LLKA_cifTextToStructure(text.c_str(), &cImportedStru, &error, options);
+    return cifToStructureHandleResult(tRet, cImportedStru, error);
+}
+
+auto classifyStep(const LLKA_Structure &stru, const ClassificationContext &ctx) -> RCResult<LLKA_ClassifiedStep>
+{
+    LLKA_ClassifiedStep cClassifiedStep;
+    auto tRet = LLKA_classifyStep(&stru, ctx.get(), &cClassifiedStep);
+    if (tRet != LLKA_OK)
+        return RCResult<LLKA_ClassifiedStep>::fail(tRet);
+    return RCResult<LLKA_ClassifiedStep>::succeed(cClassifiedStep);
+}
+
+auto classifySteps(const StructuresHandle &strus, const ClassificationContext &ctx) -> RCResult<ClassifiedStepsHandle>
+{
+    LLKA_ClassifiedSteps cClassifiedSteps;
+    auto tRet = LLKA_classifyStepsMultiple(&strus.get(), ctx.get(), &cClassifiedSteps);
+    if (tRet != LLKA_OK)
+        return RCResult<ClassifiedStepsHandle>::fail(tRet);
+    return RCResult<ClassifiedStepsHandle>::succeed(cClassifiedSteps);
+}
+
+auto extractBackbone(const LLKA_Structure &stru) -> RCResult<StructureHandle>
+{
+    LLKA_Structure cBackbone;
+    auto tRet = LLKA_extractBackbone(&stru, &cBackbone);
+    if (tRet != LLKA_OK)
+        return RCResult<StructureHandle>::fail(tRet);
+    return RCResult<StructureHandle>::succeed(cBackbone);
+}
+
+auto splitStructureToDinucleotideSteps(const LLKA_Structure &stru) -> RCResult<StructuresHandle>
+{
+    LLKA_Structures steps;
+    auto tRet = LLKA_splitStructureToDinucleotideSteps(&stru, &steps);
+    if (tRet != LLKA_OK)
+        return RCResult<StructuresHandle>::fail(tRet);
+    return RCResult<StructuresHandle>::succeed(steps);
+}
+
+#endif // LLKA_PLATFORM_EMSCRIPTEN
+
+template <typename AtomType>
+static
+auto fillStructureColumns(StructureColumns &columns, const std::span<const AtomType> &atoms) -> void
+{
+    columns.x.resize(atoms.size());
+    columns.y.resize(atoms.size());
+    columns.z.resize(atoms.size());
+    columns.ids.resize(atoms.size());
+    columns.labelSeqIds.resize(atoms.size());
+    columns.authSeqIds.resize(atoms.size());
+    columns.modelNumbers.resize(atoms.size());
+
+    for (size_t idx = 0; idx < atoms.size(); idx++) {
+        const auto &atom = atoms[idx];
+
+        columns.x[idx] = atom.coords.x;
+        columns.y[idx] = atom.coords.y;
+        columns.z[idx] = atom.coords.z;
+        columns.ids[idx] = int32_t(atom.id);
+        columns.labelSeqIds[idx] = atom.label_seq_id;
+        columns.authSeqIds[idx] = atom.auth_seq_id;
+        columns.modelNumbers[idx] = atom.pdbx_PDB_model_num;
+    }
+}
+
+StructureColumns::StructureColumns(const LLKA_Structure &stru)
+{
+    fillStructureColumns(*this, std::span<const LLKA_Atom>{stru.atoms, stru.nAtoms});
+}
+
+StructureColumns::StructureColumns(const Structure &stru)
+{
+    fillStructureColumns(*this, std::span<const Atom>{stru});
+}
+
+auto StructureColumns::nAtoms() const -> size_t
+{
+    return x.size();
+}
+
+// First alternate position id of the atoms of a residue, empty if the residue has none
+static
+auto residueAltId(std::span<const LLKA_Atom> atoms, int32_t seqId) -> std::string
+{
+    for (const auto &atom : atoms) {
+        if (atom.label_seq_id == seqId && atom.label_alt_id != LLKA_NO_ALTID)
+            return std::string(1, atom.label_alt_id);
+    }
+
+    return {};
+}
+
+static
+auto residueTag(const LLKA_Atom &atom, const std::string &altId) -> std::string
+{
+    std::string tag = std::string{atom.auth_comp_id};
+    if (!altId.empty())
+        tag += "." + altId;
+    tag += "_" + std::to_string(atom.auth_seq_id);
+    if (atom.pdbx_PDB_ins_code != nullptr && std::strcmp(atom.pdbx_PDB_ins_code, LLKA_NO_INSCODE) != 0)
+        tag += std::string{"."} + atom.pdbx_PDB_ins_code;
+
+    return tag;
+}
+
+StepIdentityColumns::StepIdentityColumns(const LLKA_Structures &steps, const std::string &entryId)
+{
+    const size_t nSteps = steps.nStrus;
+
+    modelNumbers.resize(nSteps);
+    labelAsymIds.resize(nSteps);
+    authAsymIds.resize(nSteps);
+    labelSeqIdsFirst.resize(nSteps);
+    labelSeqIdsSecond.resize(nSteps);
+    authSeqIdsFirst.resize(nSteps);
+    authSeqIdsSecond.resize(nSteps);
+    compIdsFirst.resize(nSteps);
+    compIdsSecond.resize(nSteps);
+    altIdsFirst.resize(nSteps);
+    altIdsSecond.resize(nSteps);
+    insCodesFirst.resize(nSteps);
+    insCodesSecond.resize(nSteps);
+    stepNames.resize(nSteps);
+
+    // Step names carry the model number only if the steps come from multiple models
+    bool multipleModels = false;
+    for (size_t idx = 1; idx < nSteps; idx++) {
+        if (steps.strus[idx].nAtoms > 0 && steps.strus[0].nAtoms > 0 &&
+            steps.strus[idx].atoms[0].pdbx_PDB_model_num != steps.strus[0].atoms[0].pdbx_PDB_model_num) {
+            multipleModels = true;
+            break;
+        }
+    }
+
+    std::string lwrEntryId = entryId;
+    std::transform(lwrEntryId.begin(), lwrEntryId.end(), lwrEntryId.begin(), [](unsigned char ch) { return char(std::tolower(ch)); });
+
+    for (size_t idx = 0; idx < nSteps; idx++) {
+        const auto &step = steps.strus[idx];
+        if (step.nAtoms == 0)
+            continue;
+
+        const std::span<const LLKA_Atom> atoms{step.atoms, step.nAtoms};
+        const auto &first = atoms.front();
+        const auto &second = atoms.back();
+
+        modelNumbers[idx] = first.pdbx_PDB_model_num;
+        labelAsymIds[idx] = first.label_asym_id;
+        authAsymIds[idx] = first.auth_asym_id;
+        labelSeqIdsFirst[idx] = first.label_seq_id;
+        labelSeqIdsSecond[idx] = second.label_seq_id;
+        authSeqIdsFirst[idx] = first.auth_seq_id;
+        authSeqIdsSecond[idx] = second.auth_seq_id;
+        compIdsFirst[idx] = first.label_comp_id;
+        compIdsSecond[idx] = second.label_comp_id;
+        altIdsFirst[idx] = residueAltId(atoms, first.label_seq_id);
+        altIdsSecond[idx] = residueAltId(atoms, second.label_seq_id);
+        insCodesFirst[idx] = first.pdbx_PDB_ins_code != nullptr ? first.pdbx_PDB_ins_code : "";
+        insCodesSecond[idx] = second.pdbx_PDB_ins_code != nullptr ? second.pdbx_PDB_ins_code : "";
+
+        std::string prefix = lwrEntryId;
+        if (multipleModels)
+            prefix += "-m" + std::to_string(first.pdbx_PDB_model_num);
+        if (!prefix.empty())
+            prefix += "_";
+
+        stepNames[idx] = prefix + first.auth_asym_id + "_" + residueTag(first, altIdsFirst[idx]) + "_" + residueTag(second, altIdsSecond[idx]);
+    }
+}
+
+ClassifiedStepsColumns::ClassifiedStepsColumns(const LLKA_ClassifiedSteps &steps) :
+    statuses(steps.nAttemptedSteps),
+    assignedNtCs(steps.nAttemptedSteps),
+    assignedCANAs(steps.nAttemptedSteps),
+    closestNtCs(steps.nAttemptedSteps),
+    closestCANAs(steps.nAttemptedSteps),
+    violations(steps.nAttemptedSteps),
+    confalScores(steps.nAttemptedSteps),
+    rmsdsToClosestNtC(steps.nAttemptedSteps),
+    metrics(NUM_METRICS * steps.nAttemptedSteps)
+{
+    constexpr auto NaN = std::numeric_limits<double>::quiet_NaN();
+    const size_t nSteps = steps.nAttemptedSteps;
+
+    for (size_t idx = 0; idx < nSteps; idx++) {
+        const auto &attempted = steps.attemptedSteps[idx];
+        statuses[idx] = attempted.status;
+
+        if (attempted.status != LLKA_OK) {
+            assignedNtCs[idx] = LLKA_INVALID_NTC;
+            assignedCANAs[idx] = LLKA_INVALID_CANA;
+            closestNtCs[idx] = LLKA_INVALID_NTC;
+            closestCANAs[idx] = LLKA_INVALID_CANA;
+            violations[idx] = 0;
+            confalScores[idx] = NaN;
+            rmsdsToClosestNtC[idx] = NaN;
+            for (size_t m = 0; m < NUM_METRICS; m++)
+                metrics[m * nSteps + idx] = NaN;
+            continue;
+        }
+
+        const auto &step = attempted.step;
+        assignedNtCs[idx] = step.assignedNtC;
+        assignedCANAs[idx] = step.assignedCANA;
+        closestNtCs[idx] = step.closestNtC;
+        closestCANAs[idx] = step.closestCANA;
+        violations[idx] = step.violations;
+        confalScores[idx] = step.confalScore.total;
+        rmsdsToClosestNtC[idx] = step.rmsdToClosestNtC;
+
+        const double stepMetrics[NUM_METRICS] = {
+            step.metrics.delta_1, step.metrics.epsilon_1, step.metrics.zeta_1,
+            step.metrics.alpha_2, step.metrics.beta_2, step.metrics.gamma_2, step.metrics.delta_2,
+            step.metrics.chi_1, step.metrics.chi_2,
+            step.metrics.CC, step.metrics.NN, step.metrics.mu
+        };
+        for (size_t m = 0; m < NUM_METRICS; m++)
+            metrics[m * nSteps + idx] = stepMetrics[m];
+    }
+}
+
+ClassifiedStepsColumns::ClassifiedStepsColumns(const LLKA_Structures &steps, const LLKA_ClassifiedSteps &classified, const std::string &entryId) :
+    ClassifiedStepsColumns{classified}
+{
+    static_cast<StepIdentityColumns &>(*this) = StepIdentityColumns{steps, entryId};
+}
+
+auto ClassifiedStepsColumns::nSteps() const -> size_t
+{
+    return statuses.size();
+}
+
+auto ClassifiedStepsColumns::metric(size_t idx) const -> std::span<const double>
+{
+    if (idx >= NUM_METRICS)
+        return {};
+
+    return std::span<const double>{metrics}.subspan(idx * nSteps(), nSteps());
+}
+
+auto classifyStepsColumns(const Structures &strus, const ClassificationContext &ctx) -> RCResult<ClassifiedStepsColumns>
+{
+    auto wStrus = helpers::strusToWrappedCStrus(strus);
+    const auto ds = wStrus.get();
+
+    LLKA_ClassifiedSteps cClassifiedSteps;
+    auto tRet = LLKA_classifyStepsMultiple(&ds, ctx.get(), &cClassifiedSteps);
+    if (tRet != LLKA_OK)
+        return RCResult<ClassifiedStepsColumns>::fail(tRet);
+
+    ClassifiedStepsColumns columns{ds, cClassifiedSteps, {}};
+    LLKA_destroyClassifiedSteps(&cClassifiedSteps);
+
+    return RCResult<ClassifiedStepsColumns>::succeed(std::move(columns));
+}
+
+#ifndef LLKA_PLATFORM_EMSCRIPTEN
+
+auto classifyStepsColumns(const StructuresHandle &strus, const ClassificationContext &ctx, const std::string &entryId) -> RCResult<ClassifiedStepsColumns>
+{
+    LLKA_ClassifiedSteps cClassifiedSteps;
+    auto tRet = LLKA_classifyStepsMultiple(&strus.get(), ctx.get(), &cClassifiedSteps);
+    if (tRet != LLKA_OK)
+        return RCResult<ClassifiedStepsColumns>::fail(tRet);
+
+    ClassifiedStepsColumns columns{strus.get(), cClassifiedSteps, entryId};
+    LLKA_destroyClassifiedSteps(&cClassifiedSteps);
+
+    return RCResult<ClassifiedStepsColumns>::succeed(std::move(columns));
+}
+
+#endif // LLKA_PLATFORM_EMSCRIPTEN
+
+auto classifyCifColumns(const std::string &text, const ClassificationContext &ctx, int32_t options) -> ClassifiedStepsColumnsResult
+{
+    LLKA_ImportedStructure cImportedStru;
+    char *error;
+
+    auto tRet = LLKA_cifTextToStructure(text.c_str(), &cImportedStru, &error, options);
+    if (tRet != LLKA_OK) {
+        CifError err;
+        err.tRet = tRet;
+
+        if (error) {
+            err.error = std::string{error};
+            LLKA_destroyString(error);
+        }
+
+        return ClassifiedStepsColumnsResult::fail(std::move(err));
+    }
+
+    auto fail = [&cImportedStru](LLKA_RetCode tRet) {
+        LLKA_destroyImportedStructure(&cImportedStru);
+
+        CifError err;
+        err.tRet = tRet;
+        return ClassifiedStepsColumnsResult::fail(std::move(err));
+    };
+
+    LLKA_Structures cSteps;
+    tRet = LLKA_splitStructureToDinucleotideSteps(&cImportedStru.structure, &cSteps);
+    if (tRet != LLKA_OK)
+        return fail(tRet);
+
+    LLKA_ClassifiedSteps cClassifiedSteps;
+    tRet = LLKA_classifyStepsMultiple(&cSteps, ctx.get(), &cClassifiedSteps);
+    if (tRet != LLKA_OK) {
+        LLKA_destroyStructures(&cSteps);
+        return fail(tRet);
+    }
+
+    ClassifiedStepsColumns columns{cSteps, cClassifiedSteps, cImportedStru.entry.id != nullptr ? cImportedStru.entry.id : ""};
+    LLKA_destroyClassifiedSteps(&cClassifiedSteps);
+    LLKA_destroyStructures(&cSteps);
+    LLKA_destroyImportedStructure(&cImportedStru);
+
+    return ClassifiedStepsColumnsResult::succeed(std::move(columns));
+}
+
+auto cifToStructureColumns(const std::string &text, int32_t options) -> StructureColumnsResult
+{
+    LLKA_ImportedStructure cImportedStru;
+    char *error;
+
+    auto tRet = LLKA_cifTextToStructure(text.c_str(), &cImportedStru, &error, options);
+    if (tRet != LLKA_OK) {
+        CifError err;
+        err.tRet = tRet;
+
+        if (error) {
+            err.error = std::string{error};
+            LLKA_destroyString(error);
+        }
+
+        return StructureColumnsResult::fail(std::move(err));
+    }
+
+    StructureColumns columns{cImportedStru.structure};
+    LLKA_destroyImportedStructure(&cImportedStru);
+
+    return StructureColumnsResult::succeed(std::move(columns));
+}
+
 namespace helpers {
 
     auto atomToCAtom(const Atom &atom, LLKA_Atom &cAtom) -> void
@@ -42,3 +42,21 @@ double LLKA_CC LLKA_measureDistance(const LLKA_Atom *a, const LLKA_Atom *b)
 {
     return LLKAInternal::spatialDistance<double>(*a, *b);
 }
+
+
+void LLKA_CC LLKA_measureAnglesBatch(const LLKA_Point *triples, size_t n, double *out)
+{
+    LLKAInternal::anglesBatch(triples, n, out);
+}
+
+
+void LLKA_CC LLKA_measureDihedralsBatch(const LLKA_Point *quads, size_t n, double *out)
+{
+    LLKAInternal::dihedralAnglesBatch(quads, n, out);
+}
+
+
+void LLKA_CC LLKA_measureDistancesBatch(const LLKA_Point *pairs, size_t n, double *out)
+{
+    LLKAInternal::spatialDistancesBatch(pairs, n, out);
+}
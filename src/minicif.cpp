@@ -6,6 +6,7 @@
 #include "minicif/writer.h"
 #include "minicif/categories/atom-site.hpp"
 #include "minicif/categories/entry.hpp"
+#include "profiling.hpp"
 
 #ifndef LLKA_FILESYSTEM_ACCESS_DISABLED
     #if defined(LLKA_PLATFORM_UNIX) || defined(LLKA_PLATFORM_EMSCRIPTEN)
@@ -169,6 +170,8 @@ auto toCifData(const std::vector<Block> &blocks)
 static
 auto toStructure(const std::string_view &view, LLKA_ImportedStructure *importedStru, char **error, int32_t options)
 {
+    LLKA_PROFILE_SCOPE(LLKA_PROFILE_CIF_TO_STRUCTURE);
+
     try {
         auto blocks = parse(view);
 
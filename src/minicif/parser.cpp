@@ -2,11 +2,14 @@
 
 #include "parser.h"
 
+#include "../profiling.hpp"
+
 #include <algorithm>
 #include <cassert>
 #include <cstring>
 #include <optional>
 #include <string>
+#include <tuple>
 #include <vector>
 
 namespace LLKAInternal::MiniCif {
@@ -569,6 +572,8 @@ auto doTagValue(const std::string &text, Block &block, Stream &stream)
 
 auto parse(const std::string_view &data) -> std::vector<Block>
 {
+    LLKA_PROFILE_SCOPE(LLKA_PROFILE_CIF_PARSE);
+
     auto stream = Stream(data);
 
     std::vector<Block> blocks{};
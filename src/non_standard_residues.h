@@ -5,7 +5,8 @@
 
 #include "ntc_bones.hpp"
 
-#include <map>
+#include <array>
+#include <utility>
 
 /*
  * IMPORTANT NOTE:
@@ -15,10 +16,10 @@
 
 namespace LLKABones {
 
-inline const BoneFirstResidue _05ABoneFirstResidue = { "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
-inline const BoneSecondResidue _05ABoneSecondResidue = { "C3", "N2", "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
-inline const BoneBase _05ABase = { "N1", "C6" };
-inline const Quad _05ABaseQuad = { "O4'", "C1'", "N1", "C6" };
+inline constexpr BoneFirstResidue _05ABoneFirstResidue = { "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
+inline constexpr BoneSecondResidue _05ABoneSecondResidue = { "C3", "N2", "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
+inline constexpr BoneBase _05ABase = { "N1", "C6" };
+inline constexpr Quad _05ABaseQuad = { "O4'", "C1'", "N1", "C6" };
 inline constexpr Bone _05ABone = {
     .firstResidue = _05ABoneFirstResidue,
     .secondResidue = _05ABoneSecondResidue,
@@ -31,10 +32,10 @@ inline constexpr Bone _05ABone = {
     .name = { '0', '5', 'A', '\0' }
 };
 
-inline const BoneFirstResidue _05HBoneFirstResidue = { "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
-inline const BoneSecondResidue _05HBoneSecondResidue = { "C71", "N5'", "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
-inline const BoneBase _05HBase = { "N1", "C2" };
-inline const Quad _05HBaseQuad = { "O4'", "C1'", "N1", "C2" };
+inline constexpr BoneFirstResidue _05HBoneFirstResidue = { "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
+inline constexpr BoneSecondResidue _05HBoneSecondResidue = { "C71", "N5'", "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
+inline constexpr BoneBase _05HBase = { "N1", "C2" };
+inline constexpr Quad _05HBaseQuad = { "O4'", "C1'", "N1", "C2" };
 inline constexpr Bone _05HBone = {
     .firstResidue = _05HBoneFirstResidue,
     .secondResidue = _05HBoneSecondResidue,
@@ -47,10 +48,10 @@ inline constexpr Bone _05HBone = {
     .name = { '0', '5', 'H', '\0' }
 };
 
-inline const BoneFirstResidue _05KBoneFirstResidue = { "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
-inline const BoneSecondResidue _05KBoneSecondResidue = { "C71", "N5'", "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
-inline const BoneBase _05KBase = { "N1", "C2" };
-inline const Quad _05KBaseQuad = { "O4'", "C1'", "N1", "C2" };
+inline constexpr BoneFirstResidue _05KBoneFirstResidue = { "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
+inline constexpr BoneSecondResidue _05KBoneSecondResidue = { "C71", "N5'", "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
+inline constexpr BoneBase _05KBase = { "N1", "C2" };
+inline constexpr Quad _05KBaseQuad = { "O4'", "C1'", "N1", "C2" };
 inline constexpr Bone _05KBone = {
     .firstResidue = _05KBoneFirstResidue,
     .secondResidue = _05KBoneSecondResidue,
@@ -63,8 +64,8 @@ inline constexpr Bone _05KBone = {
     .name = { '0', '5', 'K', '\0' }
 };
 
-inline const BoneBase _0AUBase = { "N1", "C6" };
-inline const Quad _0AUBaseQuad = { "O4'", "C1'", "N1", "C6" };
+inline constexpr BoneBase _0AUBase = { "N1", "C6" };
+inline constexpr Quad _0AUBaseQuad = { "O4'", "C1'", "N1", "C6" };
 inline constexpr Bone _0AUBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -76,8 +77,8 @@ inline constexpr Bone _0AUBone = {
     .name = { '0', 'A', 'U', '\0' }
 };
 
-inline const BoneBase _0UBase = { "N1", "C6" };
-inline const Quad _0UBaseQuad = { "O4'", "C1'", "N1", "C6" };
+inline constexpr BoneBase _0UBase = { "N1", "C6" };
+inline constexpr Quad _0UBaseQuad = { "O4'", "C1'", "N1", "C6" };
 inline constexpr Bone _0UBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -89,8 +90,8 @@ inline constexpr Bone _0UBone = {
     .name = { '0', 'U', '\0' }
 };
 
-inline const BoneBase _0U1Base = { "N1", "C6" };
-inline const Quad _0U1BaseQuad = { "O4'", "C1'", "N1", "C6" };
+inline constexpr BoneBase _0U1Base = { "N1", "C6" };
+inline constexpr Quad _0U1BaseQuad = { "O4'", "C1'", "N1", "C6" };
 inline constexpr Bone _0U1Bone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -102,10 +103,10 @@ inline constexpr Bone _0U1Bone = {
     .name = { '0', 'U', '1', '\0' }
 };
 
-inline const BoneFirstResidue _128BoneFirstResidue = { "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
-inline const BoneSecondResidue _128BoneSecondResidue = { "PA", "O5'", "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
-inline const BoneBase _128Base = { "N9", "C4" };
-inline const Quad _128BaseQuad = { "O4'", "C1'", "N9", "C4" };
+inline constexpr BoneFirstResidue _128BoneFirstResidue = { "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
+inline constexpr BoneSecondResidue _128BoneSecondResidue = { "PA", "O5'", "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
+inline constexpr BoneBase _128Base = { "N9", "C4" };
+inline constexpr Quad _128BaseQuad = { "O4'", "C1'", "N9", "C4" };
 inline constexpr Bone _128Bone = {
     .firstResidue = _128BoneFirstResidue,
     .secondResidue = _128BoneSecondResidue,
@@ -118,8 +119,8 @@ inline constexpr Bone _128Bone = {
     .name = { '1', '2', '8', '\0' }
 };
 
-inline const BoneBase _1RNBase = { "N1", "C6" };
-inline const Quad _1RNBaseQuad = { "O4'", "C1'", "N1", "C6" };
+inline constexpr BoneBase _1RNBase = { "N1", "C6" };
+inline constexpr Quad _1RNBaseQuad = { "O4'", "C1'", "N1", "C6" };
 inline constexpr Bone _1RNBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -131,8 +132,8 @@ inline constexpr Bone _1RNBone = {
     .name = { '1', 'R', 'N', '\0' }
 };
 
-inline const BoneBase _1TLBase = { "N1", "C6" };
-inline const Quad _1TLBaseQuad = { "O4'", "C1'", "N1", "C6" };
+inline constexpr BoneBase _1TLBase = { "N1", "C6" };
+inline constexpr Quad _1TLBaseQuad = { "O4'", "C1'", "N1", "C6" };
 inline constexpr Bone _1TLBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -144,8 +145,8 @@ inline constexpr Bone _1TLBone = {
     .name = { '1', 'T', 'L', '\0' }
 };
 
-inline const BoneBase _1W5Base = { "C1", "C2" };
-inline const Quad _1W5BaseQuad = { "O4'", "C1'", "C1", "C2" };
+inline constexpr BoneBase _1W5Base = { "C1", "C2" };
+inline constexpr Quad _1W5BaseQuad = { "O4'", "C1'", "C1", "C2" };
 inline constexpr Bone _1W5Bone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -157,8 +158,8 @@ inline constexpr Bone _1W5Bone = {
     .name = { '1', 'W', '5', '\0' }
 };
 
-inline const BoneBase _2DFBase = { "N1", "O2" };
-inline const Quad _2DFBaseQuad = { "O4'", "C1'", "N1", "O2" };
+inline constexpr BoneBase _2DFBase = { "N1", "O2" };
+inline constexpr Quad _2DFBaseQuad = { "O4'", "C1'", "N1", "O2" };
 inline constexpr Bone _2DFBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -170,8 +171,8 @@ inline constexpr Bone _2DFBone = {
     .name = { '2', 'D', 'F', '\0' }
 };
 
-inline const BoneBase _2LABase = { "N9", "C8" };
-inline const Quad _2LABaseQuad = { "O4'", "C1'", "N9", "C8" };
+inline constexpr BoneBase _2LABase = { "N9", "C8" };
+inline constexpr Quad _2LABaseQuad = { "O4'", "C1'", "N9", "C8" };
 inline constexpr Bone _2LABone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -183,8 +184,8 @@ inline constexpr Bone _2LABone = {
     .name = { '2', 'L', 'A', '\0' }
 };
 
-inline const BoneBase _2OMBase = { "N1", "C6" };
-inline const Quad _2OMBaseQuad = { "O4'", "C1'", "N1", "C6" };
+inline constexpr BoneBase _2OMBase = { "N1", "C6" };
+inline constexpr Quad _2OMBaseQuad = { "O4'", "C1'", "N1", "C6" };
 inline constexpr Bone _2OMBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -196,8 +197,8 @@ inline constexpr Bone _2OMBone = {
     .name = { '2', 'O', 'M', '\0' }
 };
 
-inline const BoneBase _3MUBase = { "N1", "C6" };
-inline const Quad _3MUBaseQuad = { "O4'", "C1'", "N1", "C6" };
+inline constexpr BoneBase _3MUBase = { "N1", "C6" };
+inline constexpr Quad _3MUBaseQuad = { "O4'", "C1'", "N1", "C6" };
 inline constexpr Bone _3MUBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -209,8 +210,8 @@ inline constexpr Bone _3MUBone = {
     .name = { '3', 'M', 'U', '\0' }
 };
 
-inline const BoneBase _3TDBase = { "C5", "C4" };
-inline const Quad _3TDBaseQuad = { "O4'", "C1'", "C5", "C4" };
+inline constexpr BoneBase _3TDBase = { "C5", "C4" };
+inline constexpr Quad _3TDBaseQuad = { "O4'", "C1'", "C5", "C4" };
 inline constexpr Bone _3TDBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -222,8 +223,8 @@ inline constexpr Bone _3TDBone = {
     .name = { '3', 'T', 'D', '\0' }
 };
 
-inline const BoneBase _4ENBase = { "N8", "N9" };
-inline const Quad _4ENBaseQuad = { "O4'", "C1'", "N8", "N9" };
+inline constexpr BoneBase _4ENBase = { "N8", "N9" };
+inline constexpr Quad _4ENBaseQuad = { "O4'", "C1'", "N8", "N9" };
 inline constexpr Bone _4ENBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -235,8 +236,8 @@ inline constexpr Bone _4ENBone = {
     .name = { '4', 'E', 'N', '\0' }
 };
 
-inline const BoneBase _4MFBase = { "N1", "C7A" };
-inline const Quad _4MFBaseQuad = { "O4'", "C1'", "N1", "C7A" };
+inline constexpr BoneBase _4MFBase = { "N1", "C7A" };
+inline constexpr Quad _4MFBaseQuad = { "O4'", "C1'", "N1", "C7A" };
 inline constexpr Bone _4MFBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -248,8 +249,8 @@ inline constexpr Bone _4MFBone = {
     .name = { '4', 'M', 'F', '\0' }
 };
 
-inline const BoneBase _56BBase = { "N9", "C8" };
-inline const Quad _56BBaseQuad = { "O4'", "C1'", "N9", "C8" };
+inline constexpr BoneBase _56BBase = { "N9", "C8" };
+inline constexpr Quad _56BBaseQuad = { "O4'", "C1'", "N9", "C8" };
 inline constexpr Bone _56BBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -261,10 +262,10 @@ inline constexpr Bone _56BBone = {
     .name = { '5', '6', 'B', '\0' }
 };
 
-inline const BoneFirstResidue _5FABoneFirstResidue = { "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
-inline const BoneSecondResidue _5FABoneSecondResidue = { "PA", "O5'", "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
-inline const BoneBase _5FABase = { "N9", "C4" };
-inline const Quad _5FABaseQuad = { "O4'", "C1'", "N9", "C4" };
+inline constexpr BoneFirstResidue _5FABoneFirstResidue = { "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
+inline constexpr BoneSecondResidue _5FABoneSecondResidue = { "PA", "O5'", "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
+inline constexpr BoneBase _5FABase = { "N9", "C4" };
+inline constexpr Quad _5FABaseQuad = { "O4'", "C1'", "N9", "C4" };
 inline constexpr Bone _5FABone = {
     .firstResidue = _5FABoneFirstResidue,
     .secondResidue = _5FABoneSecondResidue,
@@ -277,8 +278,8 @@ inline constexpr Bone _5FABone = {
     .name = { '5', 'F', 'A', '\0' }
 };
 
-inline const BoneBase _5NCBase = { "N1", "C6" };
-inline const Quad _5NCBaseQuad = { "O4'", "C1'", "N1", "C6" };
+inline constexpr BoneBase _5NCBase = { "N1", "C6" };
+inline constexpr Quad _5NCBaseQuad = { "O4'", "C1'", "N1", "C6" };
 inline constexpr Bone _5NCBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -290,10 +291,10 @@ inline constexpr Bone _5NCBone = {
     .name = { '5', 'N', 'C', '\0' }
 };
 
-inline const BoneFirstResidue _5UABoneFirstResidue = { "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
-inline const BoneSecondResidue _5UABoneSecondResidue = { "C6'", "O5'", "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
-inline const BoneBase _5UABase = { "N9", "C4" };
-inline const Quad _5UABaseQuad = { "O4'", "C1'", "N9", "C4" };
+inline constexpr BoneFirstResidue _5UABoneFirstResidue = { "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
+inline constexpr BoneSecondResidue _5UABoneSecondResidue = { "C6'", "O5'", "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
+inline constexpr BoneBase _5UABase = { "N9", "C4" };
+inline constexpr Quad _5UABaseQuad = { "O4'", "C1'", "N9", "C4" };
 inline constexpr Bone _5UABone = {
     .firstResidue = _5UABoneFirstResidue,
     .secondResidue = _5UABoneSecondResidue,
@@ -306,8 +307,8 @@ inline constexpr Bone _5UABone = {
     .name = { '5', 'U', 'A', '\0' }
 };
 
-inline const BoneBase _64PBase = { "N1", "C6" };
-inline const Quad _64PBaseQuad = { "O4'", "C1'", "N1", "C6" };
+inline constexpr BoneBase _64PBase = { "N1", "C6" };
+inline constexpr Quad _64PBaseQuad = { "O4'", "C1'", "N1", "C6" };
 inline constexpr Bone _64PBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -319,8 +320,8 @@ inline constexpr Bone _64PBone = {
     .name = { '6', '4', 'P', '\0' }
 };
 
-inline const BoneBase _64TBase = { "N1", "O2" };
-inline const Quad _64TBaseQuad = { "O4'", "C1'", "N1", "O2" };
+inline constexpr BoneBase _64TBase = { "N1", "O2" };
+inline constexpr Quad _64TBaseQuad = { "O4'", "C1'", "N1", "O2" };
 inline constexpr Bone _64TBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -332,8 +333,8 @@ inline constexpr Bone _64TBone = {
     .name = { '6', '4', 'T', '\0' }
 };
 
-inline const BoneBase _6FKBase = { "N9", "C8" };
-inline const Quad _6FKBaseQuad = { "O4'", "C1'", "N9", "C8" };
+inline constexpr BoneBase _6FKBase = { "N9", "C8" };
+inline constexpr Quad _6FKBaseQuad = { "O4'", "C1'", "N9", "C8" };
 inline constexpr Bone _6FKBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -345,10 +346,10 @@ inline constexpr Bone _6FKBone = {
     .name = { '6', 'F', 'K', '\0' }
 };
 
-inline const BoneFirstResidue _6FMBoneFirstResidue = { "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
-inline const BoneSecondResidue _6FMBoneSecondResidue = { "PA", "O5'", "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
-inline const BoneBase _6FMBase = { "N9", "C4" };
-inline const Quad _6FMBaseQuad = { "O4'", "C1'", "N9", "C4" };
+inline constexpr BoneFirstResidue _6FMBoneFirstResidue = { "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
+inline constexpr BoneSecondResidue _6FMBoneSecondResidue = { "PA", "O5'", "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
+inline constexpr BoneBase _6FMBase = { "N9", "C4" };
+inline constexpr Quad _6FMBaseQuad = { "O4'", "C1'", "N9", "C4" };
 inline constexpr Bone _6FMBone = {
     .firstResidue = _6FMBoneFirstResidue,
     .secondResidue = _6FMBoneSecondResidue,
@@ -361,8 +362,8 @@ inline constexpr Bone _6FMBone = {
     .name = { '6', 'F', 'M', '\0' }
 };
 
-inline const BoneBase _6FUBase = { "N1", "C6" };
-inline const Quad _6FUBaseQuad = { "O4'", "C1'", "N1", "C6" };
+inline constexpr BoneBase _6FUBase = { "N1", "C6" };
+inline constexpr Quad _6FUBaseQuad = { "O4'", "C1'", "N1", "C6" };
 inline constexpr Bone _6FUBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -374,8 +375,8 @@ inline constexpr Bone _6FUBone = {
     .name = { '6', 'F', 'U', '\0' }
 };
 
-inline const BoneBase _6HABase = { "N9", "C4" };
-inline const Quad _6HABaseQuad = { "O4'", "C1'", "N9", "C4" };
+inline constexpr BoneBase _6HABase = { "N9", "C4" };
+inline constexpr Quad _6HABaseQuad = { "O4'", "C1'", "N9", "C4" };
 inline constexpr Bone _6HABone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -387,8 +388,8 @@ inline constexpr Bone _6HABone = {
     .name = { '6', 'H', 'A', '\0' }
 };
 
-inline const BoneBase _6HCBase = { "N1", "C6" };
-inline const Quad _6HCBaseQuad = { "O4'", "C1'", "N1", "C6" };
+inline constexpr BoneBase _6HCBase = { "N1", "C6" };
+inline constexpr Quad _6HCBaseQuad = { "O4'", "C1'", "N1", "C6" };
 inline constexpr Bone _6HCBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -400,8 +401,8 @@ inline constexpr Bone _6HCBone = {
     .name = { '6', 'H', 'C', '\0' }
 };
 
-inline const BoneBase _6HGBase = { "N9", "C4" };
-inline const Quad _6HGBaseQuad = { "O4'", "C1'", "N9", "C4" };
+inline constexpr BoneBase _6HGBase = { "N9", "C4" };
+inline constexpr Quad _6HGBaseQuad = { "O4'", "C1'", "N9", "C4" };
 inline constexpr Bone _6HGBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -413,8 +414,8 @@ inline constexpr Bone _6HGBone = {
     .name = { '6', 'H', 'G', '\0' }
 };
 
-inline const BoneBase _6HTBase = { "N1", "C6" };
-inline const Quad _6HTBaseQuad = { "O4'", "C1'", "N1", "C6" };
+inline constexpr BoneBase _6HTBase = { "N1", "C6" };
+inline constexpr Quad _6HTBaseQuad = { "O4'", "C1'", "N1", "C6" };
 inline constexpr Bone _6HTBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -426,8 +427,8 @@ inline constexpr Bone _6HTBone = {
     .name = { '6', 'H', 'T', '\0' }
 };
 
-inline const BoneBase _6MIBase = { "N1M", "C8A" };
-inline const Quad _6MIBaseQuad = { "O4'", "C1'", "N1M", "C8A" };
+inline constexpr BoneBase _6MIBase = { "N1M", "C8A" };
+inline constexpr Quad _6MIBaseQuad = { "O4'", "C1'", "N1M", "C8A" };
 inline constexpr Bone _6MIBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -439,8 +440,8 @@ inline constexpr Bone _6MIBone = {
     .name = { '6', 'M', 'I', '\0' }
 };
 
-inline const BoneBase _7ATBase = { "N9", "N8" };
-inline const Quad _7ATBaseQuad = { "O4'", "C1'", "N9", "N8" };
+inline constexpr BoneBase _7ATBase = { "N9", "N8" };
+inline constexpr Quad _7ATBaseQuad = { "O4'", "C1'", "N9", "N8" };
 inline constexpr Bone _7ATBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -452,8 +453,8 @@ inline constexpr Bone _7ATBone = {
     .name = { '7', 'A', 'T', '\0' }
 };
 
-inline const BoneBase _7MGBase = { "N9", "C8" };
-inline const Quad _7MGBaseQuad = { "O4'", "C1'", "N9", "C8" };
+inline constexpr BoneBase _7MGBase = { "N9", "C8" };
+inline constexpr Quad _7MGBaseQuad = { "O4'", "C1'", "N9", "C8" };
 inline constexpr Bone _7MGBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -465,8 +466,8 @@ inline constexpr Bone _7MGBone = {
     .name = { '7', 'M', 'G', '\0' }
 };
 
-inline const BoneBase _7SNBase = { "N9", "C8" };
-inline const Quad _7SNBaseQuad = { "O4'", "C1'", "N9", "C8" };
+inline constexpr BoneBase _7SNBase = { "N9", "C8" };
+inline constexpr Quad _7SNBaseQuad = { "O4'", "C1'", "N9", "C8" };
 inline constexpr Bone _7SNBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -478,8 +479,8 @@ inline constexpr Bone _7SNBone = {
     .name = { '7', 'S', 'N', '\0' }
 };
 
-inline const BoneBase _8AABase = { "N9", "C8" };
-inline const Quad _8AABaseQuad = { "O4'", "C1'", "N9", "C8" };
+inline constexpr BoneBase _8AABase = { "N9", "C8" };
+inline constexpr Quad _8AABaseQuad = { "O4'", "C1'", "N9", "C8" };
 inline constexpr Bone _8AABone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -491,8 +492,8 @@ inline constexpr Bone _8AABone = {
     .name = { '8', 'A', 'A', '\0' }
 };
 
-inline const BoneBase _8AGBase = { "N9", "C8" };
-inline const Quad _8AGBaseQuad = { "O4'", "C1'", "N9", "C8" };
+inline constexpr BoneBase _8AGBase = { "N9", "C8" };
+inline constexpr Quad _8AGBaseQuad = { "O4'", "C1'", "N9", "C8" };
 inline constexpr Bone _8AGBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -504,8 +505,8 @@ inline constexpr Bone _8AGBone = {
     .name = { '8', 'A', 'G', '\0' }
 };
 
-inline const BoneBase _8AZBase = { "N9", "N8" };
-inline const Quad _8AZBaseQuad = { "O4'", "C1'", "N9", "N8" };
+inline constexpr BoneBase _8AZBase = { "N9", "N8" };
+inline constexpr Quad _8AZBaseQuad = { "O4'", "C1'", "N9", "N8" };
 inline constexpr Bone _8AZBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -517,8 +518,8 @@ inline constexpr Bone _8AZBone = {
     .name = { '8', 'A', 'Z', '\0' }
 };
 
-inline const BoneBase _8MGBase = { "N9", "C8" };
-inline const Quad _8MGBaseQuad = { "O4'", "C1'", "N9", "C8" };
+inline constexpr BoneBase _8MGBase = { "N9", "C8" };
+inline constexpr Quad _8MGBaseQuad = { "O4'", "C1'", "N9", "C8" };
 inline constexpr Bone _8MGBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -530,8 +531,8 @@ inline constexpr Bone _8MGBone = {
     .name = { '8', 'M', 'G', '\0' }
 };
 
-inline const BoneBase _8PYBase = { "N9", "C8" };
-inline const Quad _8PYBaseQuad = { "O4'", "C1'", "N9", "C8" };
+inline constexpr BoneBase _8PYBase = { "N9", "C8" };
+inline constexpr Quad _8PYBaseQuad = { "O4'", "C1'", "N9", "C8" };
 inline constexpr Bone _8PYBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -543,8 +544,8 @@ inline constexpr Bone _8PYBone = {
     .name = { '8', 'P', 'Y', '\0' }
 };
 
-inline const BoneBase _8ROBase = { "N1", "C6" };
-inline const Quad _8ROBaseQuad = { "O4'", "C1'", "N1", "C6" };
+inline constexpr BoneBase _8ROBase = { "N1", "C6" };
+inline constexpr Quad _8ROBaseQuad = { "O4'", "C1'", "N1", "C6" };
 inline constexpr Bone _8ROBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -556,8 +557,8 @@ inline constexpr Bone _8ROBone = {
     .name = { '8', 'R', 'O', '\0' }
 };
 
-inline const BoneBase _8YNBase = { "C1", "C2" };
-inline const Quad _8YNBaseQuad = { "O4'", "C1'", "C1", "C2" };
+inline constexpr BoneBase _8YNBase = { "C1", "C2" };
+inline constexpr Quad _8YNBaseQuad = { "O4'", "C1'", "C1", "C2" };
 inline constexpr Bone _8YNBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -569,8 +570,8 @@ inline constexpr Bone _8YNBone = {
     .name = { '8', 'Y', 'N', '\0' }
 };
 
-inline const BoneBase _93DBase = { "C1", "C6" };
-inline const Quad _93DBaseQuad = { "O4'", "C1'", "C1", "C6" };
+inline constexpr BoneBase _93DBase = { "C1", "C6" };
+inline constexpr Quad _93DBaseQuad = { "O4'", "C1'", "C1", "C6" };
 inline constexpr Bone _93DBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -582,8 +583,8 @@ inline constexpr Bone _93DBone = {
     .name = { '9', '3', 'D', '\0' }
 };
 
-inline const BoneBase _9V9Base = { "N1", "C6" };
-inline const Quad _9V9BaseQuad = { "O4'", "C1'", "N1", "C6" };
+inline constexpr BoneBase _9V9Base = { "N1", "C6" };
+inline constexpr Quad _9V9BaseQuad = { "O4'", "C1'", "N1", "C6" };
 inline constexpr Bone _9V9Bone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -595,10 +596,10 @@ inline constexpr Bone _9V9Bone = {
     .name = { '9', 'V', '9', '\0' }
 };
 
-inline const BoneFirstResidue A1PBoneFirstResidue = { "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
-inline const BoneSecondResidue A1PBoneSecondResidue = { "O2P", "O5'", "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
-inline const BoneBase A1PBase = { "N9", "C4" };
-inline const Quad A1PBaseQuad = { "O4'", "C1'", "N9", "C4" };
+inline constexpr BoneFirstResidue A1PBoneFirstResidue = { "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
+inline constexpr BoneSecondResidue A1PBoneSecondResidue = { "O2P", "O5'", "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
+inline constexpr BoneBase A1PBase = { "N9", "C4" };
+inline constexpr Quad A1PBaseQuad = { "O4'", "C1'", "N9", "C4" };
 inline constexpr Bone A1PBone = {
     .firstResidue = A1PBoneFirstResidue,
     .secondResidue = A1PBoneSecondResidue,
@@ -611,10 +612,10 @@ inline constexpr Bone A1PBone = {
     .name = { 'A', '1', 'P', '\0' }
 };
 
-inline const BoneFirstResidue A3PBoneFirstResidue = { "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
-inline const BoneSecondResidue A3PBoneSecondResidue = { "P2", "O5'", "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
-inline const BoneBase A3PBase = { "N9", "C4" };
-inline const Quad A3PBaseQuad = { "O4'", "C1'", "N9", "C4" };
+inline constexpr BoneFirstResidue A3PBoneFirstResidue = { "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
+inline constexpr BoneSecondResidue A3PBoneSecondResidue = { "P2", "O5'", "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
+inline constexpr BoneBase A3PBase = { "N9", "C4" };
+inline constexpr Quad A3PBaseQuad = { "O4'", "C1'", "N9", "C4" };
 inline constexpr Bone A3PBone = {
     .firstResidue = A3PBoneFirstResidue,
     .secondResidue = A3PBoneSecondResidue,
@@ -627,8 +628,8 @@ inline constexpr Bone A3PBone = {
     .name = { 'A', '3', 'P', '\0' }
 };
 
-inline const BoneBase A6CBase = { "N1", "C6" };
-inline const Quad A6CBaseQuad = { "O4'", "C1'", "N1", "C6" };
+inline constexpr BoneBase A6CBase = { "N1", "C6" };
+inline constexpr Quad A6CBaseQuad = { "O4'", "C1'", "N1", "C6" };
 inline constexpr Bone A6CBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -640,8 +641,8 @@ inline constexpr Bone A6CBone = {
     .name = { 'A', '6', 'C', '\0' }
 };
 
-inline const BoneBase A6UBase = { "N1", "C6" };
-inline const Quad A6UBaseQuad = { "O4'", "C1'", "N1", "C6" };
+inline constexpr BoneBase A6UBase = { "N1", "C6" };
+inline constexpr Quad A6UBaseQuad = { "O4'", "C1'", "N1", "C6" };
 inline constexpr Bone A6UBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -653,8 +654,8 @@ inline constexpr Bone A6UBone = {
     .name = { 'A', '6', 'U', '\0' }
 };
 
-inline const BoneBase A7CBase = { "N9", "N8" };
-inline const Quad A7CBaseQuad = { "O4'", "C1'", "N9", "N8" };
+inline constexpr BoneBase A7CBase = { "N9", "N8" };
+inline constexpr Quad A7CBaseQuad = { "O4'", "C1'", "N9", "N8" };
 inline constexpr Bone A7CBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -666,8 +667,8 @@ inline constexpr Bone A7CBone = {
     .name = { 'A', '7', 'C', '\0' }
 };
 
-inline const BoneBase A7EBase = { "N9", "N8" };
-inline const Quad A7EBaseQuad = { "O4'", "C1'", "N9", "N8" };
+inline constexpr BoneBase A7EBase = { "N9", "N8" };
+inline constexpr Quad A7EBaseQuad = { "O4'", "C1'", "N9", "N8" };
 inline constexpr Bone A7EBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -679,10 +680,10 @@ inline constexpr Bone A7EBone = {
     .name = { 'A', '7', 'E', '\0' }
 };
 
-inline const BoneFirstResidue AD2BoneFirstResidue = { "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
-inline const BoneSecondResidue AD2BoneSecondResidue = { "P1", "O5'", "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
-inline const BoneBase AD2Base = { "N9", "C4" };
-inline const Quad AD2BaseQuad = { "O4'", "C1'", "N9", "C4" };
+inline constexpr BoneFirstResidue AD2BoneFirstResidue = { "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
+inline constexpr BoneSecondResidue AD2BoneSecondResidue = { "P1", "O5'", "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
+inline constexpr BoneBase AD2Base = { "N9", "C4" };
+inline constexpr Quad AD2BaseQuad = { "O4'", "C1'", "N9", "C4" };
 inline constexpr Bone AD2Bone = {
     .firstResidue = AD2BoneFirstResidue,
     .secondResidue = AD2BoneSecondResidue,
@@ -695,10 +696,10 @@ inline constexpr Bone AD2Bone = {
     .name = { 'A', 'D', '2', '\0' }
 };
 
-inline const BoneFirstResidue ADXBoneFirstResidue = { "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
-inline const BoneSecondResidue ADXBoneSecondResidue = { "PA", "O5'", "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
-inline const BoneBase ADXBase = { "N9", "C4" };
-inline const Quad ADXBaseQuad = { "O4'", "C1'", "N9", "C4" };
+inline constexpr BoneFirstResidue ADXBoneFirstResidue = { "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
+inline constexpr BoneSecondResidue ADXBoneSecondResidue = { "PA", "O5'", "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
+inline constexpr BoneBase ADXBase = { "N9", "C4" };
+inline constexpr Quad ADXBaseQuad = { "O4'", "C1'", "N9", "C4" };
 inline constexpr Bone ADXBone = {
     .firstResidue = ADXBoneFirstResidue,
     .secondResidue = ADXBoneSecondResidue,
@@ -711,8 +712,8 @@ inline constexpr Bone ADXBone = {
     .name = { 'A', 'D', 'X', '\0' }
 };
 
-inline const BoneBase B8HBase = { "C5", "C4" };
-inline const Quad B8HBaseQuad = { "O4'", "C1'", "C5", "C4" };
+inline constexpr BoneBase B8HBase = { "C5", "C4" };
+inline constexpr Quad B8HBaseQuad = { "O4'", "C1'", "C5", "C4" };
 inline constexpr Bone B8HBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -724,8 +725,8 @@ inline constexpr Bone B8HBone = {
     .name = { 'B', '8', 'H', '\0' }
 };
 
-inline const BoneBase B8KBase = { "N9", "C8" };
-inline const Quad B8KBaseQuad = { "O4'", "C1'", "N9", "C8" };
+inline constexpr BoneBase B8KBase = { "N9", "C8" };
+inline constexpr Quad B8KBaseQuad = { "O4'", "C1'", "N9", "C8" };
 inline constexpr Bone B8KBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -737,8 +738,8 @@ inline constexpr Bone B8KBone = {
     .name = { 'B', '8', 'K', '\0' }
 };
 
-inline const BoneBase B8NBase = { "C5", "C4" };
-inline const Quad B8NBaseQuad = { "O4'", "C1'", "C5", "C4" };
+inline constexpr BoneBase B8NBase = { "C5", "C4" };
+inline constexpr Quad B8NBaseQuad = { "O4'", "C1'", "C5", "C4" };
 inline constexpr Bone B8NBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -750,8 +751,8 @@ inline constexpr Bone B8NBone = {
     .name = { 'B', '8', 'N', '\0' }
 };
 
-inline const BoneBase B8QBase = { "N1", "C6" };
-inline const Quad B8QBaseQuad = { "O4'", "C1'", "N1", "C6" };
+inline constexpr BoneBase B8QBase = { "N1", "C6" };
+inline constexpr Quad B8QBaseQuad = { "O4'", "C1'", "N1", "C6" };
 inline constexpr Bone B8QBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -763,8 +764,8 @@ inline constexpr Bone B8QBone = {
     .name = { 'B', '8', 'Q', '\0' }
 };
 
-inline const BoneBase B9HBase = { "N1", "C6" };
-inline const Quad B9HBaseQuad = { "O4'", "C1'", "N1", "C6" };
+inline constexpr BoneBase B9HBase = { "N1", "C6" };
+inline constexpr Quad B9HBaseQuad = { "O4'", "C1'", "N1", "C6" };
 inline constexpr Bone B9HBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -776,8 +777,8 @@ inline constexpr Bone B9HBone = {
     .name = { 'B', '9', 'H', '\0' }
 };
 
-inline const BoneBase BGHBase = { "N9", "C8" };
-inline const Quad BGHBaseQuad = { "O4'", "C1'", "N9", "C8" };
+inline constexpr BoneBase BGHBase = { "N9", "C8" };
+inline constexpr Quad BGHBaseQuad = { "O4'", "C1'", "N9", "C8" };
 inline constexpr Bone BGHBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -789,8 +790,8 @@ inline constexpr Bone BGHBone = {
     .name = { 'B', 'G', 'H', '\0' }
 };
 
-inline const BoneBase BGMBase = { "N9", "C8" };
-inline const Quad BGMBaseQuad = { "O4'", "C1'", "N9", "C8" };
+inline constexpr BoneBase BGMBase = { "N9", "C8" };
+inline constexpr Quad BGMBaseQuad = { "O4'", "C1'", "N9", "C8" };
 inline constexpr Bone BGMBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -802,8 +803,8 @@ inline constexpr Bone BGMBone = {
     .name = { 'B', 'G', 'M', '\0' }
 };
 
-inline const BoneBase BMNBase = { "C1", "C6" };
-inline const Quad BMNBaseQuad = { "O4'", "C1'", "C1", "C6" };
+inline constexpr BoneBase BMNBase = { "C1", "C6" };
+inline constexpr Quad BMNBaseQuad = { "O4'", "C1'", "C1", "C6" };
 inline constexpr Bone BMNBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -815,8 +816,8 @@ inline constexpr Bone BMNBone = {
     .name = { 'B', 'M', 'N', '\0' }
 };
 
-inline const BoneBase BMQBase = { "N1", "C6" };
-inline const Quad BMQBaseQuad = { "O4'", "C1'", "N1", "C6" };
+inline constexpr BoneBase BMQBase = { "N1", "C6" };
+inline constexpr Quad BMQBaseQuad = { "O4'", "C1'", "N1", "C6" };
 inline constexpr Bone BMQBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -828,8 +829,8 @@ inline constexpr Bone BMQBone = {
     .name = { 'B', 'M', 'Q', '\0' }
 };
 
-inline const BoneBase C36Base = { "N1", "C6" };
-inline const Quad C36BaseQuad = { "O4'", "C1'", "N1", "C6" };
+inline constexpr BoneBase C36Base = { "N1", "C6" };
+inline constexpr Quad C36BaseQuad = { "O4'", "C1'", "N1", "C6" };
 inline constexpr Bone C36Bone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -841,8 +842,8 @@ inline constexpr Bone C36Bone = {
     .name = { 'C', '3', '6', '\0' }
 };
 
-inline const BoneBase C4JBase = { "C5", "C4" };
-inline const Quad C4JBaseQuad = { "O4'", "C1'", "C5", "C4" };
+inline constexpr BoneBase C4JBase = { "C5", "C4" };
+inline constexpr Quad C4JBaseQuad = { "O4'", "C1'", "C5", "C4" };
 inline constexpr Bone C4JBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -854,8 +855,8 @@ inline constexpr Bone C4JBone = {
     .name = { 'C', '4', 'J', '\0' }
 };
 
-inline const BoneBase CARBase = { "N1", "C6" };
-inline const Quad CARBaseQuad = { "O4'", "C1'", "N1", "C6" };
+inline constexpr BoneBase CARBase = { "N1", "C6" };
+inline constexpr Quad CARBaseQuad = { "O4'", "C1'", "N1", "C6" };
 inline constexpr Bone CARBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -867,8 +868,8 @@ inline constexpr Bone CARBone = {
     .name = { 'C', 'A', 'R', '\0' }
 };
 
-inline const BoneBase CDWBase = { "N1", "C6" };
-inline const Quad CDWBaseQuad = { "O4'", "C1'", "N1", "C6" };
+inline constexpr BoneBase CDWBase = { "N1", "C6" };
+inline constexpr Quad CDWBaseQuad = { "O4'", "C1'", "N1", "C6" };
 inline constexpr Bone CDWBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -880,8 +881,8 @@ inline constexpr Bone CDWBone = {
     .name = { 'C', 'D', 'W', '\0' }
 };
 
-inline const BoneBase CGYBase = { "C1", "C2" };
-inline const Quad CGYBaseQuad = { "O4'", "C1'", "C1", "C2" };
+inline constexpr BoneBase CGYBase = { "C1", "C2" };
+inline constexpr Quad CGYBaseQuad = { "O4'", "C1'", "C1", "C2" };
 inline constexpr Bone CGYBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -893,8 +894,8 @@ inline constexpr Bone CGYBone = {
     .name = { 'C', 'G', 'Y', '\0' }
 };
 
-inline const BoneBase CJ1Base = { "N9", "C8" };
-inline const Quad CJ1BaseQuad = { "O4'", "C1'", "N9", "C8" };
+inline constexpr BoneBase CJ1Base = { "N9", "C8" };
+inline constexpr Quad CJ1BaseQuad = { "O4'", "C1'", "N9", "C8" };
 inline constexpr Bone CJ1Bone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -906,10 +907,10 @@ inline constexpr Bone CJ1Bone = {
     .name = { 'C', 'J', '1', '\0' }
 };
 
-inline const BoneFirstResidue CSFBoneFirstResidue = { "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
-inline const BoneSecondResidue CSFBoneSecondResidue = { "PA", "O5'", "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
-inline const BoneBase CSFBase = { "N1", "C2" };
-inline const Quad CSFBaseQuad = { "O4'", "C1'", "N1", "C2" };
+inline constexpr BoneFirstResidue CSFBoneFirstResidue = { "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
+inline constexpr BoneSecondResidue CSFBoneSecondResidue = { "PA", "O5'", "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
+inline constexpr BoneBase CSFBase = { "N1", "C2" };
+inline constexpr Quad CSFBaseQuad = { "O4'", "C1'", "N1", "C2" };
 inline constexpr Bone CSFBone = {
     .firstResidue = CSFBoneFirstResidue,
     .secondResidue = CSFBoneSecondResidue,
@@ -922,8 +923,8 @@ inline constexpr Bone CSFBone = {
     .name = { 'C', 'S', 'F', '\0' }
 };
 
-inline const BoneBase CSMBase = { "N1", "C6" };
-inline const Quad CSMBaseQuad = { "O4'", "C1'", "N1", "C6" };
+inline constexpr BoneBase CSMBase = { "N1", "C6" };
+inline constexpr Quad CSMBaseQuad = { "O4'", "C1'", "N1", "C6" };
 inline constexpr Bone CSMBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -935,8 +936,8 @@ inline constexpr Bone CSMBone = {
     .name = { 'C', 'S', 'M', '\0' }
 };
 
-inline const BoneBase CTGBase = { "N1", "C2" };
-inline const Quad CTGBaseQuad = { "O4'", "C1'", "N1", "C2" };
+inline constexpr BoneBase CTGBase = { "N1", "C2" };
+inline constexpr Quad CTGBaseQuad = { "O4'", "C1'", "N1", "C2" };
 inline constexpr Bone CTGBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -948,8 +949,8 @@ inline constexpr Bone CTGBone = {
     .name = { 'C', 'T', 'G', '\0' }
 };
 
-inline const BoneBase CVCBase = { "N9", "C4" };
-inline const Quad CVCBaseQuad = { "O4'", "C1'", "N9", "C4" };
+inline constexpr BoneBase CVCBase = { "N9", "C4" };
+inline constexpr Quad CVCBaseQuad = { "O4'", "C1'", "N9", "C4" };
 inline constexpr Bone CVCBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -961,8 +962,8 @@ inline constexpr Bone CVCBone = {
     .name = { 'C', 'V', 'C', '\0' }
 };
 
-inline const BoneBase D3Base = { "N1A", "C5A" };
-inline const Quad D3BaseQuad = { "O4'", "C1'", "N1A", "C5A" };
+inline constexpr BoneBase D3Base = { "N1A", "C5A" };
+inline constexpr Quad D3BaseQuad = { "O4'", "C1'", "N1A", "C5A" };
 inline constexpr Bone D3Bone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -974,8 +975,8 @@ inline constexpr Bone D3Bone = {
     .name = { 'D', '3', '\0' }
 };
 
-inline const BoneBase D33Base = { "N1", "C4" };
-inline const Quad D33BaseQuad = { "O4'", "C1'", "N1", "C4" };
+inline constexpr BoneBase D33Base = { "N1", "C4" };
+inline constexpr Quad D33BaseQuad = { "O4'", "C1'", "N1", "C4" };
 inline constexpr Bone D33Bone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -987,8 +988,8 @@ inline constexpr Bone D33Bone = {
     .name = { 'D', '3', '3', '\0' }
 };
 
-inline const BoneBase D3NBase = { "N1", "C6" };
-inline const Quad D3NBaseQuad = { "O4'", "C1'", "N1", "C6" };
+inline constexpr BoneBase D3NBase = { "N1", "C6" };
+inline constexpr Quad D3NBaseQuad = { "O4'", "C1'", "N1", "C6" };
 inline constexpr Bone D3NBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -1000,8 +1001,8 @@ inline constexpr Bone D3NBone = {
     .name = { 'D', '3', 'N', '\0' }
 };
 
-inline const BoneBase DFTBase = { "C1", "C6" };
-inline const Quad DFTBaseQuad = { "O4'", "C1'", "C1", "C6" };
+inline constexpr BoneBase DFTBase = { "C1", "C6" };
+inline constexpr Quad DFTBaseQuad = { "O4'", "C1'", "C1", "C6" };
 inline constexpr Bone DFTBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -1013,10 +1014,10 @@ inline constexpr Bone DFTBone = {
     .name = { 'D', 'F', 'T', '\0' }
 };
 
-inline const BoneFirstResidue DGIBoneFirstResidue = { "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
-inline const BoneSecondResidue DGIBoneSecondResidue = { "PA", "O5'", "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
-inline const BoneBase DGIBase = { "N9", "C4" };
-inline const Quad DGIBaseQuad = { "O4'", "C1'", "N9", "C4" };
+inline constexpr BoneFirstResidue DGIBoneFirstResidue = { "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
+inline constexpr BoneSecondResidue DGIBoneSecondResidue = { "PA", "O5'", "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
+inline constexpr BoneBase DGIBase = { "N9", "C4" };
+inline constexpr Quad DGIBaseQuad = { "O4'", "C1'", "N9", "C4" };
 inline constexpr Bone DGIBone = {
     .firstResidue = DGIBoneFirstResidue,
     .secondResidue = DGIBoneSecondResidue,
@@ -1029,8 +1030,8 @@ inline constexpr Bone DGIBone = {
     .name = { 'D', 'G', 'I', '\0' }
 };
 
-inline const BoneBase DPYBase = { "C1", "C2" };
-inline const Quad DPYBaseQuad = { "O4'", "C1'", "C1", "C2" };
+inline constexpr BoneBase DPYBase = { "C1", "C2" };
+inline constexpr Quad DPYBaseQuad = { "O4'", "C1'", "C1", "C2" };
 inline constexpr Bone DPYBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -1042,8 +1043,8 @@ inline constexpr Bone DPYBone = {
     .name = { 'D', 'P', 'Y', '\0' }
 };
 
-inline const BoneBase DRPBase = { "C1", "C2" };
-inline const Quad DRPBaseQuad = { "O4'", "C1'", "C1", "C2" };
+inline constexpr BoneBase DRPBase = { "C1", "C2" };
+inline constexpr Quad DRPBaseQuad = { "O4'", "C1'", "C1", "C2" };
 inline constexpr Bone DRPBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -1055,8 +1056,8 @@ inline constexpr Bone DRPBone = {
     .name = { 'D', 'R', 'P', '\0' }
 };
 
-inline const BoneBase DZBase = { "C1", "C6" };
-inline const Quad DZBaseQuad = { "O4'", "C1'", "C1", "C6" };
+inline constexpr BoneBase DZBase = { "C1", "C6" };
+inline constexpr Quad DZBaseQuad = { "O4'", "C1'", "C1", "C6" };
 inline constexpr Bone DZBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -1068,8 +1069,8 @@ inline constexpr Bone DZBone = {
     .name = { 'D', 'Z', '\0' }
 };
 
-inline const BoneBase E3CBase = { "N1", "C6" };
-inline const Quad E3CBaseQuad = { "O4'", "C1'", "N1", "C6" };
+inline constexpr BoneBase E3CBase = { "N1", "C6" };
+inline constexpr Quad E3CBaseQuad = { "O4'", "C1'", "N1", "C6" };
 inline constexpr Bone E3CBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -1081,8 +1082,8 @@ inline constexpr Bone E3CBone = {
     .name = { 'E', '3', 'C', '\0' }
 };
 
-inline const BoneBase E7GBase = { "N9", "C8" };
-inline const Quad E7GBaseQuad = { "O4'", "C1'", "N9", "C8" };
+inline constexpr BoneBase E7GBase = { "N9", "C8" };
+inline constexpr Quad E7GBaseQuad = { "O4'", "C1'", "N9", "C8" };
 inline constexpr Bone E7GBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -1094,8 +1095,8 @@ inline constexpr Bone E7GBone = {
     .name = { 'E', '7', 'G', '\0' }
 };
 
-inline const BoneBase EDCBase = { "N1", "C6" };
-inline const Quad EDCBaseQuad = { "O4'", "C1'", "N1", "C6" };
+inline constexpr BoneBase EDCBase = { "N1", "C6" };
+inline constexpr Quad EDCBaseQuad = { "O4'", "C1'", "N1", "C6" };
 inline constexpr Bone EDCBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -1107,10 +1108,10 @@ inline constexpr Bone EDCBone = {
     .name = { 'E', 'D', 'C', '\0' }
 };
 
-inline const BoneFirstResidue ENPBoneFirstResidue = { "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
-inline const BoneSecondResidue ENPBoneSecondResidue = { "P1", "O5'", "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
-inline const BoneBase ENPBase = { "N9", "C4" };
-inline const Quad ENPBaseQuad = { "O4'", "C1'", "N9", "C4" };
+inline constexpr BoneFirstResidue ENPBoneFirstResidue = { "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
+inline constexpr BoneSecondResidue ENPBoneSecondResidue = { "P1", "O5'", "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
+inline constexpr BoneBase ENPBase = { "N9", "C4" };
+inline constexpr Quad ENPBaseQuad = { "O4'", "C1'", "N9", "C4" };
 inline constexpr Bone ENPBone = {
     .firstResidue = ENPBoneFirstResidue,
     .secondResidue = ENPBoneSecondResidue,
@@ -1123,8 +1124,8 @@ inline constexpr Bone ENPBone = {
     .name = { 'E', 'N', 'P', '\0' }
 };
 
-inline const BoneBase EW3Base = { "N1", "C6" };
-inline const Quad EW3BaseQuad = { "O4'", "C1'", "N1", "C6" };
+inline constexpr BoneBase EW3Base = { "N1", "C6" };
+inline constexpr Quad EW3BaseQuad = { "O4'", "C1'", "N1", "C6" };
 inline constexpr Bone EW3Bone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -1136,8 +1137,8 @@ inline constexpr Bone EW3Bone = {
     .name = { 'E', 'W', '3', '\0' }
 };
 
-inline const BoneBase F2TBase = { "N1", "C6" };
-inline const Quad F2TBaseQuad = { "O4'", "C1'", "N1", "C6" };
+inline constexpr BoneBase F2TBase = { "N1", "C6" };
+inline constexpr Quad F2TBaseQuad = { "O4'", "C1'", "N1", "C6" };
 inline constexpr Bone F2TBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -1149,8 +1150,8 @@ inline constexpr Bone F2TBone = {
     .name = { 'F', '2', 'T', '\0' }
 };
 
-inline const BoneBase F3HBase = { "N1", "C6" };
-inline const Quad F3HBaseQuad = { "O4'", "C1'", "N1", "C6" };
+inline constexpr BoneBase F3HBase = { "N1", "C6" };
+inline constexpr Quad F3HBaseQuad = { "O4'", "C1'", "N1", "C6" };
 inline constexpr Bone F3HBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -1162,10 +1163,10 @@ inline constexpr Bone F3HBone = {
     .name = { 'F', '3', 'H', '\0' }
 };
 
-inline const BoneFirstResidue FAGBoneFirstResidue = { "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
-inline const BoneSecondResidue FAGBoneSecondResidue = { "O3P", "O5'", "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
-inline const BoneBase FAGBase = { "N9", "C4" };
-inline const Quad FAGBaseQuad = { "O4'", "C1'", "N9", "C4" };
+inline constexpr BoneFirstResidue FAGBoneFirstResidue = { "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
+inline constexpr BoneSecondResidue FAGBoneSecondResidue = { "O3P", "O5'", "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
+inline constexpr BoneBase FAGBase = { "N9", "C4" };
+inline constexpr Quad FAGBaseQuad = { "O4'", "C1'", "N9", "C4" };
 inline constexpr Bone FAGBone = {
     .firstResidue = FAGBoneFirstResidue,
     .secondResidue = FAGBoneSecondResidue,
@@ -1178,8 +1179,8 @@ inline constexpr Bone FAGBone = {
     .name = { 'F', 'A', 'G', '\0' }
 };
 
-inline const BoneBase FFDBase = { "C6", "C5" };
-inline const Quad FFDBaseQuad = { "O4'", "C1'", "C6", "C5" };
+inline constexpr BoneBase FFDBase = { "C6", "C5" };
+inline constexpr Quad FFDBaseQuad = { "O4'", "C1'", "C6", "C5" };
 inline constexpr Bone FFDBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -1191,8 +1192,8 @@ inline constexpr Bone FFDBone = {
     .name = { 'F', 'F', 'D', '\0' }
 };
 
-inline const BoneBase FHUBase = { "C5", "F5" };
-inline const Quad FHUBaseQuad = { "O4'", "C1'", "C5", "F5" };
+inline constexpr BoneBase FHUBase = { "C5", "F5" };
+inline constexpr Quad FHUBaseQuad = { "O4'", "C1'", "C5", "F5" };
 inline constexpr Bone FHUBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -1204,10 +1205,10 @@ inline constexpr Bone FHUBone = {
     .name = { 'F', 'H', 'U', '\0' }
 };
 
-inline const BoneFirstResidue G4PBoneFirstResidue = { "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
-inline const BoneSecondResidue G4PBoneSecondResidue = { "PA", "O5'", "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
-inline const BoneBase G4PBase = { "N9", "C4" };
-inline const Quad G4PBaseQuad = { "O4'", "C1'", "N9", "C4" };
+inline constexpr BoneFirstResidue G4PBoneFirstResidue = { "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
+inline constexpr BoneSecondResidue G4PBoneSecondResidue = { "PA", "O5'", "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
+inline constexpr BoneBase G4PBase = { "N9", "C4" };
+inline constexpr Quad G4PBaseQuad = { "O4'", "C1'", "N9", "C4" };
 inline constexpr Bone G4PBone = {
     .firstResidue = G4PBoneFirstResidue,
     .secondResidue = G4PBoneSecondResidue,
@@ -1220,10 +1221,10 @@ inline constexpr Bone G4PBone = {
     .name = { 'G', '4', 'P', '\0' }
 };
 
-inline const BoneFirstResidue GMXBoneFirstResidue = { "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
-inline const BoneSecondResidue GMXBoneSecondResidue = { "OP3", "O5'", "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
-inline const BoneBase GMXBase = { "N9", "C4" };
-inline const Quad GMXBaseQuad = { "O4'", "C1'", "N9", "C4" };
+inline constexpr BoneFirstResidue GMXBoneFirstResidue = { "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
+inline constexpr BoneSecondResidue GMXBoneSecondResidue = { "OP3", "O5'", "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
+inline constexpr BoneBase GMXBase = { "N9", "C4" };
+inline constexpr Quad GMXBaseQuad = { "O4'", "C1'", "N9", "C4" };
 inline constexpr Bone GMXBone = {
     .firstResidue = GMXBoneFirstResidue,
     .secondResidue = GMXBoneSecondResidue,
@@ -1236,8 +1237,8 @@ inline constexpr Bone GMXBone = {
     .name = { 'G', 'M', 'X', '\0' }
 };
 
-inline const BoneBase GN7Base = { "N7", "C4" };
-inline const Quad GN7BaseQuad = { "O4'", "C1'", "N7", "C4" };
+inline constexpr BoneBase GN7Base = { "N7", "C4" };
+inline constexpr Quad GN7BaseQuad = { "O4'", "C1'", "N7", "C4" };
 inline constexpr Bone GN7Bone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -1249,8 +1250,8 @@ inline constexpr Bone GN7Bone = {
     .name = { 'G', 'N', '7', '\0' }
 };
 
-inline const BoneBase I2TBase = { "C5", "C4" };
-inline const Quad I2TBaseQuad = { "O4'", "C1'", "C5", "C4" };
+inline constexpr BoneBase I2TBase = { "C5", "C4" };
+inline constexpr Quad I2TBaseQuad = { "O4'", "C1'", "C5", "C4" };
 inline constexpr Bone I2TBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -1262,8 +1263,8 @@ inline constexpr Bone I2TBone = {
     .name = { 'I', '2', 'T', '\0' }
 };
 
-inline const BoneBase ICBase = { "N1", "C6" };
-inline const Quad ICBaseQuad = { "O4'", "C1'", "N1", "C6" };
+inline constexpr BoneBase ICBase = { "N1", "C6" };
+inline constexpr Quad ICBaseQuad = { "O4'", "C1'", "N1", "C6" };
 inline constexpr Bone ICBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -1275,8 +1276,8 @@ inline constexpr Bone ICBone = {
     .name = { 'I', 'C', '\0' }
 };
 
-inline const BoneBase IMCBase = { "N1", "C6" };
-inline const Quad IMCBaseQuad = { "O4'", "C1'", "N1", "C6" };
+inline constexpr BoneBase IMCBase = { "N1", "C6" };
+inline constexpr Quad IMCBaseQuad = { "O4'", "C1'", "N1", "C6" };
 inline constexpr Bone IMCBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -1288,10 +1289,10 @@ inline constexpr Bone IMCBone = {
     .name = { 'I', 'M', 'C', '\0' }
 };
 
-inline const BoneFirstResidue IOOBoneFirstResidue = { "C5'", "C4'", "O4'", "C3'", "O3'", "C2", "O4'" };
-inline const BoneSecondResidue IOOBoneSecondResidue = { "P", "O5'", "C5'", "C4'", "O4'", "C3'", "O3'", "C2", "O4'" };
-inline const BoneBase IOOBase = { "N9", "C1'" };
-inline const Quad IOOBaseQuad = { "O4'", "C1'", "N9", "C1'" };
+inline constexpr BoneFirstResidue IOOBoneFirstResidue = { "C5'", "C4'", "O4'", "C3'", "O3'", "C2", "O4'" };
+inline constexpr BoneSecondResidue IOOBoneSecondResidue = { "P", "O5'", "C5'", "C4'", "O4'", "C3'", "O3'", "C2", "O4'" };
+inline constexpr BoneBase IOOBase = { "N9", "C1'" };
+inline constexpr Quad IOOBaseQuad = { "O4'", "C1'", "N9", "C1'" };
 inline constexpr Bone IOOBone = {
     .firstResidue = IOOBoneFirstResidue,
     .secondResidue = IOOBoneSecondResidue,
@@ -1304,8 +1305,8 @@ inline constexpr Bone IOOBone = {
     .name = { 'I', 'O', 'O', '\0' }
 };
 
-inline const BoneBase IRNBase = { "N1", "C4" };
-inline const Quad IRNBaseQuad = { "O4'", "C1'", "N1", "C4" };
+inline constexpr BoneBase IRNBase = { "N1", "C4" };
+inline constexpr Quad IRNBaseQuad = { "O4'", "C1'", "N1", "C4" };
 inline constexpr Bone IRNBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -1317,8 +1318,8 @@ inline constexpr Bone IRNBone = {
     .name = { 'I', 'R', 'N', '\0' }
 };
 
-inline const BoneBase J4TBase = { "N1", "C6" };
-inline const Quad J4TBaseQuad = { "O4'", "C1'", "N1", "C6" };
+inline constexpr BoneBase J4TBase = { "N1", "C6" };
+inline constexpr Quad J4TBaseQuad = { "O4'", "C1'", "N1", "C6" };
 inline constexpr Bone J4TBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -1330,8 +1331,8 @@ inline constexpr Bone J4TBone = {
     .name = { 'J', '4', 'T', '\0' }
 };
 
-inline const BoneBase JLNBase = { "N1", "C4" };
-inline const Quad JLNBaseQuad = { "O4'", "C1'", "N1", "C4" };
+inline constexpr BoneBase JLNBase = { "N1", "C4" };
+inline constexpr Quad JLNBaseQuad = { "O4'", "C1'", "N1", "C4" };
 inline constexpr Bone JLNBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -1343,8 +1344,8 @@ inline constexpr Bone JLNBone = {
     .name = { 'J', 'L', 'N', '\0' }
 };
 
-inline const BoneBase JMHBase = { "N1", "C6" };
-inline const Quad JMHBaseQuad = { "O4'", "C1'", "N1", "C6" };
+inline constexpr BoneBase JMHBase = { "N1", "C6" };
+inline constexpr Quad JMHBaseQuad = { "O4'", "C1'", "N1", "C6" };
 inline constexpr Bone JMHBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -1356,8 +1357,8 @@ inline constexpr Bone JMHBone = {
     .name = { 'J', 'M', 'H', '\0' }
 };
 
-inline const BoneBase JSPBase = { "C1", "C2" };
-inline const Quad JSPBaseQuad = { "O4'", "C1'", "C1", "C2" };
+inline constexpr BoneBase JSPBase = { "C1", "C2" };
+inline constexpr Quad JSPBaseQuad = { "O4'", "C1'", "C1", "C2" };
 inline constexpr Bone JSPBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -1369,8 +1370,8 @@ inline constexpr Bone JSPBone = {
     .name = { 'J', 'S', 'P', '\0' }
 };
 
-inline const BoneBase LCCBase = { "N1", "C6" };
-inline const Quad LCCBaseQuad = { "O4'", "C1'", "N1", "C6" };
+inline constexpr BoneBase LCCBase = { "N1", "C6" };
+inline constexpr Quad LCCBaseQuad = { "O4'", "C1'", "N1", "C6" };
 inline constexpr Bone LCCBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -1382,8 +1383,8 @@ inline constexpr Bone LCCBone = {
     .name = { 'L', 'C', 'C', '\0' }
 };
 
-inline const BoneBase LHOBase = { "N1", "C4" };
-inline const Quad LHOBaseQuad = { "O4'", "C1'", "N1", "C4" };
+inline constexpr BoneBase LHOBase = { "N1", "C4" };
+inline constexpr Quad LHOBaseQuad = { "O4'", "C1'", "N1", "C4" };
 inline constexpr Bone LHOBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -1395,10 +1396,10 @@ inline constexpr Bone LHOBone = {
     .name = { 'L', 'H', 'O', '\0' }
 };
 
-inline const BoneFirstResidue LMSBoneFirstResidue = { "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
-inline const BoneSecondResidue LMSBoneSecondResidue = { "S", "O5'", "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
-inline const BoneBase LMSBase = { "N9", "C4" };
-inline const Quad LMSBaseQuad = { "O4'", "C1'", "N9", "C4" };
+inline constexpr BoneFirstResidue LMSBoneFirstResidue = { "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
+inline constexpr BoneSecondResidue LMSBoneSecondResidue = { "S", "O5'", "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
+inline constexpr BoneBase LMSBase = { "N9", "C4" };
+inline constexpr Quad LMSBaseQuad = { "O4'", "C1'", "N9", "C4" };
 inline constexpr Bone LMSBone = {
     .firstResidue = LMSBoneFirstResidue,
     .secondResidue = LMSBoneSecondResidue,
@@ -1411,8 +1412,8 @@ inline constexpr Bone LMSBone = {
     .name = { 'L', 'M', 'S', '\0' }
 };
 
-inline const BoneBase MBZBase = { "N1", "C9" };
-inline const Quad MBZBaseQuad = { "O4'", "C1'", "N1", "C9" };
+inline constexpr BoneBase MBZBase = { "N1", "C9" };
+inline constexpr Quad MBZBaseQuad = { "O4'", "C1'", "N1", "C9" };
 inline constexpr Bone MBZBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -1424,8 +1425,8 @@ inline constexpr Bone MBZBone = {
     .name = { 'M', 'B', 'Z', '\0' }
 };
 
-inline const BoneBase MDJBase = { "N1", "C2" };
-inline const Quad MDJBaseQuad = { "O4'", "C1'", "N1", "C2" };
+inline constexpr BoneBase MDJBase = { "N1", "C2" };
+inline constexpr Quad MDJBaseQuad = { "O4'", "C1'", "N1", "C2" };
 inline constexpr Bone MDJBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -1437,8 +1438,8 @@ inline constexpr Bone MDJBone = {
     .name = { 'M', 'D', 'J', '\0' }
 };
 
-inline const BoneBase MDKBase = { "N1", "C2" };
-inline const Quad MDKBaseQuad = { "O4'", "C1'", "N1", "C2" };
+inline constexpr BoneBase MDKBase = { "N1", "C2" };
+inline constexpr Quad MDKBaseQuad = { "O4'", "C1'", "N1", "C2" };
 inline constexpr Bone MDKBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -1450,8 +1451,8 @@ inline constexpr Bone MDKBone = {
     .name = { 'M', 'D', 'K', '\0' }
 };
 
-inline const BoneBase MDQBase = { "N1", "C6" };
-inline const Quad MDQBaseQuad = { "O4'", "C1'", "N1", "C6" };
+inline constexpr BoneBase MDQBase = { "N1", "C6" };
+inline constexpr Quad MDQBaseQuad = { "O4'", "C1'", "N1", "C6" };
 inline constexpr Bone MDQBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -1463,8 +1464,8 @@ inline constexpr Bone MDQBone = {
     .name = { 'M', 'D', 'Q', '\0' }
 };
 
-inline const BoneBase MDUBase = { "N1", "C6" };
-inline const Quad MDUBaseQuad = { "O4'", "C1'", "N1", "C6" };
+inline constexpr BoneBase MDUBase = { "N1", "C6" };
+inline constexpr Quad MDUBaseQuad = { "O4'", "C1'", "N1", "C6" };
 inline constexpr Bone MDUBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -1476,8 +1477,8 @@ inline constexpr Bone MDUBone = {
     .name = { 'M', 'D', 'U', '\0' }
 };
 
-inline const BoneBase ME6Base = { "N1", "C6" };
-inline const Quad ME6BaseQuad = { "O4'", "C1'", "N1", "C6" };
+inline constexpr BoneBase ME6Base = { "N1", "C6" };
+inline constexpr Quad ME6BaseQuad = { "O4'", "C1'", "N1", "C6" };
 inline constexpr Bone ME6Bone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -1489,8 +1490,8 @@ inline constexpr Bone ME6Bone = {
     .name = { 'M', 'E', '6', '\0' }
 };
 
-inline const BoneBase MFOBase = { "N9", "C8" };
-inline const Quad MFOBaseQuad = { "O4'", "C1'", "N9", "C8" };
+inline constexpr BoneBase MFOBase = { "N9", "C8" };
+inline constexpr Quad MFOBaseQuad = { "O4'", "C1'", "N9", "C8" };
 inline constexpr Bone MFOBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -1502,8 +1503,8 @@ inline constexpr Bone MFOBone = {
     .name = { 'M', 'F', 'O', '\0' }
 };
 
-inline const BoneBase MFTBase = { "N1", "C6" };
-inline const Quad MFTBaseQuad = { "O4'", "C1'", "N1", "C6" };
+inline constexpr BoneBase MFTBase = { "N1", "C6" };
+inline constexpr Quad MFTBaseQuad = { "O4'", "C1'", "N1", "C6" };
 inline constexpr Bone MFTBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -1515,10 +1516,10 @@ inline constexpr Bone MFTBone = {
     .name = { 'M', 'F', 'T', '\0' }
 };
 
-inline const BoneFirstResidue MGQBoneFirstResidue = { "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
-inline const BoneSecondResidue MGQBoneSecondResidue = { "PBE", "O5'", "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
-inline const BoneBase MGQBase = { "N9", "C4" };
-inline const Quad MGQBaseQuad = { "O4'", "C1'", "N9", "C4" };
+inline constexpr BoneFirstResidue MGQBoneFirstResidue = { "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
+inline constexpr BoneSecondResidue MGQBoneSecondResidue = { "PBE", "O5'", "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
+inline constexpr BoneBase MGQBase = { "N9", "C4" };
+inline constexpr Quad MGQBaseQuad = { "O4'", "C1'", "N9", "C4" };
 inline constexpr Bone MGQBone = {
     .firstResidue = MGQBoneFirstResidue,
     .secondResidue = MGQBoneSecondResidue,
@@ -1531,8 +1532,8 @@ inline constexpr Bone MGQBone = {
     .name = { 'M', 'G', 'Q', '\0' }
 };
 
-inline const BoneBase MHGBase = { "N9", "C8" };
-inline const Quad MHGBaseQuad = { "O4'", "C1'", "N9", "C8" };
+inline constexpr BoneBase MHGBase = { "N9", "C8" };
+inline constexpr Quad MHGBaseQuad = { "O4'", "C1'", "N9", "C8" };
 inline constexpr Bone MHGBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -1544,8 +1545,8 @@ inline constexpr Bone MHGBone = {
     .name = { 'M', 'H', 'G', '\0' }
 };
 
-inline const BoneBase MM7Base = { "C1", "C2" };
-inline const Quad MM7BaseQuad = { "O4'", "C1'", "C1", "C2" };
+inline constexpr BoneBase MM7Base = { "C1", "C2" };
+inline constexpr Quad MM7BaseQuad = { "O4'", "C1'", "C1", "C2" };
 inline constexpr Bone MM7Bone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -1557,10 +1558,10 @@ inline constexpr Bone MM7Bone = {
     .name = { 'M', 'M', '7', '\0' }
 };
 
-inline const BoneFirstResidue MMTBoneFirstResidue = { "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
-inline const BoneSecondResidue MMTBoneSecondResidue = { "NP", "O5'", "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
-inline const BoneBase MMTBase = { "N1", "C2" };
-inline const Quad MMTBaseQuad = { "O4'", "C1'", "N1", "C2" };
+inline constexpr BoneFirstResidue MMTBoneFirstResidue = { "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
+inline constexpr BoneSecondResidue MMTBoneSecondResidue = { "NP", "O5'", "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
+inline constexpr BoneBase MMTBase = { "N1", "C2" };
+inline constexpr Quad MMTBaseQuad = { "O4'", "C1'", "N1", "C2" };
 inline constexpr Bone MMTBone = {
     .firstResidue = MMTBoneFirstResidue,
     .secondResidue = MMTBoneSecondResidue,
@@ -1573,8 +1574,8 @@ inline constexpr Bone MMTBone = {
     .name = { 'M', 'M', 'T', '\0' }
 };
 
-inline const BoneBase MTRBase = { "C1", "C6" };
-inline const Quad MTRBaseQuad = { "O4'", "C1'", "C1", "C6" };
+inline constexpr BoneBase MTRBase = { "C1", "C6" };
+inline constexpr Quad MTRBaseQuad = { "O4'", "C1'", "C1", "C6" };
 inline constexpr Bone MTRBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -1586,8 +1587,8 @@ inline constexpr Bone MTRBone = {
     .name = { 'M', 'T', 'R', '\0' }
 };
 
-inline const BoneBase MTUBase = { "N9", "C8" };
-inline const Quad MTUBaseQuad = { "O4'", "C1'", "N9", "C8" };
+inline constexpr BoneBase MTUBase = { "N9", "C8" };
+inline constexpr Quad MTUBaseQuad = { "O4'", "C1'", "N9", "C8" };
 inline constexpr Bone MTUBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -1599,8 +1600,8 @@ inline constexpr Bone MTUBone = {
     .name = { 'M', 'T', 'U', '\0' }
 };
 
-inline const BoneBase N5IBase = { "NE1", "CE2" };
-inline const Quad N5IBaseQuad = { "O4'", "C1'", "NE1", "CE2" };
+inline constexpr BoneBase N5IBase = { "NE1", "CE2" };
+inline constexpr Quad N5IBaseQuad = { "O4'", "C1'", "NE1", "CE2" };
 inline constexpr Bone N5IBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -1612,8 +1613,8 @@ inline constexpr Bone N5IBone = {
     .name = { 'N', '5', 'I', '\0' }
 };
 
-inline const BoneBase N6GBase = { "N9", "C8" };
-inline const Quad N6GBaseQuad = { "O4'", "C1'", "N9", "C8" };
+inline constexpr BoneBase N6GBase = { "N9", "C8" };
+inline constexpr Quad N6GBaseQuad = { "O4'", "C1'", "N9", "C8" };
 inline constexpr Bone N6GBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -1625,8 +1626,8 @@ inline constexpr Bone N6GBone = {
     .name = { 'N', '6', 'G', '\0' }
 };
 
-inline const BoneBase NCUBase = { "N1", "C6" };
-inline const Quad NCUBaseQuad = { "O4'", "C1'", "N1", "C6" };
+inline constexpr BoneBase NCUBase = { "N1", "C6" };
+inline constexpr Quad NCUBaseQuad = { "O4'", "C1'", "N1", "C6" };
 inline constexpr Bone NCUBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -1638,8 +1639,8 @@ inline constexpr Bone NCUBone = {
     .name = { 'N', 'C', 'U', '\0' }
 };
 
-inline const BoneBase NF2Base = { "C1", "C2" };
-inline const Quad NF2BaseQuad = { "O4'", "C1'", "C1", "C2" };
+inline constexpr BoneBase NF2Base = { "C1", "C2" };
+inline constexpr Quad NF2BaseQuad = { "O4'", "C1'", "C1", "C2" };
 inline constexpr Bone NF2Bone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -1651,8 +1652,8 @@ inline constexpr Bone NF2Bone = {
     .name = { 'N', 'F', '2', '\0' }
 };
 
-inline const BoneBase NP3Base = { "N1", "C2" };
-inline const Quad NP3BaseQuad = { "O4'", "C1'", "N1", "C2" };
+inline constexpr BoneBase NP3Base = { "N1", "C2" };
+inline constexpr Quad NP3BaseQuad = { "O4'", "C1'", "N1", "C2" };
 inline constexpr Bone NP3Bone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -1664,8 +1665,8 @@ inline constexpr Bone NP3Bone = {
     .name = { 'N', 'P', '3', '\0' }
 };
 
-inline const BoneBase NTTBase = { "N1", "C6" };
-inline const Quad NTTBaseQuad = { "O4'", "C1'", "N1", "C6" };
+inline constexpr BoneBase NTTBase = { "N1", "C6" };
+inline constexpr Quad NTTBaseQuad = { "O4'", "C1'", "N1", "C6" };
 inline constexpr Bone NTTBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -1677,10 +1678,10 @@ inline constexpr Bone NTTBone = {
     .name = { 'N', 'T', 'T', '\0' }
 };
 
-inline const BoneFirstResidue OADBoneFirstResidue = { "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
-inline const BoneSecondResidue OADBoneSecondResidue = { "PA", "O5'", "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
-inline const BoneBase OADBase = { "N9", "C4" };
-inline const Quad OADBaseQuad = { "O4'", "C1'", "N9", "C4" };
+inline constexpr BoneFirstResidue OADBoneFirstResidue = { "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
+inline constexpr BoneSecondResidue OADBoneSecondResidue = { "PA", "O5'", "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
+inline constexpr BoneBase OADBase = { "N9", "C4" };
+inline constexpr Quad OADBaseQuad = { "O4'", "C1'", "N9", "C4" };
 inline constexpr Bone OADBone = {
     .firstResidue = OADBoneFirstResidue,
     .secondResidue = OADBoneSecondResidue,
@@ -1693,10 +1694,10 @@ inline constexpr Bone OADBone = {
     .name = { 'O', 'A', 'D', '\0' }
 };
 
-inline const BoneFirstResidue OKQBoneFirstResidue = { "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
-inline const BoneSecondResidue OKQBoneSecondResidue = { "P1", "O5'", "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
-inline const BoneBase OKQBase = { "N1", "C2" };
-inline const Quad OKQBaseQuad = { "O4'", "C1'", "N1", "C2" };
+inline constexpr BoneFirstResidue OKQBoneFirstResidue = { "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
+inline constexpr BoneSecondResidue OKQBoneSecondResidue = { "P1", "O5'", "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
+inline constexpr BoneBase OKQBase = { "N1", "C2" };
+inline constexpr Quad OKQBaseQuad = { "O4'", "C1'", "N1", "C2" };
 inline constexpr Bone OKQBone = {
     .firstResidue = OKQBoneFirstResidue,
     .secondResidue = OKQBoneSecondResidue,
@@ -1709,8 +1710,8 @@ inline constexpr Bone OKQBone = {
     .name = { 'O', 'K', 'Q', '\0' }
 };
 
-inline const BoneBase ONEBase = { "N1", "C6" };
-inline const Quad ONEBaseQuad = { "O4'", "C1'", "N1", "C6" };
+inline constexpr BoneBase ONEBase = { "N1", "C6" };
+inline constexpr Quad ONEBaseQuad = { "O4'", "C1'", "N1", "C6" };
 inline constexpr Bone ONEBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -1722,8 +1723,8 @@ inline constexpr Bone ONEBone = {
     .name = { 'O', 'N', 'E', '\0' }
 };
 
-inline const BoneBase P2UBase = { "C5", "C4" };
-inline const Quad P2UBaseQuad = { "O4'", "C1'", "C5", "C4" };
+inline constexpr BoneBase P2UBase = { "C5", "C4" };
+inline constexpr Quad P2UBaseQuad = { "O4'", "C1'", "C5", "C4" };
 inline constexpr Bone P2UBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -1735,8 +1736,8 @@ inline constexpr Bone P2UBone = {
     .name = { 'P', '2', 'U', '\0' }
 };
 
-inline const BoneBase P7GBase = { "N9", "C8" };
-inline const Quad P7GBaseQuad = { "O4'", "C1'", "N9", "C8" };
+inline constexpr BoneBase P7GBase = { "N9", "C8" };
+inline constexpr Quad P7GBaseQuad = { "O4'", "C1'", "N9", "C8" };
 inline constexpr Bone P7GBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -1748,8 +1749,8 @@ inline constexpr Bone P7GBone = {
     .name = { 'P', '7', 'G', '\0' }
 };
 
-inline const BoneBase PBTBase = { "N1", "O2" };
-inline const Quad PBTBaseQuad = { "O4'", "C1'", "N1", "O2" };
+inline constexpr BoneBase PBTBase = { "N1", "O2" };
+inline constexpr Quad PBTBaseQuad = { "O4'", "C1'", "N1", "O2" };
 inline constexpr Bone PBTBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -1761,8 +1762,8 @@ inline constexpr Bone PBTBone = {
     .name = { 'P', 'B', 'T', '\0' }
 };
 
-inline const BoneBase PSUBase = { "C5", "C4" };
-inline const Quad PSUBaseQuad = { "O4'", "C1'", "C5", "C4" };
+inline constexpr BoneBase PSUBase = { "C5", "C4" };
+inline constexpr Quad PSUBaseQuad = { "O4'", "C1'", "C5", "C4" };
 inline constexpr Bone PSUBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -1774,8 +1775,8 @@ inline constexpr Bone PSUBone = {
     .name = { 'P', 'S', 'U', '\0' }
 };
 
-inline const BoneBase PYYBase = { "C1", "C2" };
-inline const Quad PYYBaseQuad = { "O4'", "C1'", "C1", "C2" };
+inline constexpr BoneBase PYYBase = { "C1", "C2" };
+inline constexpr Quad PYYBaseQuad = { "O4'", "C1'", "C1", "C2" };
 inline constexpr Bone PYYBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -1787,8 +1788,8 @@ inline constexpr Bone PYYBone = {
     .name = { 'P', 'Y', 'Y', '\0' }
 };
 
-inline const BoneBase QBTBase = { "N1", "C6" };
-inline const Quad QBTBaseQuad = { "O4'", "C1'", "N1", "C6" };
+inline constexpr BoneBase QBTBase = { "N1", "C6" };
+inline constexpr Quad QBTBaseQuad = { "O4'", "C1'", "N1", "C6" };
 inline constexpr Bone QBTBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -1800,8 +1801,8 @@ inline constexpr Bone QBTBone = {
     .name = { 'Q', 'B', 'T', '\0' }
 };
 
-inline const BoneBase QCKBase = { "N1", "C6" };
-inline const Quad QCKBaseQuad = { "O4'", "C1'", "N1", "C6" };
+inline constexpr BoneBase QCKBase = { "N1", "C6" };
+inline constexpr Quad QCKBaseQuad = { "O4'", "C1'", "N1", "C6" };
 inline constexpr Bone QCKBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -1813,8 +1814,8 @@ inline constexpr Bone QCKBone = {
     .name = { 'Q', 'C', 'K', '\0' }
 };
 
-inline const BoneBase RCEBase = { "N1", "C6" };
-inline const Quad RCEBaseQuad = { "O4'", "C1'", "N1", "C6" };
+inline constexpr BoneBase RCEBase = { "N1", "C6" };
+inline constexpr Quad RCEBaseQuad = { "O4'", "C1'", "N1", "C6" };
 inline constexpr Bone RCEBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -1826,10 +1827,10 @@ inline constexpr Bone RCEBone = {
     .name = { 'R', 'C', 'E', '\0' }
 };
 
-inline const BoneFirstResidue RIABoneFirstResidue = { "C5'", "C4'", "O1'", "C3'", "O3'", "C1'", "O4'" };
-inline const BoneSecondResidue RIABoneSecondResidue = { "P'", "O5'", "C5'", "C4'", "O1'", "C3'", "O3'", "C1'", "O4'" };
-inline const BoneBase RIABase = { "O2A", "O3A" };
-inline const Quad RIABaseQuad = { "O4'", "C1'", "O2A", "O3A" };
+inline constexpr BoneFirstResidue RIABoneFirstResidue = { "C5'", "C4'", "O1'", "C3'", "O3'", "C1'", "O4'" };
+inline constexpr BoneSecondResidue RIABoneSecondResidue = { "P'", "O5'", "C5'", "C4'", "O1'", "C3'", "O3'", "C1'", "O4'" };
+inline constexpr BoneBase RIABase = { "O2A", "O3A" };
+inline constexpr Quad RIABaseQuad = { "O4'", "C1'", "O2A", "O3A" };
 inline constexpr Bone RIABone = {
     .firstResidue = RIABoneFirstResidue,
     .secondResidue = RIABoneSecondResidue,
@@ -1842,10 +1843,10 @@ inline constexpr Bone RIABone = {
     .name = { 'R', 'I', 'A', '\0' }
 };
 
-inline const BoneFirstResidue RTPBoneFirstResidue = { "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
-inline const BoneSecondResidue RTPBoneSecondResidue = { "PA", "O5'", "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
-inline const BoneBase RTPBase = { "N1", "C5" };
-inline const Quad RTPBaseQuad = { "O4'", "C1'", "N1", "C5" };
+inline constexpr BoneFirstResidue RTPBoneFirstResidue = { "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
+inline constexpr BoneSecondResidue RTPBoneSecondResidue = { "PA", "O5'", "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
+inline constexpr BoneBase RTPBase = { "N1", "C5" };
+inline constexpr Quad RTPBaseQuad = { "O4'", "C1'", "N1", "C5" };
 inline constexpr Bone RTPBone = {
     .firstResidue = RTPBoneFirstResidue,
     .secondResidue = RTPBoneSecondResidue,
@@ -1858,8 +1859,8 @@ inline constexpr Bone RTPBone = {
     .name = { 'R', 'T', 'P', '\0' }
 };
 
-inline const BoneBase SAYBase = { "CAA", "CAF" };
-inline const Quad SAYBaseQuad = { "O4'", "C1'", "CAA", "CAF" };
+inline constexpr BoneBase SAYBase = { "CAA", "CAF" };
+inline constexpr Quad SAYBaseQuad = { "O4'", "C1'", "CAA", "CAF" };
 inline constexpr Bone SAYBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -1871,8 +1872,8 @@ inline constexpr Bone SAYBone = {
     .name = { 'S', 'A', 'Y', '\0' }
 };
 
-inline const BoneBase T0TBase = { "C1", "C6" };
-inline const Quad T0TBaseQuad = { "O4'", "C1'", "C1", "C6" };
+inline constexpr BoneBase T0TBase = { "C1", "C6" };
+inline constexpr Quad T0TBaseQuad = { "O4'", "C1'", "C1", "C6" };
 inline constexpr Bone T0TBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -1884,8 +1885,8 @@ inline constexpr Bone T0TBone = {
     .name = { 'T', '0', 'T', '\0' }
 };
 
-inline const BoneBase TDYBase = { "N1", "C6" };
-inline const Quad TDYBaseQuad = { "O4'", "C1'", "N1", "C6" };
+inline constexpr BoneBase TDYBase = { "N1", "C6" };
+inline constexpr Quad TDYBaseQuad = { "O4'", "C1'", "N1", "C6" };
 inline constexpr Bone TDYBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -1897,10 +1898,10 @@ inline constexpr Bone TDYBone = {
     .name = { 'T', 'D', 'Y', '\0' }
 };
 
-inline const BoneFirstResidue TFFBoneFirstResidue = { "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
-inline const BoneSecondResidue TFFBoneSecondResidue = { "PA", "O5'", "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
-inline const BoneBase TFFBase = { "N1", "C2" };
-inline const Quad TFFBaseQuad = { "O4'", "C1'", "N1", "C2" };
+inline constexpr BoneFirstResidue TFFBoneFirstResidue = { "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
+inline constexpr BoneSecondResidue TFFBoneSecondResidue = { "PA", "O5'", "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
+inline constexpr BoneBase TFFBase = { "N1", "C2" };
+inline constexpr Quad TFFBaseQuad = { "O4'", "C1'", "N1", "C2" };
 inline constexpr Bone TFFBone = {
     .firstResidue = TFFBoneFirstResidue,
     .secondResidue = TFFBoneSecondResidue,
@@ -1913,10 +1914,10 @@ inline constexpr Bone TFFBone = {
     .name = { 'T', 'F', 'F', '\0' }
 };
 
-inline const BoneFirstResidue THPBoneFirstResidue = { "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
-inline const BoneSecondResidue THPBoneSecondResidue = { "P2", "O5'", "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
-inline const BoneBase THPBase = { "N1", "C2" };
-inline const Quad THPBaseQuad = { "O4'", "C1'", "N1", "C2" };
+inline constexpr BoneFirstResidue THPBoneFirstResidue = { "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
+inline constexpr BoneSecondResidue THPBoneSecondResidue = { "P2", "O5'", "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
+inline constexpr BoneBase THPBase = { "N1", "C2" };
+inline constexpr Quad THPBaseQuad = { "O4'", "C1'", "N1", "C2" };
 inline constexpr Bone THPBone = {
     .firstResidue = THPBoneFirstResidue,
     .secondResidue = THPBoneSecondResidue,
@@ -1929,8 +1930,8 @@ inline constexpr Bone THPBone = {
     .name = { 'T', 'H', 'P', '\0' }
 };
 
-inline const BoneBase TLBBase = { "N1", "C6" };
-inline const Quad TLBBaseQuad = { "O4'", "C1'", "N1", "C6" };
+inline constexpr BoneBase TLBBase = { "N1", "C6" };
+inline constexpr Quad TLBBaseQuad = { "O4'", "C1'", "N1", "C6" };
 inline constexpr Bone TLBBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -1942,8 +1943,8 @@ inline constexpr Bone TLBBone = {
     .name = { 'T', 'L', 'B', '\0' }
 };
 
-inline const BoneBase TLCBase = { "N1", "C6" };
-inline const Quad TLCBaseQuad = { "O4'", "C1'", "N1", "C6" };
+inline constexpr BoneBase TLCBase = { "N1", "C6" };
+inline constexpr Quad TLCBaseQuad = { "O4'", "C1'", "N1", "C6" };
 inline constexpr Bone TLCBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -1955,8 +1956,8 @@ inline constexpr Bone TLCBone = {
     .name = { 'T', 'L', 'C', '\0' }
 };
 
-inline const BoneBase TLNBase = { "N1", "C6" };
-inline const Quad TLNBaseQuad = { "O4'", "C1'", "N1", "C6" };
+inline constexpr BoneBase TLNBase = { "N1", "C6" };
+inline constexpr Quad TLNBaseQuad = { "O4'", "C1'", "N1", "C6" };
 inline constexpr Bone TLNBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -1968,10 +1969,10 @@ inline constexpr Bone TLNBone = {
     .name = { 'T', 'L', 'N', '\0' }
 };
 
-inline const BoneFirstResidue TPGBoneFirstResidue = { "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
-inline const BoneSecondResidue TPGBoneSecondResidue = { "PAT", "O5'", "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
-inline const BoneBase TPGBase = { "N9", "C4" };
-inline const Quad TPGBaseQuad = { "O4'", "C1'", "N9", "C4" };
+inline constexpr BoneFirstResidue TPGBoneFirstResidue = { "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
+inline constexpr BoneSecondResidue TPGBoneSecondResidue = { "PAT", "O5'", "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
+inline constexpr BoneBase TPGBase = { "N9", "C4" };
+inline constexpr Quad TPGBaseQuad = { "O4'", "C1'", "N9", "C4" };
 inline constexpr Bone TPGBone = {
     .firstResidue = TPGBoneFirstResidue,
     .secondResidue = TPGBoneSecondResidue,
@@ -1984,8 +1985,8 @@ inline constexpr Bone TPGBone = {
     .name = { 'T', 'P', 'G', '\0' }
 };
 
-inline const BoneBase U23Base = { "N1", "C6" };
-inline const Quad U23BaseQuad = { "O4'", "C1'", "N1", "C6" };
+inline constexpr BoneBase U23Base = { "N1", "C6" };
+inline constexpr Quad U23BaseQuad = { "O4'", "C1'", "N1", "C6" };
 inline constexpr Bone U23Bone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -1997,10 +1998,10 @@ inline constexpr Bone U23Bone = {
     .name = { 'U', '2', '3', '\0' }
 };
 
-inline const BoneFirstResidue UBDBoneFirstResidue = { "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
-inline const BoneSecondResidue UBDBoneSecondResidue = { "P1", "O5'", "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
-inline const BoneBase UBDBase = { "N1", "C6" };
-inline const Quad UBDBaseQuad = { "O4'", "C1'", "N1", "C6" };
+inline constexpr BoneFirstResidue UBDBoneFirstResidue = { "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
+inline constexpr BoneSecondResidue UBDBoneSecondResidue = { "P1", "O5'", "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
+inline constexpr BoneBase UBDBase = { "N1", "C6" };
+inline constexpr Quad UBDBaseQuad = { "O4'", "C1'", "N1", "C6" };
 inline constexpr Bone UBDBone = {
     .firstResidue = UBDBoneFirstResidue,
     .secondResidue = UBDBoneSecondResidue,
@@ -2013,10 +2014,10 @@ inline constexpr Bone UBDBone = {
     .name = { 'U', 'B', 'D', '\0' }
 };
 
-inline const BoneFirstResidue UDPBoneFirstResidue = { "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
-inline const BoneSecondResidue UDPBoneSecondResidue = { "PA", "O5'", "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
-inline const BoneBase UDPBase = { "N1", "C6" };
-inline const Quad UDPBaseQuad = { "O4'", "C1'", "N1", "C6" };
+inline constexpr BoneFirstResidue UDPBoneFirstResidue = { "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
+inline constexpr BoneSecondResidue UDPBoneSecondResidue = { "PA", "O5'", "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
+inline constexpr BoneBase UDPBase = { "N1", "C6" };
+inline constexpr Quad UDPBaseQuad = { "O4'", "C1'", "N1", "C6" };
 inline constexpr Bone UDPBone = {
     .firstResidue = UDPBoneFirstResidue,
     .secondResidue = UDPBoneSecondResidue,
@@ -2029,8 +2030,8 @@ inline constexpr Bone UDPBone = {
     .name = { 'U', 'D', 'P', '\0' }
 };
 
-inline const BoneBase UF2Base = { "N1", "C6" };
-inline const Quad UF2BaseQuad = { "O4'", "C1'", "N1", "C6" };
+inline constexpr BoneBase UF2Base = { "N1", "C6" };
+inline constexpr Quad UF2BaseQuad = { "O4'", "C1'", "N1", "C6" };
 inline constexpr Bone UF2Bone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -2042,8 +2043,8 @@ inline constexpr Bone UF2Bone = {
     .name = { 'U', 'F', '2', '\0' }
 };
 
-inline const BoneBase UMSBase = { "N1", "C6" };
-inline const Quad UMSBaseQuad = { "O4'", "C1'", "N1", "C6" };
+inline constexpr BoneBase UMSBase = { "N1", "C6" };
+inline constexpr Quad UMSBaseQuad = { "O4'", "C1'", "N1", "C6" };
 inline constexpr Bone UMSBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -2055,8 +2056,8 @@ inline constexpr Bone UMSBone = {
     .name = { 'U', 'M', 'S', '\0' }
 };
 
-inline const BoneBase UMXBase = { "N1", "C6" };
-inline const Quad UMXBaseQuad = { "O4'", "C1'", "N1", "C6" };
+inline constexpr BoneBase UMXBase = { "N1", "C6" };
+inline constexpr Quad UMXBaseQuad = { "O4'", "C1'", "N1", "C6" };
 inline constexpr Bone UMXBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -2068,8 +2069,8 @@ inline constexpr Bone UMXBone = {
     .name = { 'U', 'M', 'X', '\0' }
 };
 
-inline const BoneBase UOBBase = { "N1", "C6" };
-inline const Quad UOBBaseQuad = { "O4'", "C1'", "N1", "C6" };
+inline constexpr BoneBase UOBBase = { "N1", "C6" };
+inline constexpr Quad UOBBaseQuad = { "O4'", "C1'", "N1", "C6" };
 inline constexpr Bone UOBBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -2081,8 +2082,8 @@ inline constexpr Bone UOBBone = {
     .name = { 'U', 'O', 'B', '\0' }
 };
 
-inline const BoneBase UR3Base = { "N1", "C6" };
-inline const Quad UR3BaseQuad = { "O4'", "C1'", "N1", "C6" };
+inline constexpr BoneBase UR3Base = { "N1", "C6" };
+inline constexpr Quad UR3BaseQuad = { "O4'", "C1'", "N1", "C6" };
 inline constexpr Bone UR3Bone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -2094,8 +2095,8 @@ inline constexpr Bone UR3Bone = {
     .name = { 'U', 'R', '3', '\0' }
 };
 
-inline const BoneBase URXBase = { "N1", "C6" };
-inline const Quad URXBaseQuad = { "O4'", "C1'", "N1", "C6" };
+inline constexpr BoneBase URXBase = { "N1", "C6" };
+inline constexpr Quad URXBaseQuad = { "O4'", "C1'", "N1", "C6" };
 inline constexpr Bone URXBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -2107,8 +2108,8 @@ inline constexpr Bone URXBone = {
     .name = { 'U', 'R', 'X', '\0' }
 };
 
-inline const BoneBase US4Base = { "N1", "C6" };
-inline const Quad US4BaseQuad = { "O4'", "C1'", "N1", "C6" };
+inline constexpr BoneBase US4Base = { "N1", "C6" };
+inline constexpr Quad US4BaseQuad = { "O4'", "C1'", "N1", "C6" };
 inline constexpr Bone US4Bone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -2120,8 +2121,8 @@ inline constexpr Bone US4Bone = {
     .name = { 'U', 'S', '4', '\0' }
 };
 
-inline const BoneBase USMBase = { "N1", "C6" };
-inline const Quad USMBaseQuad = { "O4'", "C1'", "N1", "C6" };
+inline constexpr BoneBase USMBase = { "N1", "C6" };
+inline constexpr Quad USMBaseQuad = { "O4'", "C1'", "N1", "C6" };
 inline constexpr Bone USMBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -2133,8 +2134,8 @@ inline constexpr Bone USMBone = {
     .name = { 'U', 'S', 'M', '\0' }
 };
 
-inline const BoneBase UVXBase = { "N1", "C6" };
-inline const Quad UVXBaseQuad = { "O4'", "C1'", "N1", "C6" };
+inline constexpr BoneBase UVXBase = { "N1", "C6" };
+inline constexpr Quad UVXBaseQuad = { "O4'", "C1'", "N1", "C6" };
 inline constexpr Bone UVXBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -2146,8 +2147,8 @@ inline constexpr Bone UVXBone = {
     .name = { 'U', 'V', 'X', '\0' }
 };
 
-inline const BoneBase UY1Base = { "C5", "C4" };
-inline const Quad UY1BaseQuad = { "O4'", "C1'", "C5", "C4" };
+inline constexpr BoneBase UY1Base = { "C5", "C4" };
+inline constexpr Quad UY1BaseQuad = { "O4'", "C1'", "C5", "C4" };
 inline constexpr Bone UY1Bone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -2159,8 +2160,8 @@ inline constexpr Bone UY1Bone = {
     .name = { 'U', 'Y', '1', '\0' }
 };
 
-inline const BoneBase WC7Base = { "N1", "C4" };
-inline const Quad WC7BaseQuad = { "O4'", "C1'", "N1", "C4" };
+inline constexpr BoneBase WC7Base = { "N1", "C4" };
+inline constexpr Quad WC7BaseQuad = { "O4'", "C1'", "N1", "C4" };
 inline constexpr Bone WC7Bone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -2172,8 +2173,8 @@ inline constexpr Bone WC7Bone = {
     .name = { 'W', 'C', '7', '\0' }
 };
 
-inline const BoneBase XAEBase = { "N9", "C8" };
-inline const Quad XAEBaseQuad = { "O4'", "C1'", "N9", "C8" };
+inline constexpr BoneBase XAEBase = { "N9", "C8" };
+inline constexpr Quad XAEBaseQuad = { "O4'", "C1'", "N9", "C8" };
 inline constexpr Bone XAEBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -2185,8 +2186,8 @@ inline constexpr Bone XAEBone = {
     .name = { 'X', 'A', 'E', '\0' }
 };
 
-inline const BoneBase XCSBase = { "C8", "C6" };
-inline const Quad XCSBaseQuad = { "O4'", "C1'", "C8", "C6" };
+inline constexpr BoneBase XCSBase = { "C8", "C6" };
+inline constexpr Quad XCSBaseQuad = { "O4'", "C1'", "C8", "C6" };
 inline constexpr Bone XCSBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -2198,8 +2199,8 @@ inline constexpr Bone XCSBone = {
     .name = { 'X', 'C', 'S', '\0' }
 };
 
-inline const BoneBase XTYBase = { "C8", "C6" };
-inline const Quad XTYBaseQuad = { "O4'", "C1'", "C8", "C6" };
+inline constexpr BoneBase XTYBase = { "C8", "C6" };
+inline constexpr Quad XTYBaseQuad = { "O4'", "C1'", "C8", "C6" };
 inline constexpr Bone XTYBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
     .secondResidue = STANDARD_SECOND_RESIDUE,
@@ -2216,170 +2217,170 @@ inline constexpr Bone XTYBone = {
 
 namespace LLKAInternal {
 
-inline const std::map<LLKABones::ANString, const LLKABones::Bone &> KNOWN_NON_STANDARD_RESIDUES = {
-    { "05A", LLKABones::_05ABone },
-    { "05H", LLKABones::_05HBone },
-    { "05K", LLKABones::_05KBone },
-    { "0AU", LLKABones::_0AUBone },
-    {  "0U",  LLKABones::_0UBone },
-    { "0U1", LLKABones::_0U1Bone },
-    { "128", LLKABones::_128Bone },
-    { "1RN", LLKABones::_1RNBone },
-    { "1TL", LLKABones::_1TLBone },
-    { "1W5", LLKABones::_1W5Bone },
-    { "2DF", LLKABones::_2DFBone },
-    { "2LA", LLKABones::_2LABone },
-    { "2OM", LLKABones::_2OMBone },
-    { "3MU", LLKABones::_3MUBone },
-    { "3TD", LLKABones::_3TDBone },
-    { "4EN", LLKABones::_4ENBone },
-    { "4MF", LLKABones::_4MFBone },
-    { "56B", LLKABones::_56BBone },
-    { "5FA", LLKABones::_5FABone },
-    { "5NC", LLKABones::_5NCBone },
-    { "5UA", LLKABones::_5UABone },
-    { "64P", LLKABones::_64PBone },
-    { "64T", LLKABones::_64TBone },
-    { "6FK", LLKABones::_6FKBone },
-    { "6FM", LLKABones::_6FMBone },
-    { "6FU", LLKABones::_6FUBone },
-    { "6HA", LLKABones::_6HABone },
-    { "6HC", LLKABones::_6HCBone },
-    { "6HG", LLKABones::_6HGBone },
-    { "6HT", LLKABones::_6HTBone },
-    { "6MI", LLKABones::_6MIBone },
-    { "7AT", LLKABones::_7ATBone },
-    { "7MG", LLKABones::_7MGBone },
-    { "7SN", LLKABones::_7SNBone },
-    { "8AA", LLKABones::_8AABone },
-    { "8AG", LLKABones::_8AGBone },
-    { "8AZ", LLKABones::_8AZBone },
-    { "8MG", LLKABones::_8MGBone },
-    { "8PY", LLKABones::_8PYBone },
-    { "8RO", LLKABones::_8ROBone },
-    { "8YN", LLKABones::_8YNBone },
-    { "93D", LLKABones::_93DBone },
-    { "9V9", LLKABones::_9V9Bone },
-    { "A1P", LLKABones::A1PBone },
-    { "A3P", LLKABones::A3PBone },
-    { "A6C", LLKABones::A6CBone },
-    { "A6U", LLKABones::A6UBone },
-    { "A7C", LLKABones::A7CBone },
-    { "A7E", LLKABones::A7EBone },
-    { "AD2", LLKABones::AD2Bone },
-    { "ADX", LLKABones::ADXBone },
-    { "B8H", LLKABones::B8HBone },
-    { "B8K", LLKABones::B8KBone },
-    { "B8N", LLKABones::B8NBone },
-    { "B8Q", LLKABones::B8QBone },
-    { "B9H", LLKABones::B9HBone },
-    { "BGH", LLKABones::BGHBone },
-    { "BGM", LLKABones::BGMBone },
-    { "BMN", LLKABones::BMNBone },
-    { "BMQ", LLKABones::BMQBone },
-    { "C36", LLKABones::C36Bone },
-    { "C4J", LLKABones::C4JBone },
-    { "CAR", LLKABones::CARBone },
-    { "CDW", LLKABones::CDWBone },
-    { "CGY", LLKABones::CGYBone },
-    { "CJ1", LLKABones::CJ1Bone },
-    { "CSF", LLKABones::CSFBone },
-    { "CSM", LLKABones::CSMBone },
-    { "CTG", LLKABones::CTGBone },
-    { "CVC", LLKABones::CVCBone },
-    {  "D3",  LLKABones::D3Bone },
-    { "D33", LLKABones::D33Bone },
-    { "D3N", LLKABones::D3NBone },
-    { "DFT", LLKABones::DFTBone },
-    { "DGI", LLKABones::DGIBone },
-    { "DPY", LLKABones::DPYBone },
-    { "DRP", LLKABones::DRPBone },
-    {  "DZ",  LLKABones::DZBone },
-    { "E3C", LLKABones::E3CBone },
-    { "E7G", LLKABones::E7GBone },
-    { "EDC", LLKABones::EDCBone },
-    { "ENP", LLKABones::ENPBone },
-    { "EW3", LLKABones::EW3Bone },
-    { "F2T", LLKABones::F2TBone },
-    { "F3H", LLKABones::F3HBone },
-    { "FAG", LLKABones::FAGBone },
-    { "FFD", LLKABones::FFDBone },
-    { "FHU", LLKABones::FHUBone },
-    { "G4P", LLKABones::G4PBone },
-    { "GMX", LLKABones::GMXBone },
-    { "GN7", LLKABones::GN7Bone },
-    { "I2T", LLKABones::I2TBone },
-    {  "IC",  LLKABones::ICBone },
-    { "IMC", LLKABones::IMCBone },
-    { "IOO", LLKABones::IOOBone },
-    { "IRN", LLKABones::IRNBone },
-    { "J4T", LLKABones::J4TBone },
-    { "JLN", LLKABones::JLNBone },
-    { "JMH", LLKABones::JMHBone },
-    { "JSP", LLKABones::JSPBone },
-    { "LCC", LLKABones::LCCBone },
-    { "LHO", LLKABones::LHOBone },
-    { "LMS", LLKABones::LMSBone },
-    { "MBZ", LLKABones::MBZBone },
-    { "MDJ", LLKABones::MDJBone },
-    { "MDK", LLKABones::MDKBone },
-    { "MDQ", LLKABones::MDQBone },
-    { "MDU", LLKABones::MDUBone },
-    { "ME6", LLKABones::ME6Bone },
-    { "MFO", LLKABones::MFOBone },
-    { "MFT", LLKABones::MFTBone },
-    { "MGQ", LLKABones::MGQBone },
-    { "MHG", LLKABones::MHGBone },
-    { "MM7", LLKABones::MM7Bone },
-    { "MMT", LLKABones::MMTBone },
-    { "MTR", LLKABones::MTRBone },
-    { "MTU", LLKABones::MTUBone },
-    { "N5I", LLKABones::N5IBone },
-    { "N6G", LLKABones::N6GBone },
-    { "NCU", LLKABones::NCUBone },
-    { "NF2", LLKABones::NF2Bone },
-    { "NP3", LLKABones::NP3Bone },
-    { "NTT", LLKABones::NTTBone },
-    { "OAD", LLKABones::OADBone },
-    { "OKQ", LLKABones::OKQBone },
-    { "ONE", LLKABones::ONEBone },
-    { "P2U", LLKABones::P2UBone },
-    { "P7G", LLKABones::P7GBone },
-    { "PBT", LLKABones::PBTBone },
-    { "PSU", LLKABones::PSUBone },
-    { "PYY", LLKABones::PYYBone },
-    { "QBT", LLKABones::QBTBone },
-    { "QCK", LLKABones::QCKBone },
-    { "RCE", LLKABones::RCEBone },
-    { "RIA", LLKABones::RIABone },
-    { "RTP", LLKABones::RTPBone },
-    { "SAY", LLKABones::SAYBone },
-    { "T0T", LLKABones::T0TBone },
-    { "TDY", LLKABones::TDYBone },
-    { "TFF", LLKABones::TFFBone },
-    { "THP", LLKABones::THPBone },
-    { "TLB", LLKABones::TLBBone },
-    { "TLC", LLKABones::TLCBone },
-    { "TLN", LLKABones::TLNBone },
-    { "TPG", LLKABones::TPGBone },
-    { "U23", LLKABones::U23Bone },
-    { "UBD", LLKABones::UBDBone },
-    { "UDP", LLKABones::UDPBone },
-    { "UF2", LLKABones::UF2Bone },
-    { "UMS", LLKABones::UMSBone },
-    { "UMX", LLKABones::UMXBone },
-    { "UOB", LLKABones::UOBBone },
-    { "UR3", LLKABones::UR3Bone },
-    { "URX", LLKABones::URXBone },
-    { "US4", LLKABones::US4Bone },
-    { "USM", LLKABones::USMBone },
-    { "UVX", LLKABones::UVXBone },
-    { "UY1", LLKABones::UY1Bone },
-    { "WC7", LLKABones::WC7Bone },
-    { "XAE", LLKABones::XAEBone },
-    { "XCS", LLKABones::XCSBone },
-    { "XTY", LLKABones::XTYBone },
-};
+inline constexpr auto KNOWN_NON_STANDARD_RESIDUES = std::to_array<std::pair<LLKABones::ANString, const LLKABones::Bone *>>({
+    { "05A", &LLKABones::_05ABone },
+    { "05H", &LLKABones::_05HBone },
+    { "05K", &LLKABones::_05KBone },
+    { "0AU", &LLKABones::_0AUBone },
+    {  "0U",  &LLKABones::_0UBone },
+    { "0U1", &LLKABones::_0U1Bone },
+    { "128", &LLKABones::_128Bone },
+    { "1RN", &LLKABones::_1RNBone },
+    { "1TL", &LLKABones::_1TLBone },
+    { "1W5", &LLKABones::_1W5Bone },
+    { "2DF", &LLKABones::_2DFBone },
+    { "2LA", &LLKABones::_2LABone },
+    { "2OM", &LLKABones::_2OMBone },
+    { "3MU", &LLKABones::_3MUBone },
+    { "3TD", &LLKABones::_3TDBone },
+    { "4EN", &LLKABones::_4ENBone },
+    { "4MF", &LLKABones::_4MFBone },
+    { "56B", &LLKABones::_56BBone },
+    { "5FA", &LLKABones::_5FABone },
+    { "5NC", &LLKABones::_5NCBone },
+    { "5UA", &LLKABones::_5UABone },
+    { "64P", &LLKABones::_64PBone },
+    { "64T", &LLKABones::_64TBone },
+    { "6FK", &LLKABones::_6FKBone },
+    { "6FM", &LLKABones::_6FMBone },
+    { "6FU", &LLKABones::_6FUBone },
+    { "6HA", &LLKABones::_6HABone },
+    { "6HC", &LLKABones::_6HCBone },
+    { "6HG", &LLKABones::_6HGBone },
+    { "6HT", &LLKABones::_6HTBone },
+    { "6MI", &LLKABones::_6MIBone },
+    { "7AT", &LLKABones::_7ATBone },
+    { "7MG", &LLKABones::_7MGBone },
+    { "7SN", &LLKABones::_7SNBone },
+    { "8AA", &LLKABones::_8AABone },
+    { "8AG", &LLKABones::_8AGBone },
+    { "8AZ", &LLKABones::_8AZBone },
+    { "8MG", &LLKABones::_8MGBone },
+    { "8PY", &LLKABones::_8PYBone },
+    { "8RO", &LLKABones::_8ROBone },
+    { "8YN", &LLKABones::_8YNBone },
+    { "93D", &LLKABones::_93DBone },
+    { "9V9", &LLKABones::_9V9Bone },
+    { "A1P", &LLKABones::A1PBone },
+    { "A3P", &LLKABones::A3PBone },
+    { "A6C", &LLKABones::A6CBone },
+    { "A6U", &LLKABones::A6UBone },
+    { "A7C", &LLKABones::A7CBone },
+    { "A7E", &LLKABones::A7EBone },
+    { "AD2", &LLKABones::AD2Bone },
+    { "ADX", &LLKABones::ADXBone },
+    { "B8H", &LLKABones::B8HBone },
+    { "B8K", &LLKABones::B8KBone },
+    { "B8N", &LLKABones::B8NBone },
+    { "B8Q", &LLKABones::B8QBone },
+    { "B9H", &LLKABones::B9HBone },
+    { "BGH", &LLKABones::BGHBone },
+    { "BGM", &LLKABones::BGMBone },
+    { "BMN", &LLKABones::BMNBone },
+    { "BMQ", &LLKABones::BMQBone },
+    { "C36", &LLKABones::C36Bone },
+    { "C4J", &LLKABones::C4JBone },
+    { "CAR", &LLKABones::CARBone },
+    { "CDW", &LLKABones::CDWBone },
+    { "CGY", &LLKABones::CGYBone },
+    { "CJ1", &LLKABones::CJ1Bone },
+    { "CSF", &LLKABones::CSFBone },
+    { "CSM", &LLKABones::CSMBone },
+    { "CTG", &LLKABones::CTGBone },
+    { "CVC", &LLKABones::CVCBone },
+    {  "D3",  &LLKABones::D3Bone },
+    { "D33", &LLKABones::D33Bone },
+    { "D3N", &LLKABones::D3NBone },
+    { "DFT", &LLKABones::DFTBone },
+    { "DGI", &LLKABones::DGIBone },
+    { "DPY", &LLKABones::DPYBone },
+    { "DRP", &LLKABones::DRPBone },
+    {  "DZ",  &LLKABones::DZBone },
+    { "E3C", &LLKABones::E3CBone },
+    { "E7G", &LLKABones::E7GBone },
+    { "EDC", &LLKABones::EDCBone },
+    { "ENP", &LLKABones::ENPBone },
+    { "EW3", &LLKABones::EW3Bone },
+    { "F2T", &LLKABones::F2TBone },
+    { "F3H", &LLKABones::F3HBone },
+    { "FAG", &LLKABones::FAGBone },
+    { "FFD", &LLKABones::FFDBone },
+    { "FHU", &LLKABones::FHUBone },
+    { "G4P", &LLKABones::G4PBone },
+    { "GMX", &LLKABones::GMXBone },
+    { "GN7", &LLKABones::GN7Bone },
+    { "I2T", &LLKABones::I2TBone },
+    {  "IC",  &LLKABones::ICBone },
+    { "IMC", &LLKABones::IMCBone },
+    { "IOO", &LLKABones::IOOBone },
+    { "IRN", &LLKABones::IRNBone },
+    { "J4T", &LLKABones::J4TBone },
+    { "JLN", &LLKABones::JLNBone },
+    { "JMH", &LLKABones::JMHBone },
+    { "JSP", &LLKABones::JSPBone },
+    { "LCC", &LLKABones::LCCBone },
+    { "LHO", &LLKABones::LHOBone },
+    { "LMS", &LLKABones::LMSBone },
+    { "MBZ", &LLKABones::MBZBone },
+    { "MDJ", &LLKABones::MDJBone },
+    { "MDK", &LLKABones::MDKBone },
+    { "MDQ", &LLKABones::MDQBone },
+    { "MDU", &LLKABones::MDUBone },
+    { "ME6", &LLKABones::ME6Bone },
+    { "MFO", &LLKABones::MFOBone },
+    { "MFT", &LLKABones::MFTBone },
+    { "MGQ", &LLKABones::MGQBone },
+    { "MHG", &LLKABones::MHGBone },
+    { "MM7", &LLKABones::MM7Bone },
+    { "MMT", &LLKABones::MMTBone },
+    { "MTR", &LLKABones::MTRBone },
+    { "MTU", &LLKABones::MTUBone },
+    { "N5I", &LLKABones::N5IBone },
+    { "N6G", &LLKABones::N6GBone },
+    { "NCU", &LLKABones::NCUBone },
+    { "NF2", &LLKABones::NF2Bone },
+    { "NP3", &LLKABones::NP3Bone },
+    { "NTT", &LLKABones::NTTBone },
+    { "OAD", &LLKABones::OADBone },
+    { "OKQ", &LLKABones::OKQBone },
+    { "ONE", &LLKABones::ONEBone },
+    { "P2U", &LLKABones::P2UBone },
+    { "P7G", &LLKABones::P7GBone },
+    { "PBT", &LLKABones::PBTBone },
+    { "PSU", &LLKABones::PSUBone },
+    { "PYY", &LLKABones::PYYBone },
+    { "QBT", &LLKABones::QBTBone },
+    { "QCK", &LLKABones::QCKBone },
+    { "RCE", &LLKABones::RCEBone },
+    { "RIA", &LLKABones::RIABone },
+    { "RTP", &LLKABones::RTPBone },
+    { "SAY", &LLKABones::SAYBone },
+    { "T0T", &LLKABones::T0TBone },
+    { "TDY", &LLKABones::TDYBone },
+    { "TFF", &LLKABones::TFFBone },
+    { "THP", &LLKABones::THPBone },
+    { "TLB", &LLKABones::TLBBone },
+    { "TLC", &LLKABones::TLCBone },
+    { "TLN", &LLKABones::TLNBone },
+    { "TPG", &LLKABones::TPGBone },
+    { "U23", &LLKABones::U23Bone },
+    { "UBD", &LLKABones::UBDBone },
+    { "UDP", &LLKABones::UDPBone },
+    { "UF2", &LLKABones::UF2Bone },
+    { "UMS", &LLKABones::UMSBone },
+    { "UMX", &LLKABones::UMXBone },
+    { "UOB", &LLKABones::UOBBone },
+    { "UR3", &LLKABones::UR3Bone },
+    { "URX", &LLKABones::URXBone },
+    { "US4", &LLKABones::US4Bone },
+    { "USM", &LLKABones::USMBone },
+    { "UVX", &LLKABones::UVXBone },
+    { "UY1", &LLKABones::UY1Bone },
+    { "WC7", &LLKABones::WC7Bone },
+    { "XAE", &LLKABones::XAEBone },
+    { "XCS", &LLKABones::XCSBone },
+    { "XTY", &LLKABones::XTYBone },
+});
 
 } // namespace LLKAInternal
 
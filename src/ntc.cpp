@@ -3,14 +3,18 @@
 #include "ntc.hpp"
 
 #include "ntc_constants.h"
+#include "nucleotide.hpp"
 #include "residues.h"
 #include "structure.hpp"
 #include "util/elementaries.h"
 #include "util/templates.hpp"
 
+#include <compare>
 #include <cstring>
 #include <limits>
 #include <map>
+#include <memory>
+#include <string>
 #include <vector>
 
 namespace LLKAInternal {
@@ -50,6 +54,176 @@ auto hasSingleAltId(const std::vector<const LLKA_Atom *> &atoms)
     return true;
 }
 
+/*
+ * Identifies a nucleotide of a structure. A residue with alternate positions
+ * makes up a distinct nucleotide for each alternate position.
+ */
+class NucleotideKey {
+public:
+    int32_t modelNum;
+    std::string asymId;
+    int32_t seqId;
+    std::string compId;
+    char altId;
+
+    auto operator<=>(const NucleotideKey &) const = default;
+};
+
+/*
+ * Quantities that depend on just one nucleotide. Adjacent steps share a nucleotide
+ * so these are calculated once for each nucleotide and then reused.
+ * This holds only for steps with standard backbones. When either residue of a step has
+ * a non-standard backbone, the delta torsions are measured on atoms picked from the bones
+ * of both residues, see nonStandardBackboneQuads(). Such steps are always measured in full.
+ */
+class NucleotideMetrics {
+public:
+    double delta;
+    double chi;
+    LLKA_RiboseMetrics ribose;
+};
+
+using NucleotideMetricsMap = std::map<NucleotideKey, NucleotideMetrics>;
+
+/*
+ * Identifies both nucleotides of a step made by LLKA_splitStructureToDinucleotideSteps().
+ * The splitter already guarantees that the step consists of two consecutive residues so
+ * the only thing left to check is that each residue comes with a single alternate position.
+ */
+static
+auto stepNucleotideKeys(const LLKA_Structure &step, NucleotideKey &first, NucleotideKey &second) -> LLKA_RetCode
+{
+    if (step.nAtoms == 0)
+        return LLKA_E_MISSING_ATOMS;
+
+    const auto &firstAtom = step.atoms[0];
+    const auto &lastAtom = step.atoms[step.nAtoms - 1];
+    if (firstAtom.label_seq_id >= lastAtom.label_seq_id)
+        return LLKA_E_MISMATCHING_DATA;
+
+    first = { firstAtom.pdbx_PDB_model_num, firstAtom.label_asym_id, firstAtom.label_seq_id, firstAtom.label_comp_id, LLKA_NO_ALTID };
+    second = { firstAtom.pdbx_PDB_model_num, firstAtom.label_asym_id, lastAtom.label_seq_id, lastAtom.label_comp_id, LLKA_NO_ALTID };
+
+    for (size_t idx = 0; idx < step.nAtoms; idx++) {
+        const auto &atom = step.atoms[idx];
+        if (atom.label_alt_id == LLKA_NO_ALTID)
+            continue;
+
+        auto &key = atom.label_seq_id == first.seqId ? first : second;
+        if (key.altId == LLKA_NO_ALTID)
+            key.altId = atom.label_alt_id;
+        else if (key.altId != atom.label_alt_id)
+            return LLKA_E_MULTIPLE_ALT_IDS;
+    }
+
+    return LLKA_OK;
+}
+
+static
+auto calculateSharedStepMetrics(const LLKA_Structure &step, NucleotideMetricsMap &nucleotides, LLKA_AttemptedStepMetrics &result) -> LLKA_RetCode
+{
+    // All dinucleotide torsions, mu and nu angles of both riboses
+    static constexpr size_t MAX_DIHEDRALS = DINU_TORSIONS.size() + 1 + 2 * NU_ANGLES_CLSPTRS.size();
+
+    NucleotideKey keyFirst;
+    NucleotideKey keySecond;
+    auto tRet = stepNucleotideKeys(step, keyFirst, keySecond);
+    if (tRet != LLKA_OK)
+        return tRet;
+
+    LLKA_StepAtomMap map;
+    tRet = resolveStepAtomMap_unchecked(&step, map);
+    if (tRet != LLKA_OK) {
+        // Let the full check tell what exactly is wrong with the step
+        LLKA_StepInfo info;
+        tRet = LLKA_structureIsStep(&step, &info);
+        return tRet == LLKA_OK ? LLKA_E_INVALID_ARGUMENT : tRet;
+    }
+
+    const bool shared = findBone(keyFirst.compId).hasStandardBackbone && findBone(keySecond.compId).hasStandardBackbone;
+    const auto knownFirst = shared ? nucleotides.find(keyFirst) : nucleotides.end();
+    const auto knownSecond = shared ? nucleotides.find(keySecond) : nucleotides.end();
+    const bool reuseFirst = knownFirst != nucleotides.end();
+    const bool reuseSecond = knownSecond != nucleotides.end();
+
+    std::array<LLKA_Point, 5> riboseFirst;
+    std::array<LLKA_Point, 5> riboseSecond;
+    if (!reuseFirst || !reuseSecond) {
+        tRet = stepRiboseCorePoints_unchecked(step, riboseFirst, riboseSecond);
+        if (tRet != LLKA_OK)
+            return tRet;
+    }
+
+    auto &metrics = result.metrics;
+
+    // Gather all dihedrals we need to calculate and measure them in one go
+    std::array<LLKA_Point, 4 * MAX_DIHEDRALS> quads;
+    std::array<double *, MAX_DIHEDRALS> dests;
+    std::array<double, MAX_DIHEDRALS> values;
+    size_t nQuads = 0;
+
+    auto addQuad = [&](const LLKA_Point &a, const LLKA_Point &b, const LLKA_Point &c, const LLKA_Point &d, double *dest) {
+        auto quad = &quads[4 * nQuads];
+        quad[0] = a; quad[1] = b; quad[2] = c; quad[3] = d;
+        dests[nQuads++] = dest;
+    };
+    auto addNuAngles = [&](const std::array<LLKA_Point, 5> &ribose, LLKA_NuAngles &nus) {
+        nuAnglesQuads(ribose, &quads[4 * nQuads]);
+        for (size_t idx = 0; idx < NU_ANGLES_CLSPTRS.size(); idx++)
+            dests[nQuads++] = &(nus.*NU_ANGLES_CLSPTRS[idx]);
+    };
+
+    for (const auto &[tor, clsPtr] : DINU_TORSIONS) {
+        if (reuseFirst && (tor == LLKA_TOR_DELTA_1 || tor == LLKA_TOR_CHI_1))
+            continue;
+        if (reuseSecond && (tor == LLKA_TOR_DELTA_2 || tor == LLKA_TOR_CHI_2))
+            continue;
+
+        const auto &quad = map.torsions[tor];
+        addQuad(quad[0]->coords, quad[1]->coords, quad[2]->coords, quad[3]->coords, &(metrics.*clsPtr));
+    }
+    addQuad(map.mu[0]->coords, map.mu[1]->coords, map.mu[2]->coords, map.mu[3]->coords, &metrics.mu);
+    if (!reuseFirst)
+        addNuAngles(riboseFirst, result.ribose_1.nus);
+    if (!reuseSecond)
+        addNuAngles(riboseSecond, result.ribose_2.nus);
+
+    dihedralAnglesBatch(quads.data(), nQuads, values.data());
+    for (size_t idx = 0; idx < nQuads; idx++)
+        *dests[idx] = values[idx];
+
+    if (reuseFirst) {
+        metrics.delta_1 = knownFirst->second.delta;
+        metrics.chi_1 = knownFirst->second.chi;
+        result.ribose_1 = knownFirst->second.ribose;
+    } else {
+        completeRiboseMetrics(result.ribose_1);
+        if (shared)
+            nucleotides.emplace(std::move(keyFirst), NucleotideMetrics{ metrics.delta_1, metrics.chi_1, result.ribose_1 });
+    }
+    if (reuseSecond) {
+        metrics.delta_2 = knownSecond->second.delta;
+        metrics.chi_2 = knownSecond->second.chi;
+        result.ribose_2 = knownSecond->second.ribose;
+    } else {
+        completeRiboseMetrics(result.ribose_2);
+        if (shared)
+            nucleotides.emplace(std::move(keySecond), NucleotideMetrics{ metrics.delta_2, metrics.chi_2, result.ribose_2 });
+    }
+
+    metrics.CC = spatialDistance<double>(*map.CC[0], *map.CC[1]);
+    metrics.NN = spatialDistance<double>(*map.NN[0], *map.NN[1]);
+
+    for (const auto &[tor, clsPtr] : DINU_TORSIONS) {
+        if (std::isnan(metrics.*clsPtr))
+            return LLKA_E_BAD_DATA;
+    }
+    if (std::isnan(metrics.CC) || std::isnan(metrics.NN) || std::isnan(metrics.mu))
+        return LLKA_E_BAD_DATA;
+
+    return LLKA_OK;
+}
+
 static
 auto crossResidueMetricAtoms(const char *firstBase, const char *secondBase, LLKA_CrossResidueMetric metric, LLKA_AtomNameQuad &quad)
 {
@@ -267,6 +441,11 @@ LLKA_RetCode LLKA_CC LLKA_calculateStepMetrics(const LLKA_Structure *stru, LLKA_
     return LLKAInternal::calculateStepMetrics_unchecked(stru, metrics);
 }
 
+LLKA_RetCode LLKA_CC LLKA_calculateStepMetricsFromAtomMap(const LLKA_StepAtomMap *map, LLKA_StepMetrics *metrics)
+{
+    return LLKAInternal::calculateStepMetrics(*map, metrics);
+}
+
 LLKA_RetCode LLKA_CC LLKA_calculateStepMetricsDifferenceAgainstReference(const LLKA_Structure *stru, LLKA_NtC ntc, LLKA_StepMetrics *metrics)
 {
     if (ntc == LLKA_INVALID_NTC)
@@ -301,6 +480,27 @@ const char * LLKA_CC LLKA_CANAToName(LLKA_CANA cana)
     return LLKAInternal::CANA_NAMES[idx];
 }
 
+LLKA_RetCode LLKA_CC LLKA_calculateStructureStepMetrics(const LLKA_Structure *stru, LLKA_StructureStepMetrics *metrics)
+{
+    LLKA_Structures steps;
+
+    auto tRet = LLKA_splitStructureToDinucleotideSteps(stru, &steps);
+    if (tRet != LLKA_OK)
+        return tRet;
+
+    metrics->steps = steps;
+    metrics->attemptedMetrics = new LLKA_AttemptedStepMetrics[steps.nStrus];
+    metrics->nAttemptedMetrics = steps.nStrus;
+
+    LLKAInternal::NucleotideMetricsMap nucleotides{};
+    for (size_t idx = 0; idx < steps.nStrus; idx++) {
+        auto &attempted = metrics->attemptedMetrics[idx];
+        attempted.status = LLKAInternal::calculateSharedStepMetrics(steps.strus[idx], nucleotides, attempted);
+    }
+
+    return LLKA_OK;
+}
+
 LLKA_RetCode LLKA_CC LLKA_crossResidueMetric(LLKA_CrossResidueMetric metric, const LLKA_Structure *stru, LLKA_Structure *metricStru)
 {
     assert(metric <= LLKA_XR_TOR_MU);
@@ -495,6 +695,12 @@ const char * LLKA_CC LLKA_dinucleotideTorsionName(LLKA_DinucleotideTorsion torsi
     }
 }
 
+void LLKA_CC LLKA_destroyStructureStepMetrics(LLKA_StructureStepMetrics *metrics)
+{
+    LLKA_destroyStructures(&metrics->steps);
+    delete [] metrics->attemptedMetrics;
+}
+
 LLKA_RetCode LLKA_CC LLKA_extractBackbone(const LLKA_Structure *stru, LLKA_Structure *backbone)
 {
     return LLKAInternal::extractBackbone(stru, backbone);
@@ -615,10 +821,21 @@ LLKA_Structure LLKA_CC LLKA_NtCStructure(LLKA_NtC ntc)
     return stru;
 }
 
+LLKA_RetCode LLKA_CC LLKA_stepAtomMap(const LLKA_Structure *stru, LLKA_StepAtomMap *map)
+{
+    LLKA_StepInfo info;
+
+    auto tRet = LLKA_structureIsStep(stru, &info);
+    if (tRet != LLKA_OK)
+        return tRet;
+
+    return LLKAInternal::resolveStepAtomMap_unchecked(stru, *map);
+}
+
 LLKA_RetCode LLKA_CC LLKA_structureIsStep(const LLKA_Structure *stru, LLKA_StepInfo *info)
 {
-    static const auto atomComparator = [](const std::string &label_atom_id, const LLKA_Atom *const &atom) -> bool {
-        return std::strcmp(atom->label_atom_id, label_atom_id.c_str()) == 0;
+    static const auto atomComparator = [](const LLKABones::ANString &label_atom_id, const LLKA_Atom *const &atom) -> bool {
+        return label_atom_id.matches(atom->label_atom_id);
     };
 
     if (stru->nAtoms == 0)
@@ -633,16 +850,17 @@ LLKA_RetCode LLKA_CC LLKA_structureIsStep(const LLKA_Structure *stru, LLKA_StepI
     // Gather all atoms of interest
     for (size_t idx = 0; idx < stru->nAtoms; idx++) {
         const auto atom = &stru->atoms[idx];
+        const LLKABones::ANString name{atom->label_atom_id};
 
         for (const auto &atomName : LLKABones::EXTENDED_BACKBONE(boneFirst.firstResidue)) {
-            if (!std::strcmp(atomName.c_str(), atom->label_atom_id)) {
+            if (atomName == name) {
                 atomsFirstResidue.push_back(atom);
                 break;
             }
         }
 
         for (const auto &atomName : LLKABones::EXTENDED_BACKBONE(boneSecond.secondResidue)) {
-            if (!std::strcmp(atomName.c_str(), atom->label_atom_id)) {
+            if (atomName == name) {
                 atomsSecondResidue.push_back(atom);
                 break;
             }
@@ -12,7 +12,7 @@
 
 #include <array>
 #include <cassert>
-#include <memory>
+#include <cstring>
 #include <string>
 #include <tuple>
 
@@ -102,149 +102,136 @@ auto dinucleotideTorsion_unchecked(LLKA_DinucleotideTorsion torsion, const LLKA_
 }
 
 inline
-auto crossResidueMetric(LLKA_CrossResidueMetric metric, const LLKA_Structure *stru, LLKA_StructureView &view)
+auto resolveStepAtomMap_unchecked(const LLKA_Structure *stru, LLKA_StepAtomMap &map) -> LLKA_RetCode
 {
-    assert(metric <= LLKA_XR_TOR_MU);
-    assert(view.capacity >= 4);
+    class WantedAtom {
+    public:
+        LLKABones::ANString name;
+        int resNo;
+        const LLKA_Atom **slot;
+    };
 
     // We must have the full "metrics substructure" including the four base-dependent atoms
     if (stru->nAtoms < LLKABones::NUM_TORSIONS_ATOMS)
         return LLKA_E_INVALID_ARGUMENT;
 
-    const auto modelNum = stru->atoms[0].pdbx_PDB_model_num;
-    std::string asymId = stru->atoms[0].label_asym_id;
-    const auto seqIdFirst = stru->atoms[0].label_seq_id;
-    const std::string compIdFirst = stru->atoms[0].label_comp_id;
-    const auto seqIdSecond = stru->atoms[stru->nAtoms - 1].label_seq_id;
-    const std::string compIdSecond = stru->atoms[stru->nAtoms - 1].label_comp_id;
+    const auto &firstAtom = stru->atoms[0];
+    const auto &lastAtom = stru->atoms[stru->nAtoms - 1];
+    // See the note about sequence ids in dinucleotideTorsion_unchecked()
+    assert(firstAtom.label_seq_id < lastAtom.label_seq_id);
 
-    const auto &boneFirst = LLKAInternal::findBone(stru->atoms[0].label_comp_id);
-    const auto &boneSecond = LLKAInternal::findBone(stru->atoms[stru->nAtoms - 1].label_comp_id);
+    LLKA_BaseKind baseKind;
+    if (!LLKAInternal::findBaseKind(firstAtom.label_comp_id, baseKind) || !LLKAInternal::findBaseKind(lastAtom.label_comp_id, baseKind))
+        return LLKA_E_INVALID_ARGUMENT;
 
-    LLKAInternal::AtomToExtract ateFirst{modelNum, asymId, seqIdFirst, ""};
-    LLKAInternal::AtomToExtract ateSecond{modelNum, asymId, seqIdSecond, ""};
+    const auto &boneFirst = LLKAInternal::findBone(firstAtom.label_comp_id);
+    const auto &boneSecond = LLKAInternal::findBone(lastAtom.label_comp_id);
+
+    // Collect names of all atoms we need along with the slots in the map where they belong
+    std::array<WantedAtom, sizeof(LLKA_StepAtomMap) / sizeof(const LLKA_Atom *)> wanted;
+    size_t nWanted = 0;
+    auto want = [&wanted, &nWanted](const LLKABones::ANString &name, int resNo, const LLKA_Atom *&slot) {
+        slot = nullptr;
+        wanted[nWanted++] = { name, resNo, &slot };
+    };
+
+    const auto &quads = LLKABones::BACKBONE_QUADS(boneFirst, boneSecond);
+    for (size_t tor = 0; tor < quads.size(); tor++) {
+        for (size_t idx = 0; idx < 4; idx++) {
+            const auto &[name, resNo] = quads[tor][idx];
+            want(name, resNo, map.torsions[tor][idx]);
+        }
+    }
+    for (size_t idx = 0; idx < 4; idx++) {
+        want(boneFirst.baseQuad[idx], 1, map.torsions[LLKA_TOR_CHI_1][idx]);
+        want(boneSecond.baseQuad[idx], 2, map.torsions[LLKA_TOR_CHI_2][idx]);
+    }
 
-    if (metric == LLKA_XR_DIST_CC) {
-        std::unique_ptr<LLKA_Atom[]> atoms{new LLKA_Atom[2]};
-        ateFirst.compId = compIdFirst;
-        ateFirst.name = "C1'";
-        auto atom = getMatchingAtom(stru, ateFirst);
-        if (!atom)
-            return LLKA_E_INVALID_ARGUMENT;
+    want("C1'", 1, map.CC[0]);
+    want("C1'", 2, map.CC[1]);
 
-        view.atoms[0] = atom;
+    want(boneFirst.base[0], 1, map.NN[0]);
+    want(boneSecond.base[0], 2, map.NN[1]);
 
-        ateSecond.compId = compIdSecond;
-        ateSecond.name = "C1'";
-        atom = LLKAInternal::getMatchingAtom(stru, ateSecond);
-        if (!atom)
-            return LLKA_E_INVALID_ARGUMENT;
+    want(boneFirst.base[0], 1, map.mu[0]);
+    want("C1'", 1, map.mu[1]);
+    want("C1'", 2, map.mu[2]);
+    want(boneSecond.base[0], 2, map.mu[3]);
 
-        view.atoms[1] = atom;
+    assert(nWanted == wanted.size());
 
-        view.nAtoms = 2;
+    const LLKABones::ANString compIdFirst{firstAtom.label_comp_id};
+    const LLKABones::ANString compIdSecond{lastAtom.label_comp_id};
 
-        return LLKA_OK;
-    } else if (metric == LLKA_XR_DIST_NN) {
-        const auto &firstResidueBaseDepAtoms = boneFirst.base;
-        const auto &secondResidueBaseDepAtoms = boneSecond.base;
+    // Walk the structure just once. The first matching atom wins, just like it does in getMatchingAtom()
+    for (size_t atomIdx = 0; atomIdx < stru->nAtoms; atomIdx++) {
+        const auto &atom = stru->atoms[atomIdx];
 
-        std::unique_ptr<LLKA_Atom[]> atoms{new LLKA_Atom[2]};
-        ateFirst.compId = compIdFirst;
-        ateFirst.name = firstResidueBaseDepAtoms[0];
-        auto atom = LLKAInternal::getMatchingAtom(stru, ateFirst);
-        if (!atom)
-            return LLKA_E_INVALID_ARGUMENT;
+        int resNo;
+        if (atom.label_seq_id == firstAtom.label_seq_id && compIdFirst.matches(atom.label_comp_id))
+            resNo = 1;
+        else if (atom.label_seq_id == lastAtom.label_seq_id && compIdSecond.matches(atom.label_comp_id))
+            resNo = 2;
+        else
+            continue;
 
-        view.atoms[0] = atom;
+        if (atom.pdbx_PDB_model_num != firstAtom.pdbx_PDB_model_num || std::strcmp(atom.label_asym_id, firstAtom.label_asym_id) != 0)
+            continue;
 
-        ateSecond.compId = compIdSecond;
-        ateSecond.name = secondResidueBaseDepAtoms[0];
-        atom = getMatchingAtom(stru, ateSecond);
-        if (!atom)
-            return LLKA_E_INVALID_ARGUMENT;
-
-        view.atoms[1] = atom;
-
-        view.nAtoms = 2;
+        const LLKABones::ANString name{atom.label_atom_id};
+        for (const auto &w : wanted) {
+            if (w.resNo == resNo && *w.slot == nullptr && w.name == name)
+                *w.slot = &atom;
+        }
+    }
 
-        return LLKA_OK;
-    } else {
-        const auto &firstResidueBaseDepAtoms = boneFirst.base;
-        const auto &secondResidueBaseDepAtoms = boneSecond.base;
-
-        // PERF: Look into having a static array
-        std::vector<AtomToExtract> toExtract{
-            { modelNum, asymId, seqIdFirst, compIdFirst, firstResidueBaseDepAtoms[0] },
-            { modelNum, asymId, seqIdFirst, compIdFirst, "C1'" },
-            { modelNum, asymId, seqIdSecond, compIdSecond, "C1'" },
-            { modelNum, asymId, seqIdSecond, compIdSecond, secondResidueBaseDepAtoms[0] },
-        };
-
-        return extractAtoms(stru, toExtract, &view);
+    for (const auto &w : wanted) {
+        if (*w.slot == nullptr)
+            return LLKA_E_INVALID_ARGUMENT;
     }
+
+    return LLKA_OK;
 }
 
 inline
-auto calculateStepMetrics_unchecked(const LLKA_Structure *stru, LLKA_StepMetrics *metrics) -> LLKA_RetCode
+auto calculateStepMetrics(const LLKA_StepAtomMap &map, LLKA_StepMetrics *metrics) -> LLKA_RetCode
 {
-    LLKA_RetCode tRet;
-    LLKA_StructureView view = makeStructureView(4);
-
     for (const auto &[tor, clsPtr] : DINU_TORSIONS) {
-        tRet = dinucleotideTorsion_unchecked(tor, stru, view);
-        if (tRet != LLKA_OK) {
-            LLKA_destroyStructureView(&view);
-            return tRet;
-        }
-
-        auto v = dihedralAngle<double>(view);
-
-        if (std::isnan(v)) {
-            LLKA_destroyStructureView(&view);
+        const auto &quad = map.torsions[tor];
+        auto v = dihedralAngle<double>(quad[0]->coords, quad[1]->coords, quad[2]->coords, quad[3]->coords);
+        if (std::isnan(v))
             return LLKA_E_BAD_DATA;
-        }
 
         metrics->*clsPtr = v;
     }
 
-    tRet = crossResidueMetric(LLKA_XR_DIST_CC, stru, view);
-    if (tRet != LLKA_OK) {
-        LLKA_destroyStructureView(&view);
-        return tRet;
-    }
-    metrics->CC = spatialDistance<double>(*view.atoms[0], *view.atoms[1]);
-    if (std::isnan(metrics->CC)) {
-        LLKA_destroyStructureView(&view);
+    metrics->CC = spatialDistance<double>(*map.CC[0], *map.CC[1]);
+    if (std::isnan(metrics->CC))
         return LLKA_E_BAD_DATA;
-    }
 
-    tRet = crossResidueMetric(LLKA_XR_DIST_NN, stru, view);
-    if (tRet != LLKA_OK) {
-        LLKA_destroyStructureView(&view);
-        return tRet;
-    }
-    metrics->NN = spatialDistance<double>(*view.atoms[0], *view.atoms[1]);
-    if (std::isnan(metrics->NN)) {
-        LLKA_destroyStructureView(&view);
+    metrics->NN = spatialDistance<double>(*map.NN[0], *map.NN[1]);
+    if (std::isnan(metrics->NN))
         return LLKA_E_BAD_DATA;
-    }
 
-    tRet = crossResidueMetric(LLKA_XR_TOR_MU, stru, view);
-    if (tRet != LLKA_OK) {
-        LLKA_destroyStructureView(&view);
-        return tRet;
-    }
-    metrics->mu = dihedralAngle<double>(view);
-    if (std::isnan(metrics->mu)) {
-        LLKA_destroyStructureView(&view);
+    metrics->mu = dihedralAngle<double>(map.mu[0]->coords, map.mu[1]->coords, map.mu[2]->coords, map.mu[3]->coords);
+    if (std::isnan(metrics->mu))
         return LLKA_E_BAD_DATA;
-    }
 
-    LLKA_destroyStructureView(&view);
     return LLKA_OK;
 }
 
+inline
+auto calculateStepMetrics_unchecked(const LLKA_Structure *stru, LLKA_StepMetrics *metrics) -> LLKA_RetCode
+{
+    LLKA_StepAtomMap map;
+
+    auto tRet = resolveStepAtomMap_unchecked(stru, map);
+    if (tRet != LLKA_OK)
+        return tRet;
+
+    return calculateStepMetrics(map, metrics);
+}
+
 } // namespace LLKA
 
 #endif // _NTC_HPP
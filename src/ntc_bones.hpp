@@ -4,15 +4,127 @@
 #define _NTC_BONES_HPP
 
 #include <array>
+#include <bit>
+#include <compare>
+#include <cstdint>
 #include <string>
 #include <span>
 #include <tuple>
+#include <type_traits>
 
 namespace LLKABones {
 
-// TODO: std::string wastes a lot of memory when we use it just for atom names.
-// Use some more memory-efficient custom structure
-using ANString = std::string;
+/*
+ * Called when a name literal that is too long is used in a constant expression.
+ * The function is not constexpr so such a literal fails the compilation.
+ */
+inline
+auto nameLiteralTooLong() noexcept -> void
+{
+}
+
+/*
+ * Compact, fixed-size string used for atom and residue names.
+ * Names are stored inline and zero-padded to eight bytes so that the type is a literal type
+ * and two names can be compared with a single 64-bit comparison.
+ *
+ * Names longer than MAX_LENGTH characters are rejected. Literals that are too long fail
+ * the compilation. Runtime names that are too long are all stored as the same invalid name
+ * whose c_str() is empty. The invalid name equals only itself, so names form a total order.
+ * It does not match() any name because its characters are not known.
+ */
+class ANString {
+public:
+    static constexpr size_t MAX_LENGTH = 7;
+
+    constexpr ANString() noexcept :
+        m_chars{}
+    {}
+
+    constexpr ANString(const char *str) noexcept :
+        m_chars{}
+    {
+        for (size_t idx = 0; str[idx] != '\0'; idx++) {
+            if (idx == MAX_LENGTH) {
+                if (std::is_constant_evaluated())
+                    nameLiteralTooLong();
+
+                m_chars = {};
+                m_chars[MAX_LENGTH] = OVERLONG_MARK;
+                return;
+            }
+            m_chars[idx] = str[idx];
+        }
+    }
+
+    ANString(const std::string &str) noexcept :
+        ANString{str.c_str()}
+    {}
+
+    constexpr auto c_str() const noexcept -> const char *
+    {
+        return m_chars.data();
+    }
+
+    constexpr auto empty() const noexcept -> bool
+    {
+        return packed() == 0;
+    }
+
+    constexpr auto length() const noexcept -> size_t
+    {
+        size_t len = 0;
+        while (len < MAX_LENGTH && m_chars[len] != '\0')
+            len++;
+        return len;
+    }
+
+    constexpr auto size() const noexcept -> size_t
+    {
+        return length();
+    }
+
+    constexpr auto matches(const char *str) const noexcept -> bool
+    {
+        return !overlong() && *this == ANString{str};
+    }
+
+    constexpr auto overlong() const noexcept -> bool
+    {
+        return m_chars[MAX_LENGTH] == OVERLONG_MARK;
+    }
+
+    friend constexpr auto operator==(const ANString &lhs, const ANString &rhs) noexcept -> bool
+    {
+        return lhs.packed() == rhs.packed();
+    }
+
+    friend constexpr auto operator<=>(const ANString &lhs, const ANString &rhs) noexcept -> std::strong_ordering
+    {
+        return lhs.ordinal() <=> rhs.ordinal();
+    }
+
+    // Name as a single 64-bit integer, suitable for hashing
+    constexpr auto packed() const noexcept -> uint64_t
+    {
+        return std::bit_cast<uint64_t>(m_chars);
+    }
+
+private:
+    static constexpr char OVERLONG_MARK = '\x01';
+
+    // Big-endian packing so that names order lexicographically
+    constexpr auto ordinal() const noexcept -> uint64_t
+    {
+        uint64_t v = 0;
+        for (const char ch : m_chars)
+            v = (v << 8) | uint8_t(ch);
+        return v;
+    }
+
+    alignas(uint64_t) std::array<char, MAX_LENGTH + 1> m_chars;
+};
+static_assert(sizeof(ANString) == sizeof(uint64_t));
 
 using Quad = std::array<ANString, 4>;
 using TaggedQuad = std::array<std::tuple<ANString, int>, 4>;
@@ -45,11 +157,11 @@ public:
     const char name[4]; // Used only for non-standard bones
 };
 
-inline const BoneFirstResidue STANDARD_FIRST_RESIDUE = { "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
-inline const BoneSecondResidue STANDARD_SECOND_RESIDUE = { "P", "O5'", "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
-inline const BoneBase STANDARD_PURINE = { "N9", "C4" };
-inline const BoneBase STANDARD_PYRIMIDINE = { "N1", "C2" };
-inline const BoneBackboneQuads STANDARD_BACKBONE_QUADS = {{
+inline constexpr BoneFirstResidue STANDARD_FIRST_RESIDUE = { "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
+inline constexpr BoneSecondResidue STANDARD_SECOND_RESIDUE = { "P", "O5'", "C5'", "C4'", "O4'", "C3'", "O3'", "C1'", "O4'" };
+inline constexpr BoneBase STANDARD_PURINE = { "N9", "C4" };
+inline constexpr BoneBase STANDARD_PYRIMIDINE = { "N1", "C2" };
+inline constexpr BoneBackboneQuads STANDARD_BACKBONE_QUADS = {{
     {{  // Delta 1
         { "C5'", 1 },
         { "C4'", 1 },
@@ -93,8 +205,8 @@ inline const BoneBackboneQuads STANDARD_BACKBONE_QUADS = {{
         { "O3'", 2 }
     }}
 }};
-inline const Quad STANDARD_PURINE_QUAD = { "O4'", "C1'", "N9", "C4" };
-inline const Quad STANDARD_PYRIMIDINE_QUAD = { "O4'", "C1'", "N1", "C2" };
+inline constexpr Quad STANDARD_PURINE_QUAD = { "O4'", "C1'", "N9", "C4" };
+inline constexpr Quad STANDARD_PYRIMIDINE_QUAD = { "O4'", "C1'", "N1", "C2" };
 
 inline constexpr Bone StandardPurineBone = {
     .firstResidue = STANDARD_FIRST_RESIDUE,
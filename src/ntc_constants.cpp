@@ -3,8 +3,11 @@
 #include "ntc_constants.h"
 
 #include "ntc_references.h"
+#include "residues.h"
 #include <util/elementaries.h>
 
+#include <utility>
+
 #define _A(x) LLKAInternal::D2R(x)
 
 /*
@@ -816,19 +819,87 @@ const std::array<NtCAverages, 96> NTC_AVERAGES{{
 	}
 }};
 
-static
+static constexpr
 auto _mk_ntc_references()
 {
     std::array<LLKA_Structure, 96> refs{};
 
+    // Reference structures are never modified so they may point directly to the constant data
     for (size_t idx = LLKA_AA00; idx <= LLKA_ZZS2; idx++) {
         const auto &rawRef = NTC_RAW_REFS[idx];
-        refs[idx] = LLKA_makeStructure(rawRef.atoms, rawRef.nAtoms);
+        refs[idx] = { const_cast<LLKA_Atom *>(rawRef.atoms), rawRef.nAtoms };
     }
 
     return refs;
 }
 
-const std::array<LLKA_Structure, 96> NTC_REFERENCES = _mk_ntc_references();
+static constexpr
+auto _mk_ntc_reference_backbone(const RawRef &rawRef)
+{
+    const auto &firstAtom = rawRef.atoms[0];
+    const auto &lastAtom = rawRef.atoms[rawRef.nAtoms - 1];
+    const auto &boneFirst = *KNOWN_RESIDUES.find(firstAtom.label_comp_id)->bone;
+    const auto &boneSecond = *KNOWN_RESIDUES.find(lastAtom.label_comp_id)->bone;
+
+    std::array<LLKABones::ANString, 64> names{};
+    if (rawRef.nAtoms > names.size())
+        throw "Reference NtC structure is too large";
+    for (size_t idx = 0; idx < rawRef.nAtoms; idx++)
+        names[idx] = rawRef.atoms[idx].label_atom_id;
+
+    NtCReferenceBackbone bkbn{};
+    size_t nPoints = 0;
+    auto pick = [&](int32_t seqId, const LLKABones::ANString &name) {
+        for (size_t idx = 0; idx < rawRef.nAtoms; idx++) {
+            if (rawRef.atoms[idx].label_seq_id == seqId && names[idx] == name) {
+                bkbn.points[nPoints++] = rawRef.atoms[idx].coords;
+                return;
+            }
+        }
+        throw "Reference NtC structure does not contain all extended backbone atoms";
+    };
+
+    // Atoms must go in the same order as they do in LLKA_extractExtendedBackbone()
+    for (const auto &name : LLKABones::EXTENDED_BACKBONE(boneFirst.firstResidue))
+        pick(firstAtom.label_seq_id, name);
+    for (const auto &name : boneFirst.base)
+        pick(firstAtom.label_seq_id, name);
+    for (const auto &name : LLKABones::EXTENDED_BACKBONE(boneSecond.secondResidue))
+        pick(lastAtom.label_seq_id, name);
+    for (const auto &name : boneSecond.base)
+        pick(lastAtom.label_seq_id, name);
+
+    LLKA_Point centroid{ 0, 0, 0 };
+    for (const auto &pt : bkbn.points) {
+        centroid.x += pt.x;
+        centroid.y += pt.y;
+        centroid.z += pt.z;
+    }
+    centroid.x /= bkbn.points.size();
+    centroid.y /= bkbn.points.size();
+    centroid.z /= bkbn.points.size();
+
+    for (auto &pt : bkbn.points) {
+        pt.x -= centroid.x;
+        pt.y -= centroid.y;
+        pt.z -= centroid.z;
+    }
+
+    return bkbn;
+}
+
+// Each backbone is evaluated separately to stay well within the limits compilers impose on constant evaluation
+template <size_t Idx>
+inline constexpr NtCReferenceBackbone _NTC_REFERENCE_BACKBONE = _mk_ntc_reference_backbone(NTC_RAW_REFS[Idx]);
+
+template <size_t... Idxs>
+static constexpr
+auto _mk_ntc_reference_backbones(std::index_sequence<Idxs...>)
+{
+    return std::array<NtCReferenceBackbone, sizeof...(Idxs)>{ _NTC_REFERENCE_BACKBONE<Idxs>... };
+}
+
+constinit const std::array<LLKA_Structure, 96> NTC_REFERENCES = _mk_ntc_references();
+constinit const std::array<NtCReferenceBackbone, 96> NTC_REFERENCE_BACKBONES = _mk_ntc_reference_backbones(std::make_index_sequence<96>{});
 
 } // namespace LLKAInternal
@@ -5,6 +5,8 @@
 
 #include <llka_ntc.h>
 
+#include "ntc_bones.hpp"
+
 #include <array>
 #include <map>
 #include <string>
@@ -41,6 +43,14 @@ public:
     double nu4second;
 };
 
+/*!
+ * Extended backbone of a reference NtC structure.
+ * Coordinates are translated so that their centroid lies at the origin.
+ */
+class NtCReferenceBackbone {
+public:
+    std::array<LLKA_Point, LLKABones::NUM_EXTENDED_ATOMS> points;   /*! < Centered coordinates in the order given by <tt>LLKA_extractExtendedBackbone()</tt> */
+};
 
 // This array must follow the order of the items in the LLKA_CANA enum!
 inline constexpr std::array<char[4], 14> CANA_NAMES {
@@ -63,6 +73,7 @@ inline constexpr std::array<char[4], 14> CANA_NAMES {
 extern const std::map<std::string, size_t> NAME_TO_NTC_INDEX_MAPPING;     /*! < Mapping of NtC names to indices into <tt>NTC_AVERAGES</tt> and <tt>NTC_REFERENCES</tt> */
 extern const std::array<NtCAverages, 96> NTC_AVERAGES;                    /*! < Array of averaged torsion angles, cross-residue torsions and distances and nu angles of all NtCs */
 extern const std::array<LLKA_Structure, 96> NTC_REFERENCES;               /*! < Array of structures used as reference NtC structures */
+extern const std::array<NtCReferenceBackbone, 96> NTC_REFERENCE_BACKBONES; /*! < Array of extended backbones of the reference NtC structures */
 
 } // namespace LLKAInternal
 
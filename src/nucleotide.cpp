@@ -2,6 +2,17 @@
 
 #include <llka_nucleotide.h>
 #include "nucleotide.hpp"
+#include "structure_util.hpp"
+
+#include <vector>
+
+void LLKA_CC LLKA_destroyRiboseMetricsMultiple(LLKA_RiboseMetricsMultiple *metrics)
+{
+    delete [] metrics->attemptedMetrics;
+
+    metrics->attemptedMetrics = nullptr;
+    metrics->nAttemptedMetrics = 0;
+}
 
 LLKA_Structure LLKA_CC LLKA_extractNucleotide(const LLKA_Structure *stru, int32_t pdbx_PDB_model_num, const char *label_asym_id, int32_t label_seq_id)
 {
@@ -55,6 +66,60 @@ LLKA_RetCode LLKA_CC LLKA_riboseMetrics(const LLKA_Structure *stru, LLKA_RiboseM
     return LLKA_OK;
 }
 
+LLKA_RetCode LLKA_CC LLKA_riboseMetricsMultiple(const LLKA_Structure *stru, LLKA_RiboseMetricsMultiple *metrics)
+{
+    std::vector<LLKA_AttemptedRiboseMetrics> attempted{};
+    std::vector<std::array<LLKA_Point, 5>> riboses{};
+    std::vector<size_t> riboseIdxs{};
+
+    // Walk through the structure residue by residue and pick the ribose cores
+    size_t firstAtomIdx = 0;
+    while (firstAtomIdx < stru->nAtoms) {
+        const auto &first = stru->atoms[firstAtomIdx];
+
+        size_t lastAtomIdx = firstAtomIdx + 1;
+        while (lastAtomIdx < stru->nAtoms) {
+            const auto &atom = stru->atoms[lastAtomIdx];
+            if (atom.label_seq_id != first.label_seq_id || std::strcmp(atom.label_comp_id, first.label_comp_id) != 0 || !LLKAInternal::isSameChain(atom, first))
+                break;
+            lastAtomIdx++;
+        }
+
+        if (LLKAInternal::isNucleotideCompound(first.label_comp_id)) {
+            LLKA_AttemptedRiboseMetrics item{};
+            item.firstAtomIdx = firstAtomIdx;
+            item.nAtoms = lastAtomIdx - firstAtomIdx;
+
+            std::array<LLKA_Point, 5> ribose;
+            if (LLKAInternal::riboseCorePoints(&first, item.nAtoms, ribose)) {
+                item.status = LLKA_OK;
+                riboses.push_back(ribose);
+                riboseIdxs.push_back(attempted.size());
+            } else
+                item.status = LLKA_E_MISSING_ATOMS;
+
+            attempted.push_back(item);
+        }
+
+        firstAtomIdx = lastAtomIdx;
+    }
+
+    std::vector<LLKA_RiboseMetrics> calculated(riboses.size());
+    LLKAInternal::riboseMetricsBatch(riboses.data(), riboses.size(), calculated.data());
+    for (size_t idx = 0; idx < riboseIdxs.size(); idx++)
+        attempted[riboseIdxs[idx]].metrics = calculated[idx];
+
+    metrics->nAttemptedMetrics = attempted.size();
+    if (attempted.empty())
+        metrics->attemptedMetrics = nullptr;
+    else {
+        metrics->attemptedMetrics = new LLKA_AttemptedRiboseMetrics[attempted.size()];
+        std::copy(attempted.cbegin(), attempted.cend(), metrics->attemptedMetrics);
+    }
+
+    return LLKA_OK;
+}
+
 LLKA_RetCode LLKA_CC LLKA_riboseMetricsView(const LLKA_StructureView *view, LLKA_RiboseMetrics *metrics)
 {
     LLKA_StructureView riboseView;
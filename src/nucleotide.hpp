@@ -12,8 +12,10 @@
 #include <util/geometry.h>
 #include <util/templates.hpp>
 
+#include <algorithm>
 #include <array>
 #include <cstring>
+#include <map>
 #include <string>
 
 template <typename StructureType> requires LLKAInternal::LLKAStructureType<StructureType>
@@ -42,7 +44,7 @@ auto _extractNucleotideAtoms(const StructureType *stru, int32_t pdbx_PDB_model_n
     // NOTE: Do we need to care for microheterogentiy here?
     filteredAtoms.reserve(allAtoms.size());
     for (const auto &at : allAtoms) {
-        if (std::strcmp(at->label_comp_id, compId.c_str()) == 0)
+        if (compId.matches(at->label_comp_id))
             filteredAtoms.push_back(at);
     }
 
@@ -114,10 +116,16 @@ inline constinit std::array<char[9], 10> SUGAR_PUCKER_NAMES_FANCY{
     "C2' exo"
 };
 
-inline const std::array<std::string, 5> RIBOSE_CORE_ATOMS{
+inline constexpr std::array<LLKABones::ANString, 5> RIBOSE_CORE_ATOMS{
     "C4'", "O4'", "C1'", "C2'", "C3'"
 };
 
+inline LLKA_SAD_CONSTINIT std::array<double LLKA_NuAngles::*, 5> NU_ANGLES_CLSPTRS{
+    &LLKA_NuAngles::nu_0, &LLKA_NuAngles::nu_1, &LLKA_NuAngles::nu_2, &LLKA_NuAngles::nu_3, &LLKA_NuAngles::nu_4
+};
+
+inline constexpr double SIN_36_PLUS_SIN_72 = 1.5388417685876266; // sin(36 deg) + sin(72 deg)
+
 inline
 LLKA_SAD_CONSTEXPR_FUNC
 auto calcRibosePseudorotation(double tau0, double tau1, double tau2, double tau3, double tau4)
@@ -125,16 +133,16 @@ auto calcRibosePseudorotation(double tau0, double tau1, double tau2, double tau3
     if (LLKA_WITHIN_INCLUSIVE(-5.0e-5, tau2, 5.0e-5))
         tau2 = sign(tau2) * 5.0e-5;
 
-    // PERF: Simplify the sine thing!
-    const auto tanP = (tau4 + tau1 - tau3 - tau0) / (2.0 * tau2 * (std::sin(D2R(36.0)) + std::sin(D2R(72.0))));
-    auto P = std::atan(tanP);
+    // tan(P) = num / den. Because we know both the sine and the cosine of P up to a common factor,
+    // atan2() puts P in the correct quadrant and tMax = tau2 / cos(P) reduces to the length of (num, den).
+    const auto num = tau4 + tau1 - tau3 - tau0;
+    const auto den = 2.0 * tau2 * SIN_36_PLUS_SIN_72;
 
-    if (tau2 < 0.0)
-        P += M_PI;
-    else if (tanP < 0.0)
+    auto P = std::atan2(num, den);
+    if (P < 0.0)
         P += TWO_PI;
 
-    const auto tMax = std::abs(tau2 / std::cos(P));
+    const auto tMax = std::hypot(num, den) / (2.0 * SIN_36_PLUS_SIN_72);
 
     return std::make_tuple(P, tMax);
 }
@@ -210,7 +218,7 @@ bool isNucleotideCompound(const std::string &compId)
 inline
 bool isNucleotideCompound(const char *compId)
 {
-    return isNucleotideCompound(std::string{compId});
+    return LLKAInternal::isKnownResidue(compId);
 }
 
 template <typename StructureType> requires LLKAStructureType<StructureType>
@@ -261,11 +269,9 @@ auto pseudorotationToSugarPucker(double P)
     return LLKA_C3_ENDO;
 }
 
-template <typename StructureType> requires LLKAStructureType<StructureType>
 inline
-auto riboseMetrics(const StructureType &stru, LLKA_RiboseMetrics &metrics)
+auto completeRiboseMetrics(LLKA_RiboseMetrics &metrics)
 {
-    metrics.nus = measureNuAngles(stru);
     auto [P, tMax] = calcRibosePseudorotation(
         metrics.nus.nu_0,
         metrics.nus.nu_1,
@@ -279,6 +285,134 @@ auto riboseMetrics(const StructureType &stru, LLKA_RiboseMetrics &metrics)
     metrics.pucker = pseudorotationToSugarPucker(metrics.P);
 }
 
+/*
+ * Picks coordinates of the ribose core atoms, ordered as RIBOSE_CORE_ATOMS,
+ * from atoms that all belong to a single residue. The first matching atom wins.
+ */
+inline
+auto riboseCorePoints(const LLKA_Atom *atoms, size_t nAtoms, std::array<LLKA_Point, 5> &points)
+{
+    std::array<bool, RIBOSE_CORE_ATOMS.size()> found{};
+    size_t nFound = 0;
+
+    for (size_t atomIdx = 0; atomIdx < nAtoms && nFound < found.size(); atomIdx++) {
+        const LLKABones::ANString name{atoms[atomIdx].label_atom_id};
+        for (size_t idx = 0; idx < RIBOSE_CORE_ATOMS.size(); idx++) {
+            if (!found[idx] && RIBOSE_CORE_ATOMS[idx] == name) {
+                points[idx] = atoms[atomIdx].coords;
+                found[idx] = true;
+                nFound++;
+                break;
+            }
+        }
+    }
+
+    return nFound == found.size();
+}
+
+/*
+ * Picks coordinates of the ribose core atoms of both nucleotides of a step in a single pass.
+ * The step must have been validated beforehand.
+ */
+inline
+auto stepRiboseCorePoints_unchecked(const LLKA_Structure &step, std::array<LLKA_Point, 5> &first, std::array<LLKA_Point, 5> &second) -> LLKA_RetCode
+{
+    // The first and the last atom tell us which residue is which
+    const auto &firstAtom = step.atoms[0];
+    const auto &lastAtom = step.atoms[step.nAtoms - 1];
+
+    const LLKABones::ANString compIdFirst{firstAtom.label_comp_id};
+    const LLKABones::ANString compIdSecond{lastAtom.label_comp_id};
+
+    std::array<bool, RIBOSE_CORE_ATOMS.size()> foundFirst{};
+    std::array<bool, RIBOSE_CORE_ATOMS.size()> foundSecond{};
+
+    for (size_t atomIdx = 0; atomIdx < step.nAtoms; atomIdx++) {
+        const auto &atom = step.atoms[atomIdx];
+
+        std::array<LLKA_Point, 5> *points;
+        std::array<bool, 5> *found;
+        if (atom.label_seq_id == firstAtom.label_seq_id && compIdFirst.matches(atom.label_comp_id)) {
+            points = &first;
+            found = &foundFirst;
+        } else if (atom.label_seq_id == lastAtom.label_seq_id && compIdSecond.matches(atom.label_comp_id)) {
+            points = &second;
+            found = &foundSecond;
+        } else
+            continue;
+
+        if (atom.pdbx_PDB_model_num != firstAtom.pdbx_PDB_model_num || std::strcmp(atom.label_asym_id, firstAtom.label_asym_id) != 0)
+            continue;
+
+        const LLKABones::ANString name{atom.label_atom_id};
+        for (size_t idx = 0; idx < RIBOSE_CORE_ATOMS.size(); idx++) {
+            if (!(*found)[idx] && RIBOSE_CORE_ATOMS[idx] == name) {
+                (*points)[idx] = atom.coords;
+                (*found)[idx] = true;
+                break;
+            }
+        }
+    }
+
+    for (size_t idx = 0; idx < RIBOSE_CORE_ATOMS.size(); idx++) {
+        if (!foundFirst[idx] || !foundSecond[idx])
+            return LLKA_E_MISSING_ATOMS;
+    }
+
+    return LLKA_OK;
+}
+
+/*
+ * Fills in quads of points that define the nu angles nu_0 to nu_4 of a ribose
+ */
+inline
+auto nuAnglesQuads(const std::array<LLKA_Point, 5> &ribose, LLKA_Point *quads)
+{
+    for (size_t idx = 0; idx < NU_ANGLES_CLSPTRS.size(); idx++) {
+        for (size_t jdx = 0; jdx < 4; jdx++)
+            quads[4 * idx + jdx] = ribose[(idx + jdx) % ribose.size()];
+    }
+}
+
+/*
+ * Calculates metrics of many riboses at once. The nu angles of all riboses
+ * are measured with the batched dihedral kernel.
+ */
+inline
+auto riboseMetricsBatch(const std::array<LLKA_Point, 5> *riboses, size_t n, LLKA_RiboseMetrics *metrics)
+{
+    constexpr size_t CHUNK = 32;
+    constexpr size_t NUS = NU_ANGLES_CLSPTRS.size();
+
+    std::array<LLKA_Point, 4 * NUS * CHUNK> quads;
+    std::array<double, NUS * CHUNK> nus;
+
+    for (size_t first = 0; first < n; first += CHUNK) {
+        const size_t nChunk = std::min(CHUNK, n - first);
+
+        for (size_t idx = 0; idx < nChunk; idx++)
+            nuAnglesQuads(riboses[first + idx], &quads[4 * NUS * idx]);
+
+        dihedralAnglesBatch(quads.data(), NUS * nChunk, nus.data());
+
+        for (size_t idx = 0; idx < nChunk; idx++) {
+            auto &m = metrics[first + idx];
+            for (size_t jdx = 0; jdx < NUS; jdx++)
+                m.nus.*NU_ANGLES_CLSPTRS[jdx] = nus[NUS * idx + jdx];
+
+            completeRiboseMetrics(m);
+        }
+    }
+}
+
+template <typename StructureType> requires LLKAStructureType<StructureType>
+inline
+auto riboseMetrics(const StructureType &stru, LLKA_RiboseMetrics &metrics)
+{
+    metrics.nus = measureNuAngles(stru);
+    completeRiboseMetrics(metrics);
+}
+
 } // namespace LLKAInternal
 
 #endif // _NUCLEOTIDE_HPP
@@ -0,0 +1,173 @@
+// vim: set sw=4 ts=4 sts=4 expandtab :
+
+#include "profiling.hpp"
+
+#ifdef LLKA_ENABLE_PROFILING
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#endif // LLKA_ENABLE_PROFILING
+
+static const char * PHASE_NAMES[LLKA_PROFILE_NUM_PHASES] = {
+    "Cif parse",
+    "Cif to structure",
+    "Split to steps",
+    "Classify step",
+    "Step metrics",
+    "Ribose metrics",
+    "Golden step scan",
+    "Cluster voting",
+    "Superposition",
+    "Tolerances",
+    "Confal scoring"
+};
+
+#ifdef LLKA_ENABLE_PROFILING
+
+namespace LLKAInternal {
+
+/*
+ * Keeps track of the counters of all live threads. Counters of threads that
+ * have exited are folded into the retired totals.
+ */
+class ProfileCountersRegistry {
+public:
+    auto add(ThreadProfileCounters *counters) -> void
+    {
+        std::lock_guard lk{m_lock};
+        m_live.push_back(counters);
+    }
+
+    auto collect() -> std::array<std::pair<uint64_t, uint64_t>, LLKA_PROFILE_NUM_PHASES>
+    {
+        std::lock_guard lk{m_lock};
+
+        std::array<std::pair<uint64_t, uint64_t>, LLKA_PROFILE_NUM_PHASES> totals{};
+        for (size_t phase = 0; phase < LLKA_PROFILE_NUM_PHASES; phase++)
+            totals[phase] = { m_retiredCalls[phase], m_retiredNanoseconds[phase] };
+
+        for (const auto counters : m_live) {
+            for (size_t phase = 0; phase < LLKA_PROFILE_NUM_PHASES; phase++) {
+                totals[phase].first += counters->calls[phase].load(std::memory_order_relaxed) - counters->baselineCalls[phase];
+                totals[phase].second += counters->nanoseconds[phase].load(std::memory_order_relaxed) - counters->baselineNanoseconds[phase];
+            }
+        }
+
+        return totals;
+    }
+
+    auto remove(ThreadProfileCounters *counters) -> void
+    {
+        std::lock_guard lk{m_lock};
+
+        for (size_t phase = 0; phase < LLKA_PROFILE_NUM_PHASES; phase++) {
+            m_retiredCalls[phase] += counters->calls[phase].load(std::memory_order_relaxed) - counters->baselineCalls[phase];
+            m_retiredNanoseconds[phase] += counters->nanoseconds[phase].load(std::memory_order_relaxed) - counters->baselineNanoseconds[phase];
+        }
+
+        m_live.erase(std::find(m_live.begin(), m_live.end(), counters));
+    }
+
+    auto reset() -> void
+    {
+        std::lock_guard lk{m_lock};
+
+        // Counters are never written by other threads than their owners,
+        // resetting therefore only moves the baselines.
+        for (auto counters : m_live) {
+            for (size_t phase = 0; phase < LLKA_PROFILE_NUM_PHASES; phase++) {
+                counters->baselineCalls[phase] = counters->calls[phase].load(std::memory_order_relaxed);
+                counters->baselineNanoseconds[phase] = counters->nanoseconds[phase].load(std::memory_order_relaxed);
+            }
+        }
+
+        m_retiredCalls.fill(0);
+        m_retiredNanoseconds.fill(0);
+    }
+
+private:
+    std::mutex m_lock;
+    std::vector<ThreadProfileCounters *> m_live{};
+    std::array<uint64_t, LLKA_PROFILE_NUM_PHASES> m_retiredCalls{};
+    std::array<uint64_t, LLKA_PROFILE_NUM_PHASES> m_retiredNanoseconds{};
+};
+
+static
+auto registry() -> ProfileCountersRegistry &
+{
+    static ProfileCountersRegistry reg{};
+    return reg;
+}
+
+class LocalProfileCounters {
+public:
+    LocalProfileCounters()
+    {
+        registry().add(&counters);
+    }
+
+    ~LocalProfileCounters()
+    {
+        registry().remove(&counters);
+    }
+
+    ThreadProfileCounters counters{};
+};
+
+auto threadProfileCounters() -> ThreadProfileCounters &
+{
+    thread_local LocalProfileCounters local{};
+    return local.counters;
+}
+
+} // namespace LLKAInternal
+
+#endif // LLKA_ENABLE_PROFILING
+
+void LLKA_CC LLKA_destroyProfileCounters(LLKA_ProfileCounters *counters)
+{
+    delete [] counters->counters;
+}
+
+LLKA_ProfileCounters LLKA_CC LLKA_profileCounters()
+{
+#ifdef LLKA_ENABLE_PROFILING
+    const auto totals = LLKAInternal::registry().collect();
+
+    LLKA_ProfileCounters counters{};
+    counters.counters = new LLKA_ProfileCounter[LLKA_PROFILE_NUM_PHASES];
+    counters.nCounters = LLKA_PROFILE_NUM_PHASES;
+
+    for (size_t phase = 0; phase < LLKA_PROFILE_NUM_PHASES; phase++) {
+        auto &c = counters.counters[phase];
+        c.phase = LLKA_ProfilePhase(phase);
+        c.name = PHASE_NAMES[phase];
+        c.calls = totals[phase].first;
+        c.nanoseconds = totals[phase].second;
+    }
+
+    return counters;
+#else
+    (void)PHASE_NAMES;
+    return LLKA_ProfileCounters{};
+#endif // LLKA_ENABLE_PROFILING
+}
+
+LLKA_Bool LLKA_CC LLKA_profilingEnabled()
+{
+#ifdef LLKA_ENABLE_PROFILING
+    return LLKA_TRUE;
+#else
+    return LLKA_FALSE;
+#endif // LLKA_ENABLE_PROFILING
+}
+
+void LLKA_CC LLKA_resetProfileCounters()
+{
+#ifdef LLKA_ENABLE_PROFILING
+    LLKAInternal::registry().reset();
+#endif // LLKA_ENABLE_PROFILING
+}
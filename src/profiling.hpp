@@ -0,0 +1,92 @@
+// vim: set sw=4 ts=4 sts=4 expandtab :
+
+#ifndef _LLKA_PROFILING_HPP
+#define _LLKA_PROFILING_HPP
+
+#include <llka_profiling.h>
+
+#ifdef LLKA_ENABLE_PROFILING
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace LLKAInternal {
+
+/*
+ * Counters of one thread. Only the owning thread writes to the counters,
+ * other threads may only read them.
+ */
+class ThreadProfileCounters {
+public:
+    auto add(LLKA_ProfilePhase phase, uint64_t nanoseconds) noexcept -> void
+    {
+        auto &c = calls[phase];
+        auto &ns = this->nanoseconds[phase];
+
+        // There is only one writer so we do not need atomic read-modify-write
+        c.store(c.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        ns.store(ns.load(std::memory_order_relaxed) + nanoseconds, std::memory_order_relaxed);
+    }
+
+    std::array<std::atomic<uint64_t>, LLKA_PROFILE_NUM_PHASES> calls{};
+    std::array<std::atomic<uint64_t>, LLKA_PROFILE_NUM_PHASES> nanoseconds{};
+
+    // Values of the counters at the time of the last reset, guarded by the registry of all counters
+    std::array<uint64_t, LLKA_PROFILE_NUM_PHASES> baselineCalls{};
+    std::array<uint64_t, LLKA_PROFILE_NUM_PHASES> baselineNanoseconds{};
+};
+
+auto threadProfileCounters() -> ThreadProfileCounters &;
+
+template <LLKA_ProfilePhase Phase>
+class ProfileScope {
+public:
+    ProfileScope() :
+        m_counters{threadProfileCounters()},
+        m_start{std::chrono::steady_clock::now()}
+    {
+    }
+
+    ProfileScope(const ProfileScope &) = delete;
+
+    ~ProfileScope()
+    {
+        const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_start);
+        m_counters.add(Phase, uint64_t(elapsed.count()));
+    }
+
+    auto operator=(const ProfileScope &) -> ProfileScope & = delete;
+
+private:
+    ThreadProfileCounters &m_counters;
+    const std::chrono::steady_clock::time_point m_start;
+};
+
+template <LLKA_ProfilePhase Phase, typename Func>
+auto profiled(Func &&func) -> decltype(auto)
+{
+    ProfileScope<Phase> scope{};
+    return func();
+}
+
+} // namespace LLKAInternal
+
+#define _LLKA_PROFILE_CONCAT_IMPL(a, b) a ## b
+#define _LLKA_PROFILE_CONCAT(a, b) _LLKA_PROFILE_CONCAT_IMPL(a, b)
+
+// Measures the time from this point to the end of the enclosing scope
+#define LLKA_PROFILE_SCOPE(phase) ::LLKAInternal::ProfileScope<phase> _LLKA_PROFILE_CONCAT(__llkaProfileScope_, __LINE__){}
+
+// Measures evaluation of an expression and returns its result
+#define LLKA_PROFILED(phase, ...) ::LLKAInternal::profiled<phase>([&]() -> decltype(auto) { return __VA_ARGS__; })
+
+#else
+
+#define LLKA_PROFILE_SCOPE(phase)
+#define LLKA_PROFILED(phase, ...) (__VA_ARGS__)
+
+#endif // LLKA_ENABLE_PROFILING
+
+#endif // _LLKA_PROFILING_HPP
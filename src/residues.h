@@ -3,97 +3,201 @@
 #ifndef _RESIDUES_H
 #define _RESIDUES_H
 
-#include <cassert>
-#include <set>
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
 
 #include "standard_residues.h"
 #include "non_standard_residues.h"
 
 namespace LLKAInternal {
 
-static
-auto initializeAllKnownResidues()
-{
-    std::set<LLKABones::ANString> all;
+class KnownResidue {
+public:
+    LLKABones::ANString name;
+    LLKA_BaseKind baseKind;
+    const LLKABones::Bone *bone;
+};
+
+/*
+ * Perfect hash table of all known residues. The table is built at compile time
+ * using the "hash and displace" scheme: keys are first distributed into buckets,
+ * each bucket then gets a displacement value that moves all its keys into free slots.
+ * A lookup thus takes one hash, two array reads and a single 64-bit comparison.
+ */
+template <size_t N>
+class KnownResiduesTable {
+public:
+    static constexpr size_t NUM_BUCKETS = std::bit_ceil(N / 2 + 1);
+    static constexpr size_t NUM_SLOTS = std::bit_ceil(N * 2);
+    static constexpr uint16_t EMPTY_SLOT = UINT16_MAX;
+    static constexpr uint32_t MAX_DISPLACEMENT = 1 << 16;
+
+    static_assert(N < EMPTY_SLOT);
+    static_assert(NUM_BUCKETS <= (size_t(1) << 16));
+
+    constexpr KnownResiduesTable(const std::array<KnownResidue, N> &residues) :
+        m_residues{residues},
+        m_displacements{},
+        m_slots{}
+    {
+        m_slots.fill(EMPTY_SLOT);
+
+        std::array<uint64_t, N> hashes{};
+        for (size_t idx = 0; idx < N; idx++)
+            hashes[idx] = hash(m_residues[idx].name);
+
+        // Sort residues into buckets with counting sort
+        std::array<uint16_t, NUM_BUCKETS + 1> bucketStarts{};
+        std::array<uint16_t, N> byBucket{};
+        for (const auto h : hashes)
+            bucketStarts[bucketOf(h) + 1]++;
+        for (size_t idx = 1; idx <= NUM_BUCKETS; idx++)
+            bucketStarts[idx] += bucketStarts[idx - 1];
+
+        std::array<uint16_t, NUM_BUCKETS> fill{};
+        for (size_t idx = 0; idx < N; idx++) {
+            const auto bucket = bucketOf(hashes[idx]);
+            byBucket[bucketStarts[bucket] + fill[bucket]++] = uint16_t(idx);
+        }
+
+        size_t maxBucketSize = 0;
+        for (size_t bucket = 0; bucket < NUM_BUCKETS; bucket++)
+            maxBucketSize = std::max<size_t>(maxBucketSize, bucketStarts[bucket + 1] - bucketStarts[bucket]);
+
+        // Place the largest buckets first while the table is still mostly empty
+        for (size_t size = maxBucketSize; size > 0; size--) {
+            for (size_t bucket = 0; bucket < NUM_BUCKETS; bucket++) {
+                const size_t first = bucketStarts[bucket];
+                const size_t last = bucketStarts[bucket + 1];
+                if (last - first == size)
+                    m_displacements[bucket] = placeBucket(&byBucket[first], size, hashes);
+            }
+        }
+    }
+
+    constexpr auto find(const LLKABones::ANString &name) const noexcept -> const KnownResidue *
+    {
+        const auto h = hash(name);
+        const auto slot = m_slots[slotOf(h, m_displacements[bucketOf(h)])];
+        if (slot == EMPTY_SLOT || m_residues[slot].name != name)
+            return nullptr;
+
+        return &m_residues[slot];
+    }
+
+private:
+    static constexpr auto hash(const LLKABones::ANString &name) noexcept -> uint64_t
+    {
+        uint64_t v = name.packed();
+        v ^= v >> 30;
+        v *= 0xBF58476D1CE4E5B9ULL;
+        v ^= v >> 27;
+        v *= 0x94D049BB133111EBULL;
+        v ^= v >> 31;
+        return v;
+    }
+
+    static constexpr auto bucketOf(uint64_t h) noexcept -> size_t
+    {
+        return (h >> 48) & (NUM_BUCKETS - 1);
+    }
+
+    static constexpr auto slotOf(uint64_t h, uint16_t displacement) noexcept -> size_t
+    {
+        return (uint32_t(h) + displacement * ((h >> 32) | 1)) & (NUM_SLOTS - 1);
+    }
+
+    constexpr auto placeBucket(const uint16_t *members, size_t size, const std::array<uint64_t, N> &hashes) -> uint16_t
+    {
+        // Equal names always end up in the same bucket and could never be placed
+        for (size_t idx = 0; idx < size; idx++) {
+            for (size_t jdx = 0; jdx < idx; jdx++) {
+                if (m_residues[members[idx]].name == m_residues[members[jdx]].name)
+                    throw "Duplicate residue name in the list of known residues";
+            }
+        }
+
+        for (uint32_t displacement = 0; displacement < MAX_DISPLACEMENT; displacement++) {
+            size_t placed = 0;
+            while (placed < size) {
+                const auto slot = slotOf(hashes[members[placed]], uint16_t(displacement));
+                if (m_slots[slot] != EMPTY_SLOT)
+                    break;
+                m_slots[slot] = members[placed++];
+            }
+
+            if (placed == size)
+                return uint16_t(displacement);
+
+            // Roll back and try the next displacement
+            for (size_t idx = 0; idx < placed; idx++)
+                m_slots[slotOf(hashes[members[idx]], uint16_t(displacement))] = EMPTY_SLOT;
+        }
 
-    // Standard residues are just a vector of strings
-    for (const auto &name : KNOWN_STANDARD_RESIDUES) {
-        assert(!all.contains(name));
-        all.insert(name);
+        throw "Cannot find displacement for a bucket of known residues";
     }
 
-    // Non-standard residues are a map
-    for (const auto &[key, _] : KNOWN_NON_STANDARD_RESIDUES) {
-        assert(!all.contains(key));
-        all.insert(key);
+    std::array<KnownResidue, N> m_residues;
+    std::array<uint16_t, NUM_BUCKETS> m_displacements;
+    std::array<uint16_t, NUM_SLOTS> m_slots;
+};
+
+inline constexpr
+auto makeKnownResiduesTable()
+{
+    constexpr size_t NUM_STANDARD = STANDARD_RESIDUES_BASES.size();
+    constexpr size_t NUM_NON_STANDARD = KNOWN_NON_STANDARD_RESIDUES.size();
+
+    std::array<KnownResidue, NUM_STANDARD + NUM_NON_STANDARD> residues{};
+
+    size_t idx = 0;
+    for (const auto &[name, baseKind] : STANDARD_RESIDUES_BASES) {
+        const auto bone = baseKind == LLKA_PURINE ? &LLKABones::StandardPurineBone : &LLKABones::StandardPyrimidineBone;
+        residues[idx++] = { name, baseKind, bone };
     }
+    for (const auto &[name, bone] : KNOWN_NON_STANDARD_RESIDUES)
+        residues[idx++] = { name, LLKA_NON_STANDARD_BASE, bone };
 
-    return all;
+    return KnownResiduesTable{residues};
 }
 
-inline const std::set<LLKABones::ANString> ALL_KNOWN_RESIDUES = initializeAllKnownResidues();
+inline constexpr auto KNOWN_RESIDUES = makeKnownResiduesTable();
 
 inline
 bool isKnownResidue(const LLKABones::ANString &name)
 {
-    // Check priority residues first. ALL_KNOWN_RESIDUES contains them too
-    // but the lookup would take more time because we'd have to do a search in a set
-    if (std::find(PRIORITY_RESIDUES.cbegin(), PRIORITY_RESIDUES.cend(), name) != PRIORITY_RESIDUES.cend())
-        return true;
-
-    return ALL_KNOWN_RESIDUES.contains(name);
+    return KNOWN_RESIDUES.find(name) != nullptr;
 }
 
 inline
 bool isStandardResidue(const LLKABones::ANString &name)
 {
-    // Check priority residues first. ALL_KNOWN_RESIDUES contains them too
-    // but the lookup would take more time because we'd have to do a search in a set
-    if (std::find(PRIORITY_RESIDUES.cbegin(), PRIORITY_RESIDUES.cend(), name) != PRIORITY_RESIDUES.cend())
-        return true;
+    const auto res = KNOWN_RESIDUES.find(name);
 
-    return std::find(KNOWN_STANDARD_RESIDUES.cbegin(), KNOWN_STANDARD_RESIDUES.cend(), name) != KNOWN_STANDARD_RESIDUES.cend();
+    return res != nullptr && res->baseKind != LLKA_NON_STANDARD_BASE;
 }
 
 inline
 bool findBaseKind(const LLKABones::ANString &name, LLKA_BaseKind &kind)
 {
-    auto itStd = STANDARD_RESIDUES_BASES.find(name);
-    if (itStd != STANDARD_RESIDUES_BASES.cend()) {
-        kind = itStd->second;
-        return true;
-    }
-
-    auto itNonStd = KNOWN_NON_STANDARD_RESIDUES.find(name);
-    if (itNonStd != KNOWN_NON_STANDARD_RESIDUES.cend()) {
-        kind = LLKA_NON_STANDARD_BASE;
-        return true;
-    }
+    const auto res = KNOWN_RESIDUES.find(name);
+    if (!res)
+        return false;
 
-    return false;
+    kind = res->baseKind;
+    return true;
 }
 
 inline
 const LLKABones::Bone & findBone(const LLKABones::ANString &name)
 {
-    if (isStandardResidue(name)) {
-        const auto base = STANDARD_RESIDUES_BASES.at(name);
-        switch (base) {
-        case LLKA_PURINE:
-            return LLKABones::StandardPurineBone;
-        case LLKA_PYRIMIDINE:
-            return LLKABones::StandardPyrimidineBone;
-        default:
-            assert(false);
-        }
-    }
-
-    auto nonStdId = KNOWN_NON_STANDARD_RESIDUES.find(name);
-    if (nonStdId == KNOWN_NON_STANDARD_RESIDUES.cend()) {
+    const auto res = KNOWN_RESIDUES.find(name);
+    if (!res)
         return LLKABones::StandardPurineBone; // Fall back to this because we don't know what else to do.
-    }
 
-    return nonStdId->second;
+    return *res->bone;
 }
 
 } // namespace LLKAInternal
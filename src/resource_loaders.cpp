@@ -2,8 +2,17 @@
 
 #include <llka_resource_loaders.h>
 
+#include "classification_context.hpp"
 #include "util/elementaries.h"
 #include "util/csv.hpp"
+#include "util/parallel.hpp"
+
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <memory>
+#include <string_view>
+#include <vector>
 
 namespace LLKAInternal {
 
@@ -12,39 +21,56 @@ inline constinit char CSV_QUOTE{'"'};
 
 namespace Csv {
 
+// Large enough for the name of any NtC, CANA or sugar pucker
+inline constexpr size_t NAME_BUFFER_SIZE = 32;
+
 template <>
 struct Convert<LLKA_CANA> {
-	template <typename Tag>
-	static auto call(const std::string &s, const Tag &tag)
+	static auto call(const std::string_view &s, LLKA_CANA &cana) -> bool
 	{
-		auto cana = LLKA_nameToCANA(s.c_str());
-		if (cana == LLKA_INVALID_CANA)
-			throw TokenParseError{tagStr(tag)};
-		return cana;
+		std::array<char, NAME_BUFFER_SIZE> buf;
+		const auto name = terminated(s, buf);
+		if (name == nullptr)
+			return false;
+
+		cana = LLKA_nameToCANA(name);
+		return cana != LLKA_INVALID_CANA;
 	}
 };
 
 template <>
 struct Convert<LLKA_NtC> {
-	template <typename Tag>
-	static auto call(const std::string &s, const Tag &tag)
+	static auto call(const std::string_view &s, LLKA_NtC &ntc) -> bool
 	{
-		auto ntc = LLKA_nameToNtC(s.c_str());
-		if (ntc == LLKA_INVALID_NTC)
-			throw TokenParseError{tagStr(tag)};
-		return ntc;
+		std::array<char, NAME_BUFFER_SIZE> buf;
+		const auto name = terminated(s, buf);
+		if (name == nullptr)
+			return false;
+
+		ntc = LLKA_nameToNtC(name);
+		return ntc != LLKA_INVALID_NTC;
 	}
 };
 
 template <>
 struct Convert<LLKA_SugarPucker> {
-	template <typename Tag>
-	static auto call(const std::string &s, const Tag &tag)
+	static auto call(const std::string_view &s, LLKA_SugarPucker &pucker) -> bool
 	{
-		auto pucker = LLKA_nameToSugarPucker(s.c_str());
-		if (pucker == LLKA_INVALID_SUGAR_PUCKER)
-			throw TokenParseError{tagStr(tag)};
-		return pucker;
+		std::array<char, NAME_BUFFER_SIZE> buf;
+		const auto name = terminated(s, buf);
+		if (name == nullptr)
+			return false;
+
+		pucker = LLKA_nameToSugarPucker(name);
+		return pucker != LLKA_INVALID_SUGAR_PUCKER;
+	}
+};
+
+template <>
+struct Release<LLKA_GoldenStep> {
+	static auto call(LLKA_GoldenStep &gs) -> void
+	{
+		destroyString(gs.name);
 	}
 };
 
@@ -244,25 +270,80 @@ template <typename Schema, typename Input>
 static
 auto read(const Input &input, typename Schema::Line * &data, size_t &count)
 {
-	try {
-		auto [ lines, warnings ] = LLKAInternal::Csv::parse<Schema>(input, LLKAInternal::CSV_DELIM, LLKAInternal::CSV_QUOTE);
+	std::vector<typename Schema::Line> lines{};
+
+	auto tRet = LLKAInternal::Csv::parse<Schema>(input, LLKAInternal::CSV_DELIM, LLKAInternal::CSV_QUOTE, lines);
+	if (tRet != LLKA_OK)
+		return tRet;
 
-		if (!warnings.empty())
-			return LLKA_E_BAD_DATA;
+	if (lines.empty())
+		return LLKA_E_BAD_DATA;
 
-		if (lines.empty())
-			return LLKA_E_BAD_DATA;
+	data = new typename Schema::Line[lines.size()];
+	count = lines.size();
 
-		data = new typename Schema::Line[lines.size()];
-		count = lines.size();
+	std::copy(lines.cbegin(), lines.cend(), data);
 
-		for (size_t idx = 0; idx < lines.size(); idx++)
-			data[idx] = lines[idx];
+	return LLKA_OK;
+}
 
-		return LLKA_OK;
-	} catch (const LLKA_RetCode tRet) {
+template <typename Schema, typename Input>
+static
+auto readInto(const Input &input, std::vector<typename Schema::Line> &lines) -> LLKA_RetCode
+{
+	auto tRet = LLKAInternal::Csv::parse<Schema>(input, LLKAInternal::CSV_DELIM, LLKAInternal::CSV_QUOTE, lines);
+	if (tRet != LLKA_OK)
 		return tRet;
-	}
+
+	return lines.empty() ? LLKA_E_BAD_DATA : LLKA_OK;
+}
+
+template <typename Input>
+struct ClassificationInputs {
+	Input clusters;
+	Input goldenSteps;
+	Input confals;
+	Input clusterNuAngles;
+	Input confalPercentiles;
+};
+
+/*
+ * Parses the resources straight into the storage of a new context. Tables that the context
+ * rearranges anyway are parsed into temporary vectors and handed over by reference.
+ */
+template <typename Input>
+static
+auto loadClassificationContext(
+	const ClassificationInputs<Input> &inputs,
+	const LLKA_ClassificationLimits &limits,
+	double maxCloseEnoughRmsd,
+	LLKA_ClassificationContext **ctx
+) -> LLKA_RetCode
+{
+	auto _ctx = std::make_unique<LLKA_ClassificationContext>();
+	auto &storage = _ctx->storage;
+
+	std::vector<LLKA_Confal> confals{};
+	std::vector<LLKA_ClusterNuAngles> clusterNuAngles{};
+	std::vector<LLKA_ConfalPercentile> confalPercentiles{};
+
+	auto tRet = LLKAInternal::runConcurrently<5>({
+		[&]() { return readInto<GoldenStepsSchema>(inputs.goldenSteps, storage.goldenSteps); },
+		[&]() { return readInto<ClustersSchema>(inputs.clusters, storage.clusters); },
+		[&]() { return readInto<ConfalsSchema>(inputs.confals, confals); },
+		[&]() { return readInto<ClusterNuAnglesSchema>(inputs.clusterNuAngles, clusterNuAngles); },
+		[&]() { return readInto<ConfalPercentilesSchema>(inputs.confalPercentiles, confalPercentiles); }
+	});
+	if (tRet != LLKA_OK)
+		return tRet;
+
+	tRet = initializeClassificationContext(*_ctx, confals, clusterNuAngles, confalPercentiles, limits, maxCloseEnoughRmsd);
+	if (tRet != LLKA_OK)
+		return tRet;
+
+	*ctx = _ctx.release();
+
+	return LLKA_OK;
 }
 
 } // namespace LLKA
@@ -326,7 +407,7 @@ LLKA_RetCode loadResourceByType(const ParamStr param, LLKA_Resource *resource)
 	if constexpr (As == ResourceAs::FILE)
 		return LLKAInternal::read<typename Loader::Schema, std::filesystem::path>(param, resource->data.*Loader::Data, resource->count);
 	else if constexpr (As == ResourceAs::TEXT)
-		return LLKAInternal::read<typename Loader::Schema, std::string>(param, resource->data.*Loader::Data, resource->count);
+		return LLKAInternal::read<typename Loader::Schema, std::string_view>(param, resource->data.*Loader::Data, resource->count);
 	else
 		return LLKA_E_INVALID_ARGUMENT;
 }
@@ -382,3 +463,48 @@ LLKA_RetCode LLKA_CC LLKA_loadResourceText(const char *text, LLKA_Resource *reso
 {
 	return loadResource<ResourceAs::TEXT>(text, resource);
 }
+
+LLKA_RetCode LLKA_CC LLKA_initializeClassificationContextFromBundle(
+	const LLKA_ClassificationResourceBundle *bundle,
+	const LLKA_ClassificationLimits *limits,
+	double maxCloseEnoughRmsd,
+	LLKA_ClassificationContext **ctx
+)
+{
+	for (const auto text : { bundle->clusters, bundle->goldenSteps, bundle->confals, bundle->clusterNuAngles, bundle->confalPercentiles }) {
+		if (text == nullptr)
+			return LLKA_E_INVALID_ARGUMENT;
+	}
+
+	const LLKAInternal::ClassificationInputs<std::string_view> inputs{
+		bundle->clusters,
+		bundle->goldenSteps,
+		bundle->confals,
+		bundle->clusterNuAngles,
+		bundle->confalPercentiles
+	};
+
+	return LLKAInternal::loadClassificationContext(inputs, *limits, maxCloseEnoughRmsd, ctx);
+}
+
+#ifndef LLKA_FILESYSTEM_ACCESS_DISABLED
+LLKA_RetCode LLKA_CC LLKA_initializeClassificationContextFromDirectory(
+	const LLKA_PathChar *path,
+	const LLKA_ClassificationLimits *limits,
+	double maxCloseEnoughRmsd,
+	LLKA_ClassificationContext **ctx
+)
+{
+	const std::filesystem::path dir{path};
+
+	const LLKAInternal::ClassificationInputs<std::filesystem::path> inputs{
+		dir / "clusters.csv",
+		dir / "golden_steps.csv",
+		dir / "confals.csv",
+		dir / "nu_angles.csv",
+		dir / "confal_percentiles.csv"
+	};
+
+	return LLKAInternal::loadClassificationContext(inputs, *limits, maxCloseEnoughRmsd, ctx);
+}
+#endif /* LLKA_FILESYSTEM_ACCESS_DISABLED */
@@ -7,10 +7,8 @@
 
 #include "ntc_bones.hpp"
 
-#include <algorithm>
-#include <map>
-#include <string>
-#include <vector>
+#include <array>
+#include <utility>
 
 /*
  * IMPORTANT NOTE:
@@ -21,7 +19,7 @@
 
 namespace LLKAInternal {
 
-    inline const std::map<LLKABones::ANString, LLKA_BaseKind> STANDARD_RESIDUES_BASES = {
+inline constexpr auto STANDARD_RESIDUES_BASES = std::to_array<std::pair<LLKABones::ANString, LLKA_BaseKind>>({
     {  "0A", LLKA_PURINE },
     { "0AD", LLKA_PURINE },
     { "0AP", LLKA_PYRIMIDINE },
@@ -431,44 +429,7 @@ namespace LLKAInternal {
     { "YYG", LLKA_PURINE },
     {   "Z", LLKA_PYRIMIDINE },
     { "ZDU", LLKA_PYRIMIDINE }
-};
-
-inline const std::vector<LLKABones::ANString> PRIORITY_RESIDUES = {
-    "A", "DA", "C", "DC", "G", "DG", "T", "U"
-};
-
-inline
-auto priorityResidueComparator(const std::string &lhs, const std::string &rhs)
-{
-    auto prioLhs = std::find(PRIORITY_RESIDUES.cbegin(), PRIORITY_RESIDUES.cend(), lhs);
-    auto prioRhs = std::find(PRIORITY_RESIDUES.cbegin(), PRIORITY_RESIDUES.cend(), rhs);
-
-    if (prioLhs != PRIORITY_RESIDUES.cend()) {
-        if (prioRhs != PRIORITY_RESIDUES.cend()) {
-            return prioLhs < prioRhs;
-        } else
-            return true; // lhs is a priority residue, rhs is not. Prioritize lhs.
-    } else if (prioRhs != PRIORITY_RESIDUES.cend())
-        return false; // lhs is not a priority residue, rhs is. Prioritize rhs.
-
-    return lhs < rhs;
-}
-
-static
-auto initializeStandardResidues()
-{
-    std::vector<LLKABones::ANString> vec{};
-    vec.reserve(STANDARD_RESIDUES_BASES.size());
-
-    for (const auto &it : STANDARD_RESIDUES_BASES)
-        vec.push_back(it.first);
-
-    std::sort(vec.begin(), vec.end(), priorityResidueComparator);
-
-    return vec;
-}
-
-inline const std::vector<LLKABones::ANString> KNOWN_STANDARD_RESIDUES = initializeStandardResidues();
+});
 
 } // namespace LLKAInternal
 
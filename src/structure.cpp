@@ -5,11 +5,14 @@
 
 #include "extend.h"
 #include "nucleotide.hpp"
+#include "profiling.hpp"
 #include "structure_util.hpp"
 #include "util/elementaries.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cstring>
+#include <unordered_set>
 
 static
 auto atomMatchesCriteria(
@@ -45,6 +48,62 @@ auto atomMatchesCriteria(
     return atom->pdbx_PDB_model_num == pdbx_PDB_model_num;
 }
 
+template <typename Pred>
+static
+auto compactStructure(LLKA_Structure *stru, const Pred &shouldRemove) -> size_t
+{
+    size_t kept = 0;
+    for (size_t idx = 0; idx < stru->nAtoms; idx++) {
+        auto &atom = stru->atoms[idx];
+
+        if (shouldRemove(atom))
+            LLKA_destroyAtom(&atom);
+        else {
+            if (kept != idx)
+                stru->atoms[kept] = atom;
+            kept++;
+        }
+    }
+
+    const size_t removed = stru->nAtoms - kept;
+
+    // The atoms array is intentionally not shrunk. It is an array of PODs so it can be
+    // released by LLKA_destroyStructure() regardless of its actual size.
+    if (kept == 0) {
+        delete [] stru->atoms;
+        stru->atoms = nullptr;
+    }
+    stru->nAtoms = kept;
+
+    return removed;
+}
+
+static
+auto reallocateBuilder(LLKA_StructureBuilder *builder, size_t capacity)
+{
+    assert(capacity >= builder->nAtoms);
+
+    auto newAtoms = new LLKA_Atom[capacity];
+    if (builder->nAtoms > 0)
+        std::memcpy(newAtoms, builder->atoms, builder->nAtoms * sizeof(LLKA_Atom));
+
+    delete [] builder->atoms;
+    builder->atoms = newAtoms;
+    builder->capacity = capacity;
+}
+
+static
+auto growBuilder(LLKA_StructureBuilder *builder, size_t nAdded)
+{
+    const size_t required = builder->nAtoms + nAdded;
+    if (required <= builder->capacity)
+        return;
+
+    // Grow geometrically so that appending one atom at a time has amortized constant cost
+    const size_t MIN_CAPACITY = 16;
+    reallocateBuilder(builder, std::max({ required, 2 * builder->capacity, MIN_CAPACITY }));
+}
+
 void LLKA_CC LLKA_appendAtom(const LLKA_Atom *atom, LLKA_Structure *stru)
 {
     auto newAtoms = new LLKA_Atom[stru->nAtoms + 1];
@@ -97,6 +156,50 @@ void LLKA_CC LLKA_appendAtomFromParams(
     stru->nAtoms++;
 }
 
+void LLKA_CC LLKA_appendAtomToBuilder(const LLKA_Atom *atom, LLKA_StructureBuilder *builder)
+{
+    growBuilder(builder, 1);
+
+    LLKA_duplicateAtom(atom, &builder->atoms[builder->nAtoms]);
+    builder->nAtoms++;
+}
+
+void LLKA_CC LLKA_appendAtomFromParamsToBuilder(
+    uint32_t id,
+    const char *type_symbol,
+    const char *label_atom_id,
+    const char *label_entity_id,
+    const char *label_comp_id,
+    const char *label_asym_id,
+    const char *auth_atom_id,
+    const char *auth_comp_id,
+    const char* auth_asym_id,
+    int32_t label_seq_id,
+    char label_alt_id,
+    int32_t auth_seq_id,
+    const char *pdbx_PDB_ins_code,
+    int32_t pdbx_PDB_model_num,
+    const LLKA_Point *coords,
+    LLKA_StructureBuilder *builder
+)
+{
+    growBuilder(builder, 1);
+
+    LLKA_initAtom(
+        id,
+        type_symbol,
+        label_atom_id, label_entity_id, label_comp_id, label_asym_id,
+        auth_atom_id, auth_comp_id, auth_asym_id,
+        label_seq_id, label_alt_id, auth_seq_id,
+        pdbx_PDB_ins_code,
+        pdbx_PDB_model_num,
+        coords,
+        &builder->atoms[builder->nAtoms]
+    );
+
+    builder->nAtoms++;
+}
+
 LLKA_API void LLKA_CC LLKA_appendStructure(const LLKA_Structure *appendend, LLKA_Structure *appendee)
 {
     const size_t nNewAtoms = appendee->nAtoms + appendend->nAtoms;
@@ -113,6 +216,16 @@ LLKA_API void LLKA_CC LLKA_appendStructure(const LLKA_Structure *appendend, LLKA
     appendee->nAtoms = nNewAtoms;
 }
 
+void LLKA_CC LLKA_appendStructureToBuilder(const LLKA_Structure *appendend, LLKA_StructureBuilder *builder)
+{
+    growBuilder(builder, appendend->nAtoms);
+
+    for (size_t idx = 0; idx < appendend->nAtoms; idx++)
+        LLKA_duplicateAtom(&appendend->atoms[idx], &builder->atoms[builder->nAtoms + idx]);
+
+    builder->nAtoms += appendend->nAtoms;
+}
+
 LLKA_RetCode LLKA_CC LLKA_baseKind(const char *compId, LLKA_BaseKind *kind)
 {
     if (LLKAInternal::findBaseKind(compId, *kind))
@@ -187,11 +300,27 @@ void LLKA_CC LLKA_destroyStructure(const LLKA_Structure *stru)
     delete [] stru->atoms;
 }
 
+void LLKA_CC LLKA_destroyStructureBuilder(const LLKA_StructureBuilder *builder)
+{
+    for (size_t idx = 0; idx < builder->nAtoms; idx++)
+        LLKA_destroyAtom(&builder->atoms[idx]);
+
+    delete [] builder->atoms;
+}
+
 void LLKA_CC LLKA_destroyStructureView(const LLKA_StructureView *view)
 {
     delete [] view->atoms;
 }
 
+void LLKA_CC LLKA_destroyStructureViews(const LLKA_StructureViews *views)
+{
+    for (size_t idx = 0; idx < views->nViews; idx++)
+        LLKA_destroyStructureView(&views->views[idx]);
+
+    delete [] views->views;
+}
+
 void LLKA_CC LLKA_destroyStructures(const LLKA_Structures *strus)
 {
     for (size_t idx = 0; idx < strus->nStrus; idx++)
@@ -302,6 +431,27 @@ const LLKA_Atom * LLKA_findAtomView(
 }
 
 
+LLKA_Structure LLKA_CC LLKA_finishStructureBuilder(LLKA_StructureBuilder *builder)
+{
+    LLKA_Structure stru{
+        builder->atoms,
+        builder->nAtoms
+    };
+
+    // The atoms array is an array of PODs so it does not matter that it may be bigger
+    // than the number of atoms. LLKA_destroyStructure() will free it correctly.
+    if (stru.nAtoms < 1) {
+        delete [] stru.atoms;
+        stru.atoms = nullptr;
+    }
+
+    builder->atoms = nullptr;
+    builder->nAtoms = 0;
+    builder->capacity = 0;
+
+    return stru;
+}
+
 void LLKA_CC LLKA_initAtom(
     uint32_t id,
     const char *type_symbol,
@@ -353,6 +503,13 @@ void LLKA_CC LLKA_initStructure(const LLKA_Atom *atoms, size_t nAtoms, LLKA_Stru
     stru->nAtoms = nAtoms;
 }
 
+void LLKA_CC LLKA_initStructureBuilder(size_t capacity, LLKA_StructureBuilder *builder)
+{
+    builder->atoms = capacity > 0 ? new LLKA_Atom[capacity] : nullptr;
+    builder->nAtoms = 0;
+    builder->capacity = capacity;
+}
+
 LLKA_Atom LLKA_CC LLKA_makeAtom(
     uint32_t id,
     const char *type_symbol,
@@ -451,6 +608,29 @@ void LLKA_CC LLKA_removeAtomById(uint32_t id, LLKA_Structure *stru)
     stru->nAtoms--;
 }
 
+void LLKA_CC LLKA_reserveStructureBuilder(size_t capacity, LLKA_StructureBuilder *builder)
+{
+    if (capacity <= builder->capacity)
+        return;
+
+    reallocateBuilder(builder, capacity);
+}
+
+size_t LLKA_CC LLKA_removeAtomsByIds(const uint32_t *ids, size_t nIds, LLKA_Structure *stru)
+{
+    if (nIds == 0)
+        return 0;
+
+    const std::unordered_set<uint32_t> toRemove(ids, ids + nIds);
+
+    return compactStructure(stru, [&toRemove](const LLKA_Atom &atom) { return toRemove.contains(atom.id); });
+}
+
+size_t LLKA_CC LLKA_removeAtomsIf(LLKA_AtomPredicate predicate, void *userData, LLKA_Structure *stru)
+{
+    return compactStructure(stru, [predicate, userData](const LLKA_Atom &atom) { return predicate(&atom, userData) == LLKA_TRUE; });
+}
+
 LLKA_API LLKA_Structures LLKA_CC LLKA_splitByAltIds(const LLKA_Structure *stru, LLKA_AlternatePositions *alts)
 {
     auto [ strus, altIds ] = LLKAInternal::splitByAltIds(*stru);
@@ -476,8 +656,35 @@ LLKA_API LLKA_Structures LLKA_CC LLKA_splitByAltIds(const LLKA_Structure *stru,
     return retStrus;
 }
 
+LLKA_StructureViews LLKA_CC LLKA_splitByAltIdsView(const LLKA_Structure *stru, LLKA_AlternatePositions *alts)
+{
+    auto [ views, altIds ] = LLKAInternal::splitByAltIdsView(*stru);
+    const auto N = views.size();
+
+    LLKA_StructureViews retViews {
+        new LLKA_StructureView[N],
+        N
+    };
+    std::copy_n(views.cbegin(), N, retViews.views);
+
+    if (!altIds.empty()) {
+        char *pos = new char[N];
+        std::copy_n(altIds.cbegin(), N, pos);
+
+        alts->positions = pos;
+        alts->nPositions = N;
+    } else {
+        alts->positions = nullptr;
+        alts->nPositions = 0;
+    }
+
+    return retViews;
+}
+
 LLKA_RetCode LLKA_CC LLKA_splitStructureToDinucleotideSteps(const LLKA_Structure *stru, LLKA_Structures *steps)
 {
+    LLKA_PROFILE_SCOPE(LLKA_PROFILE_SPLIT_TO_STEPS);
+
     std::vector<LLKA_Structure> allSteps;
 
     size_t idx = 0;
@@ -489,7 +696,7 @@ LLKA_RetCode LLKA_CC LLKA_splitStructureToDinucleotideSteps(const LLKA_Structure
             continue;
         }
 
-        // Notice how we instruct the extendToResidue() function to only look forward.
+        // Notice how we only look forward when extending to residue.
         // This is becasue the loop above looks for the first viable atom. Going backwards from
         // what has to be a first atom in a residue makes no sense.
         // Besides being a small performance tweak at also allows us to deal with structures
@@ -503,27 +710,22 @@ LLKA_RetCode LLKA_CC LLKA_splitStructureToDinucleotideSteps(const LLKA_Structure
         // filter out any unknown bases after extending to residue.
         // That would be rather slow and it probably is not necessary for any currently deposited structures.
 
-        LLKA_Structure firstNucl = LLKAInternal::extendToResidue({ stru, idx }, atom.pdbx_PDB_model_num, atom.label_asym_id, atom.label_seq_id, LLKA_NO_ALTID, LLKAInternal::EXT_DIR_FWD);
+        // The nucleotides are only non-owning slices of the source structure. Atoms are copied
+        // just once when the actual steps are assembled by dinucleotideToSteps().
+        const LLKA_Structure firstNucl = LLKAInternal::residueSliceForward({ stru, idx }, atom.pdbx_PDB_model_num, atom.label_asym_id, atom.label_seq_id, LLKA_NO_ALTID);
         idx += firstNucl.nAtoms;
 
-        if (idx >= stru->nAtoms) {
-            LLKA_destroyStructure(&firstNucl);
+        if (idx >= stru->nAtoms)
             break;
-        }
 
         const auto &atom2 = stru->atoms[idx];
-        if (!LLKAInternal::isSameChain(atom, atom2)) {
-            LLKA_destroyStructure(&firstNucl);
+        if (!LLKAInternal::isSameChain(atom, atom2))
             continue;
-        }
 
-        LLKA_Structure secondNucl = LLKAInternal::extendToResidue({ stru, idx }, atom2.pdbx_PDB_model_num, atom2.label_asym_id, atom2.label_seq_id, LLKA_NO_ALTID, LLKAInternal::EXT_DIR_FWD);
+        const LLKA_Structure secondNucl = LLKAInternal::residueSliceForward({ stru, idx }, atom2.pdbx_PDB_model_num, atom2.label_asym_id, atom2.label_seq_id, LLKA_NO_ALTID);
 
         auto _steps = LLKAInternal::dinucleotideToSteps(firstNucl, secondNucl);
         allSteps.insert(allSteps.end(), _steps.cbegin(), _steps.cend());
-
-        LLKA_destroyStructure(&firstNucl);
-        LLKA_destroyStructure(&secondNucl);
     }
 
     const size_t N = allSteps.size();
@@ -1,6 +1,7 @@
 /* vim: set sw=4 ts=4 sts=4 expandtab : */
 
 #include "structure_util.hpp"
+#include "structure.hpp"
 #include "util/elementaries.h"
 #include "util/geometry.h"
 
@@ -9,10 +10,10 @@
 namespace LLKAInternal {
 
 static
-auto getAtomByName(const LLKA_Structure &stru, const char *name) -> LLKA_Atom *
+auto getAtomByName(const LLKA_StructureView &view, const char *name) -> const LLKA_Atom *
 {
-    for (size_t idx = 0; idx < stru.nAtoms; idx++) {
-        auto atom = &stru.atoms[idx];
+    for (size_t idx = 0; idx < view.nAtoms; idx++) {
+        auto atom = view.atoms[idx];
         if (std::strcmp(atom->auth_atom_id, name) == 0)
             return atom;
     }
@@ -20,10 +21,51 @@ auto getAtomByName(const LLKA_Structure &stru, const char *name) -> LLKA_Atom *
     return nullptr;
 }
 
+static
+auto collectAltIds(const LLKA_Structure &stru)
+{
+    std::vector<char> altIds;
+
+    for (size_t idx = 0; idx < stru.nAtoms; idx++) {
+        const auto altId = stru.atoms[idx].label_alt_id;
+
+        if (altId != LLKA_NO_ALTID && !contains(altIds, altId))
+            altIds.push_back(altId);
+    }
+
+    return altIds;
+}
+
+static
+auto destroyViews(std::vector<LLKA_StructureView> &views)
+{
+    for (auto &v : views)
+        LLKA_destroyStructureView(&v);
+}
+
+static
+auto makeStep(const LLKA_StructureView &first, const LLKA_StructureView &second)
+{
+    const size_t N = first.nAtoms + second.nAtoms;
+    LLKA_Structure step{
+        new LLKA_Atom[N],
+        N
+    };
+
+    for (size_t idx = 0; idx < first.nAtoms; idx++)
+        LLKA_duplicateAtom(first.atoms[idx], &step.atoms[idx]);
+    for (size_t idx = 0; idx < second.nAtoms; idx++)
+        LLKA_duplicateAtom(second.atoms[idx], &step.atoms[first.nAtoms + idx]);
+
+    return step;
+}
+
 auto dinucleotideToSteps(const LLKA_Structure &firstNucl, const LLKA_Structure &secondNucl) -> std::vector<LLKA_Structure>
 {
-    auto [ splittedFirst, altIdsFirst ] = splitByAltIds(firstNucl);
-    auto [ splittedSecond, altIdsSecond ] = splitByAltIds(secondNucl);
+    // Alternate positions are split only as views of the nucleotides.
+    // Atoms are deep-copied just once for each step that passes the checks below.
+    auto [ splittedFirst, altIdsFirst ] = splitByAltIdsView(firstNucl);
+    auto [ splittedSecond, altIdsSecond ] = splitByAltIdsView(secondNucl);
 
     assert(splittedFirst.size() > 0);
     assert(splittedSecond.size() > 0);
@@ -34,32 +76,24 @@ auto dinucleotideToSteps(const LLKA_Structure &firstNucl, const LLKA_Structure &
     if (altIdsFirst.empty() && altIdsSecond.empty()) [[ likely ]] {
         auto atomO3 = getAtomByName(splittedFirst.front(), "O3'");
         auto atomP = getAtomByName(splittedSecond.front(), "P");
-        if (atomO3 == nullptr || atomP == nullptr) [[ unlikely ]] {
-            LLKA_destroyStructure(&splittedFirst[0]);
-            LLKA_destroyStructure(&splittedSecond[0]);
 
-            return {}; // Weird stucture, ignore it
-        }
-
-        // Check that the O3' -> P distance is reasonable
-        auto dist = spatialDistance<double>(atomO3->coords, atomP->coords);
-        if (dist <= MAX_O3_P_DISTANCE_ANGSTROMS) [[ likely ]]
-            steps.emplace_back(mergeStructuresMove<2>({ &splittedFirst[0], &splittedSecond[0] }));
-        else {
-            LLKA_destroyStructure(&splittedFirst[0]);
-            LLKA_destroyStructure(&splittedSecond[0]);
+        // Check that the O3' -> P distance is reasonable, ignore weird structures
+        if (atomO3 != nullptr && atomP != nullptr) [[ likely ]] {
+            auto dist = spatialDistance<double>(atomO3->coords, atomP->coords);
+            if (dist <= MAX_O3_P_DISTANCE_ANGSTROMS) [[ likely ]]
+                steps.emplace_back(makeStep(splittedFirst.front(), splittedSecond.front()));
         }
     } else {
         steps.reserve(splittedFirst.size() * splittedSecond.size());
 
         for (size_t firstIdx = 0; firstIdx < splittedFirst.size(); firstIdx++) {
-            auto &sf = splittedFirst[firstIdx];
+            const auto &sf = splittedFirst[firstIdx];
             auto atomO3 = getAtomByName(sf, "O3'");
             if (atomO3 == nullptr) [[ unlikely ]]
                 continue; // Weird nucleotide, just skip it
 
             for (size_t secondIdx = 0; secondIdx < splittedSecond.size(); secondIdx++) {
-                auto &ss = splittedSecond[secondIdx];
+                const auto &ss = splittedSecond[secondIdx];
 
                 // Check alt-loc compatibility
                 // If both residues have alt-locs, only allow matching alt-loc IDs (e.g., A-A, B-B)
@@ -75,60 +109,67 @@ auto dinucleotideToSteps(const LLKA_Structure &firstNucl, const LLKA_Structure &
 
                 // Check that the O3' -> P distance is reasonable
                 auto dist = spatialDistance<double>(atomO3->coords, atomP->coords);
-                if (dist <= MAX_O3_P_DISTANCE_ANGSTROMS) [[ likely ]] {
-                    // We need to duplicate the second structure because we may need it more than once
-                    LLKA_Structure sfCopy = LLKA_makeStructure(sf.atoms, sf.nAtoms);
-                    LLKA_Structure ssCopy = LLKA_makeStructure(ss.atoms, ss.nAtoms);
-                    steps.emplace_back(mergeStructuresMove<2>({ &sfCopy, &ssCopy }));
-                }
+                if (dist <= MAX_O3_P_DISTANCE_ANGSTROMS) [[ likely ]]
+                    steps.emplace_back(makeStep(sf, ss));
             }
         }
-
-        for (auto &s : splittedFirst)
-            LLKA_destroyStructure(&s);
-        for (auto &s : splittedSecond)
-            LLKA_destroyStructure(&s);
     }
 
+    destroyViews(splittedFirst);
+    destroyViews(splittedSecond);
+
     return steps;
 }
 
 auto splitByAltIds(const LLKA_Structure &stru) -> std::tuple<std::vector<LLKA_Structure>, std::vector<char>>
 {
-    std::vector<char> altIds;
-    std::vector<LLKA_Structure> strus;
+    auto [ views, altIds ] = splitByAltIdsView(stru);
 
-    for (size_t idx = 0; idx < stru.nAtoms; idx++) {
-        const auto altId = stru.atoms[idx].label_alt_id;
+    std::vector<LLKA_Structure> strus(views.size());
+    for (size_t idx = 0; idx < views.size(); idx++)
+        strus[idx] = LLKA_makeStructureFromPtrs(views[idx].atoms, views[idx].nAtoms);
 
-        if (altId != LLKA_NO_ALTID && !contains(altIds, altId))
-            altIds.push_back(altId);
-    }
+    destroyViews(views);
+
+    assert(!strus.empty());
+
+    return { std::move(strus), std::move(altIds) };
+}
+
+auto splitByAltIdsView(const LLKA_Structure &stru) -> std::tuple<std::vector<LLKA_StructureView>, std::vector<char>>
+{
+    auto altIds = collectAltIds(stru);
+    std::vector<LLKA_StructureView> views;
 
     if (altIds.empty()) {
-        strus.resize(1);
-        LLKA_duplicateStructure(&stru, &strus[0]);
+        auto view = makeStructureView(stru.nAtoms);
+        for (size_t idx = 0; idx < stru.nAtoms; idx++)
+            view.atoms[idx] = &stru.atoms[idx];
+        view.nAtoms = stru.nAtoms;
+
+        views.push_back(view);
     } else {
         const auto N = altIds.size();
-        strus.resize(N);
+        views.reserve(N);
 
         for (size_t sdx = 0; sdx < N; sdx++) {
             const auto altId = altIds[sdx];
-            auto &splitStru = strus[sdx];
-            splitStru.nAtoms = 0;
+            auto view = makeStructureView(stru.nAtoms);
 
             for (size_t idx = 0; idx < stru.nAtoms; idx++) {
                 const auto &atom = stru.atoms[idx];
 
                 if (atom.label_alt_id == LLKA_NO_ALTID || atom.label_alt_id == altId)
-                    LLKA_appendAtom(&atom, &splitStru);
+                    view.atoms[view.nAtoms++] = &atom;
             }
+
+            views.push_back(view);
         }
     }
 
-    assert(!strus.empty());
+    assert(!views.empty());
 
-    return { std::move(strus), std::move(altIds) };
+    return { std::move(views), std::move(altIds) };
 }
 
 } // namespace LLKAInternal
@@ -121,6 +121,8 @@ auto mergeStructuresShallow(const std::array<const LLKA_Structure *, NStructures
 
 auto splitByAltIds(const LLKA_Structure &stru) -> std::tuple<std::vector<LLKA_Structure>, std::vector<char>>;
 
+auto splitByAltIdsView(const LLKA_Structure &stru) -> std::tuple<std::vector<LLKA_StructureView>, std::vector<char>>;
+
 } // namespace LLKAInternal
 
 #endif // _LLKA_STRUCTURE_UTIL_H
@@ -12,6 +12,7 @@
 namespace LLKAInternal {
 
 using MappedPointsUnaligned = Eigen::Map<Eigen::Matrix<double, 3, Eigen::Dynamic, Eigen::ColMajor>, Eigen::Unaligned>;
+using ConstMappedPointsUnaligned = Eigen::Map<const Eigen::Matrix<double, 3, Eigen::Dynamic, Eigen::ColMajor>, Eigen::Unaligned>;
 using MappedQuadsUnaligned = Eigen::Map<Eigen::Matrix<double, 4, Eigen::Dynamic, Eigen::ColMajor>, Eigen::Unaligned>;
 using MappedMat4x4Unaligned = Eigen::Map<Eigen::Matrix<double, 4, 4, Eigen::ColMajor>, Eigen::Unaligned>;
 using MappedPoint = Eigen::Map<Eigen::Vector3d>;
@@ -99,6 +100,25 @@ auto superpose(MA &what, const MB &onto, double *_rmsd) -> LLKA_RetCode
     return LLKA_OK;
 }
 
+/*
+ * Calculates RMSD of the optimal superposition of "what" onto "centeredOnto"
+ * without modifying "what". Centroid of "centeredOnto" must already lie at the origin.
+ */
+template <typename MA, typename MB>
+auto superposedRmsdOntoCentered(const MA &what, const MB &centeredOnto, double *_rmsd) -> LLKA_RetCode
+{
+    if (what.cols() != centeredOnto.cols())
+        return LLKA_E_MISMATCHING_SIZES;
+
+    Eigen::Matrix<double, 3, Eigen::Dynamic> cWhat = what;
+    centroidify(cWhat, centroid(what));
+
+    Mat3x3 rot = kabsch(cWhat, centeredOnto);
+    cWhat = rot * cWhat;
+
+    return rmsd(cWhat, centeredOnto, _rmsd);
+}
+
 template <typename MA, typename MB>
 auto superpositionMatrix(const MA &what, const MB &onto, LLKA_Matrix *matrix) -> LLKA_RetCode
 {
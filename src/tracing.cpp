@@ -5,6 +5,7 @@
 #include "tracing/internal/tracer_util.h"
 #include "tracing/llka_tracer_impl.h"
 
+#include <algorithm>
 #include <cstring>
 
 #ifndef LLKA_DISABLE_TRACING
@@ -27,11 +28,20 @@ void LLKA_CC LLKA_destroyTracepointInfo(LLKA_TracepointInfos *infos)
     for (size_t idx = 0; idx < infos->nInfos; idx++) {
         auto &info = infos->infos[idx];
         delete [] info.description;
+        delete [] info.recordLayout;
     }
 
     delete [] infos->infos;
 }
 
+void LLKA_CC LLKA_destroyTraceRecords(LLKA_TraceRecords *records)
+{
+    for (size_t idx = 0; idx < records->nRecords; idx++)
+        delete [] records->records[idx].text;
+
+    delete [] records->records;
+}
+
 void LLKA_CC LLKA_toggleAllTracepoints(LLKA_Bool state)
 {
 	if (state)
@@ -63,6 +73,51 @@ const char * LLKA_CC LLKA_trace(LLKA_Bool dontClear)
 #endif // ECHMET_TRACER_DISABLE_TRACING
 }
 
+LLKA_TraceRecords LLKA_CC LLKA_traceRecords(LLKA_Bool dontClear)
+{
+#ifdef ECHMET_TRACER_DISABLE_TRACING
+    (void)dontClear;
+    return LLKA_TraceRecords{};
+#else
+    static_assert(ECHMET::TraceRecord::MAX_VALUES == LLKA_TRACE_RECORD_MAX_VALUES);
+    static_assert(ECHMET::TraceRecord::MAX_INDICES == LLKA_TRACE_RECORD_MAX_INDICES);
+    static_assert(ECHMET::TraceRecord::LABEL_LENGTH == LLKA_TRACE_RECORD_LABEL_LENGTH);
+
+    const auto records = ECHMET::TRACER_INSTANCE<LLKATracing>().records(dontClear);
+
+    LLKA_TraceRecords cRecords{};
+    if (records.empty())
+        return cRecords;
+
+    cRecords.records = new LLKA_TraceRecord[records.size()];
+    cRecords.nRecords = records.size();
+
+    for (size_t idx = 0; idx < records.size(); idx++) {
+        const auto &rec = records[idx];
+        auto &cRec = cRecords.records[idx];
+
+        cRec.TPID = rec.TPID;
+        cRec.contextId = rec.contextId;
+        cRec.stepIdx = rec.contextTag;
+        cRec.nValues = rec.nValues;
+        std::copy_n(rec.values.begin(), rec.nValues, cRec.values);
+        cRec.nIndices = rec.nIndices;
+        std::copy_n(rec.indices.begin(), rec.nIndices, cRec.indices);
+        std::copy(rec.label.begin(), rec.label.end(), cRec.label);
+
+        if (rec.text.empty())
+            cRec.text = nullptr;
+        else {
+            auto rawText = new char[rec.text.length() + 1];
+            std::strcpy(rawText, rec.text.c_str());
+            cRec.text = rawText;
+        }
+    }
+
+    return cRecords;
+#endif // ECHMET_TRACER_DISABLE_TRACING
+}
+
 LLKA_TracepointInfos LLKA_CC LLKA_tracepointInfo()
 {
 #ifdef ECHMET_TRACER_DISABLE_TRACING
@@ -78,14 +133,17 @@ LLKA_TracepointInfos LLKA_CC LLKA_tracepointInfo()
     infos.nInfos = tracepoints.size();
 
     for (size_t idx = 0; idx < infos.nInfos; idx++) {
-        const auto &[TPID, desc] = tracepoints[idx];
+        const auto &[TPID, desc, layout] = tracepoints[idx];
         auto &info = infos.infos[idx];
 
         auto rawDesc = new char[desc.length() + 1];
         std::strcpy(rawDesc, desc.c_str());
+        auto rawLayout = new char[layout.length() + 1];
+        std::strcpy(rawLayout, layout.c_str());
 
         info.TPID = TPID;
         info.description = rawDesc;
+        info.recordLayout = rawLayout;
     }
 
 	return infos;
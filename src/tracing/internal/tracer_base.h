@@ -2,28 +2,180 @@
 #define _ECHMET_TRACER_BASE_H
 
 #include "tracer_types.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
 #include <functional>
-#include <map>
 #include <memory>
 #include <mutex>
 #include <string>
 #include <type_traits>
+#include <tuple>
 #include <utility>
 #include <vector>
 
 namespace ECHMET {
 
+/*!
+ * Trace buffer of a single thread.
+ *
+ * The buffer is a chain of fixed-size blocks. Only the owning thread appends records
+ * and only the collecting thread reads and frees them. Neither side ever waits for the other.
+ */
+class ThreadTraceBuffer
+{
+	static constexpr size_t BLOCK_SIZE = 256;
+
+	class Block {
+	public:
+		std::array<TraceRecord, BLOCK_SIZE> records{};
+		std::atomic<size_t> written{0};
+		std::atomic<Block *> next{nullptr};
+	};
+
+public:
+	ThreadTraceBuffer() :
+		m_head{new Block{}},
+		m_headRead{0},
+		m_tail{m_head},
+		m_tailWritten{0},
+		m_ownerExited{false}
+	{
+	}
+
+	ThreadTraceBuffer(const ThreadTraceBuffer &) = delete;
+
+	~ThreadTraceBuffer()
+	{
+		Block *blk = m_head;
+		while (blk != nullptr) {
+			Block *next = blk->next.load(std::memory_order_relaxed);
+			delete blk;
+			blk = next;
+		}
+	}
+
+	ThreadTraceBuffer & operator=(const ThreadTraceBuffer &) = delete;
+
+	/*
+	 * Returns the next free record. The record is filled in place and becomes visible
+	 * to the collector once publish() is called. Must be called only by the owning thread.
+	 */
+	TraceRecord & acquire()
+	{
+		if (m_tailWritten == BLOCK_SIZE) {
+			Block *blk = new Block{};
+			m_tail->next.store(blk, std::memory_order_release);
+			m_tail = blk;
+			m_tailWritten = 0;
+		}
+
+		return m_tail->records[m_tailWritten];
+	}
+
+	/* Must be called only by the owning thread */
+	void publish()
+	{
+		m_tail->written.store(++m_tailWritten, std::memory_order_release);
+	}
+
+	/* Must not be called concurrently with another collect() */
+	void collect(std::vector<TraceRecord> &records, const bool keep)
+	{
+		Block *blk = m_head;
+		size_t idx = m_headRead;
+
+		for (;;) {
+			const size_t written = blk->written.load(std::memory_order_acquire);
+			for (; idx < written; idx++) {
+				if (keep)
+					records.push_back(blk->records[idx]);
+				else
+					records.push_back(std::move(blk->records[idx]));
+			}
+
+			if (idx < BLOCK_SIZE)
+				break;
+
+			/* The owning thread never returns to a block once it has moved on to the next one */
+			Block *next = blk->next.load(std::memory_order_acquire);
+			if (next == nullptr)
+				break;
+
+			if (!keep)
+				delete blk;
+			blk = next;
+			idx = 0;
+		}
+
+		if (!keep) {
+			m_head = blk;
+			m_headRead = idx;
+		}
+	}
+
+	bool isDrained() const
+	{
+		return m_head->next.load(std::memory_order_acquire) == nullptr &&
+		       m_headRead == m_head->written.load(std::memory_order_acquire);
+	}
+
+	bool ownerExited() const
+	{
+		return m_ownerExited.load(std::memory_order_acquire);
+	}
+
+	void setOwnerExited()
+	{
+		m_ownerExited.store(true, std::memory_order_release);
+	}
+
+private:
+	Block *m_head;			/* Collecting side */
+	size_t m_headRead;		/* Collecting side */
+	Block *m_tail;			/* Owning thread side */
+	size_t m_tailWritten;		/* Owning thread side */
+	std::atomic<bool> m_ownerExited;
+};
+
+class TraceContextState {
+public:
+	uint64_t id{0};
+	uint64_t tag{0};
+};
+
 template <typename TracepointIDs>
 class Tracer
 {
 	static_assert(std::is_enum<TracepointIDs>::value, "TracepointIDs is not an enum");
 	static_assert(sizeof(typename std::underlying_type<TracepointIDs>::type) <= sizeof(TPIDInt), "Cannot represent all tracepoints as int32_t");
 
+	static constexpr size_t MAX_TRACEPOINTS = 256;
+
+	/* Registers the buffer of a thread with the tracer on the first use and releases it on thread exit */
+	class LocalBuffer {
+	public:
+		LocalBuffer(Tracer &tracer) :
+			buffer{std::make_shared<ThreadTraceBuffer>()}
+		{
+			std::lock_guard<std::mutex> lk(tracer.m_buffersLock);
+			tracer.m_buffers.push_back(buffer);
+		}
+
+		~LocalBuffer()
+		{
+			buffer->setOwnerExited();
+		}
+
+		const std::shared_ptr<ThreadTraceBuffer> buffer;
+	};
+
 public:
 	void disableAllTracepoints()
 	{
 #ifndef ECHMET_TRACER_DISABLE_TRACING
-		TOGGLE_ALL_TRACEPOINTS<TracepointIDs, FIRST_TRACEPOINT_ID<TracepointIDs>()>(false, m_enabledTracepoints);
+		toggleAllTracepoints(false);
 #endif // ECHMET_TRACER_DISABLE_TRACING
 	}
 
@@ -34,8 +186,8 @@ public:
 		if (!IS_TPID_VALID<RTPID, TracepointIDs>(tpid))
 			return;
 
-		const TracepointIDs _tpid  = static_cast<TracepointIDs>(tpid);
-		m_enabledTracepoints[_tpid] = false;
+		const size_t idx = tracepointIndex(tpid);
+		m_enabledTracepoints[idx / 64].fetch_and(~(uint64_t(1) << (idx % 64)), std::memory_order_relaxed);
 #else
 		(void)tpid;
 		return;
@@ -45,7 +197,7 @@ public:
 	void enableAllTracepoints()
 	{
 #ifndef ECHMET_TRACER_DISABLE_TRACING
-		TOGGLE_ALL_TRACEPOINTS<TracepointIDs, FIRST_TRACEPOINT_ID<TracepointIDs>()>(true, m_enabledTracepoints);
+		toggleAllTracepoints(true);
 #endif // ECHMET_TRACER_DISABLE_TRACING
 	}
 
@@ -56,8 +208,8 @@ public:
 		if (!IS_TPID_VALID<RTPID, TracepointIDs>(tpid))
 			return;
 
-		const TracepointIDs _tpid  = static_cast<TracepointIDs>(tpid);
-		m_enabledTracepoints[_tpid] = true;
+		const size_t idx = tracepointIndex(tpid);
+		m_enabledTracepoints[idx / 64].fetch_or(uint64_t(1) << (idx % 64), std::memory_order_relaxed);
 #else
 		(void)tpid;
 		return;
@@ -71,64 +223,213 @@ public:
 		if (!IS_TPID_VALID<RTPID, TracepointIDs>(tpid))
 			return false;
 
-		const TracepointIDs _tpid = static_cast<TracepointIDs>(tpid);
-		auto item = m_enabledTracepoints.find(_tpid);
-		if (item == m_enabledTracepoints.end())
-			return false;
-
-		return item->second;
+		const size_t idx = tracepointIndex(tpid);
+		return (m_enabledTracepoints[idx / 64].load(std::memory_order_relaxed) >> (idx % 64)) & 1;
 #else
 		(void)tpid;
 		return false;
 #endif // ECHMET_TRACER_DISABLE_TRACING
 	}
 
-	void log(const std::string &text)
+	/*!
+	 * Starts a new trace context on the calling thread.
+	 * Records logged within a context are kept together in the merged trace.
+	 *
+	 * @param tag User-defined tag stored in all records logged within the context
+	 *
+	 * @return The previous context of the thread. Pass it to endContext().
+	 */
+	TraceContextState beginContext(const uint64_t tag)
+	{
+		const TraceContextState previous = s_currentContext;
+		s_currentContext = { m_sequence.fetch_add(1, std::memory_order_relaxed) + 1, tag };
+
+		return previous;
+	}
+
+	void endContext(const TraceContextState &previous)
+	{
+		s_currentContext = previous;
+	}
+
+	/*!
+	 * Returns a record for the given tracepoint to be filled in by its logger.
+	 * Every call must be followed by a call of endRecord() on the same thread.
+	 */
+	TraceRecord & beginRecord(const TracepointIDs tpid)
 	{
-		std::lock_guard<std::mutex> lk(m_logLock);
+		auto &record = localBuffer().acquire();
+		record.TPID = static_cast<TPIDInt>(tpid);
+		record.sequence = m_sequence.fetch_add(1, std::memory_order_relaxed) + 1;
+		record.contextId = s_currentContext.id;
+		record.contextTag = s_currentContext.tag;
 
-		m_log.append(text + "\n");
+		return record;
+	}
+
+	void endRecord()
+	{
+		localBuffer().publish();
 	}
 
+	/*!
+	 * Formats all records as text.
+	 */
 	std::string logged(const bool dontFlush = false)
 	{
-		std::lock_guard<std::mutex> lk(m_logLock);
+		std::vector<TracepointFormatter> formatters{};
+		TRACEPOINT_FORMATTERS_BUILD<TracepointIDs, FIRST_TRACEPOINT_ID<TracepointIDs>()>(formatters);
+
+		std::string log{};
+		for (const auto &rec : records(dontFlush)) {
+			const size_t idx = static_cast<size_t>(rec.TPID) - static_cast<size_t>(FIRST_TRACEPOINT_ID<TracepointIDs>());
+			if (idx < formatters.size())
+				log.append(formatters[idx](rec)).append("\n");
+		}
 
-		if (dontFlush)
-			return m_log;
-		else {
-			const std::string log{m_log};
-			m_log.clear();
+		return log;
+	}
 
-			return log;
+	/*!
+	 * Merges the records from all threads. Records of the same context are grouped together
+	 * and placed where the context began. Everything else is ordered as it was logged.
+	 */
+	std::vector<TraceRecord> records(const bool dontFlush = false)
+	{
+		std::vector<TraceRecord> records{};
+
+		{
+			std::lock_guard<std::mutex> lk(m_buffersLock);
+
+			for (auto &buffer : m_buffers)
+				buffer->collect(records, dontFlush);
+
+			if (!dontFlush) {
+				m_buffers.erase(
+					std::remove_if(
+						m_buffers.begin(), m_buffers.end(),
+						[](const auto &buffer) { return buffer->ownerExited() && buffer->isDrained(); }
+					),
+					m_buffers.end()
+				);
+			}
 		}
+
+		std::sort(
+			records.begin(), records.end(),
+			[](const TraceRecord &lhs, const TraceRecord &rhs) {
+				const uint64_t lhsKey = lhs.contextId != 0 ? lhs.contextId : lhs.sequence;
+				const uint64_t rhsKey = rhs.contextId != 0 ? rhs.contextId : rhs.sequence;
+
+				return lhsKey != rhsKey ? lhsKey < rhsKey : lhs.sequence < rhs.sequence;
+			}
+		);
+
+		return records;
+	}
+
+	/*!
+	 * Returns the number of thread buffers held by the tracer. Buffers of exited threads
+	 * are released by the first records() call that drains them.
+	 */
+	size_t threadBufferCount()
+	{
+		std::lock_guard<std::mutex> lk(m_buffersLock);
+
+		return m_buffers.size();
 	}
 
-	std::vector<std::tuple<TPIDInt, std::string>> tracepoints() const
+	std::vector<std::tuple<TPIDInt, std::string, std::string>> tracepoints() const
 	{
-		std::vector<std::tuple<TPIDInt, std::string>> tpVec{};
+		std::vector<std::tuple<TPIDInt, std::string, std::string>> tpVec{};
 
 		TRACEPOINT_INFO_BUILD<TracepointIDs, FIRST_TRACEPOINT_ID<TracepointIDs>()>(tpVec);
 		return tpVec;
 	}
 
 private:
-	std::map<TracepointIDs, bool> m_enabledTracepoints;
-	std::string m_log;
-	std::mutex m_logLock;
+	ThreadTraceBuffer & localBuffer()
+	{
+		static thread_local LocalBuffer local{*this};
+
+		return *local.buffer;
+	}
+
+#ifndef ECHMET_TRACER_DISABLE_TRACING
+	template <typename RTPID>
+	static size_t tracepointIndex(const RTPID &tpid)
+	{
+		return static_cast<size_t>(TUTYPE_CAST(static_cast<TracepointIDs>(tpid)) - TUTYPE_CAST(FIRST_TRACEPOINT_ID<TracepointIDs>()));
+	}
+
+	void toggleAllTracepoints(const bool state)
+	{
+		constexpr size_t N = static_cast<size_t>(TUTYPE_CAST(LAST_TRACEPOINT_ID<TracepointIDs>()) - TUTYPE_CAST(FIRST_TRACEPOINT_ID<TracepointIDs>()));
+		static_assert(N <= MAX_TRACEPOINTS, "Too many tracepoints");
+
+		for (size_t word = 0; word < m_enabledTracepoints.size(); word++) {
+			uint64_t mask = 0;
+			if (state) {
+				const size_t first = word * 64;
+				const size_t bits = N > first ? std::min<size_t>(N - first, 64) : 0;
+				mask = bits == 64 ? ~uint64_t(0) : (uint64_t(1) << bits) - 1;
+			}
+			m_enabledTracepoints[word].store(mask, std::memory_order_relaxed);
+		}
+	}
+#endif // ECHMET_TRACER_DISABLE_TRACING
+
+	std::array<std::atomic<uint64_t>, MAX_TRACEPOINTS / 64> m_enabledTracepoints{};
+	std::atomic<uint64_t> m_sequence{0};
+	std::vector<std::shared_ptr<ThreadTraceBuffer>> m_buffers;
+	std::mutex m_buffersLock;
+
+	static inline thread_local TraceContextState s_currentContext{};
+};
+
+/*!
+ * Keeps all records logged by the current thread within its scope in one trace context.
+ */
+template <typename TracepointIDs>
+class TraceContext
+{
+public:
+	TraceContext(const uint64_t tag = 0);
+	TraceContext(const TraceContext &) = delete;
+	~TraceContext();
+
+	TraceContext & operator=(const TraceContext &) = delete;
+
+private:
+	TraceContextState m_previous;
 };
 
 template <typename TracepointIDs>
 Tracer<TracepointIDs> & TRACER_INSTANCE();
 
+template <typename TracepointIDs>
+TraceContext<TracepointIDs>::TraceContext(const uint64_t tag) :
+	m_previous{TRACER_INSTANCE<TracepointIDs>().beginContext(tag)}
+{
+}
+
+template <typename TracepointIDs>
+TraceContext<TracepointIDs>::~TraceContext()
+{
+	TRACER_INSTANCE<TracepointIDs>().endContext(m_previous);
+}
+
 #ifndef ECHMET_TRACER_DISABLE_TRACING
 template <typename TracepointIDs, TracepointIDs TPID, typename... Args>
 inline
 void _ECHMET_TRACE(Args&& ...args)
 {
 	auto &tracer = TRACER_INSTANCE<TracepointIDs>();
-	if (tracer.isTracepointEnabled(TPID))
-		tracer.log(TracepointLogger<TracepointIDs, TPID>::call(std::forward<Args>(args)...));
+	if (tracer.isTracepointEnabled(TPID)) {
+		auto &record = tracer.beginRecord(TPID);
+		TracepointLogger<TracepointIDs, TPID>::call(record, std::forward<Args>(args)...);
+		tracer.endRecord();
+	}
 	/* Do nothing */
 }
 
@@ -139,8 +440,11 @@ inline
 void _ECHMET_TRACE_T1(Args&& ...args)
 {
 	auto &tracer = TRACER_INSTANCE<TracepointIDs>();
-	if (tracer.isTracepointEnabled(TPID))
-		tracer.log(TracepointLogger<TracepointIDs, TPID, T1>::call(std::forward<Args>(args)...));
+	if (tracer.isTracepointEnabled(TPID)) {
+		auto &record = tracer.beginRecord(TPID);
+		TracepointLogger<TracepointIDs, TPID, T1>::call(record, std::forward<Args>(args)...);
+		tracer.endRecord();
+	}
 	/* Do nothing */
 }
 
@@ -151,8 +455,11 @@ inline
 void _ECHMET_TRACE_T2(Args&& ...args)
 {
 	auto &tracer = TRACER_INSTANCE<TracepointIDs>();
-	if (tracer.isTracepointEnabled(TPID))
-		tracer.log(TracepointLogger<TracepointIDs, TPID, T1, T2>::call(std::forward<Args>(args)...));
+	if (tracer.isTracepointEnabled(TPID)) {
+		auto &record = tracer.beginRecord(TPID);
+		TracepointLogger<TracepointIDs, TPID, T1, T2>::call(record, std::forward<Args>(args)...);
+		tracer.endRecord();
+	}
 	/* Do nothing */
 }
 
@@ -163,8 +470,11 @@ inline
 void _ECHMET_TRACE_T3(Args&& ...args)
 {
 	auto &tracer = TRACER_INSTANCE<TracepointIDs>();
-	if (tracer.isTracepointEnabled(TPID))
-		tracer.log(TracepointLogger<TracepointIDs, TPID, T1, T2, T3>::call(std::forward<Args>(args)...));
+	if (tracer.isTracepointEnabled(TPID)) {
+		auto &record = tracer.beginRecord(TPID);
+		TracepointLogger<TracepointIDs, TPID, T1, T2, T3>::call(record, std::forward<Args>(args)...);
+		tracer.endRecord();
+	}
 	/* Do nothing */
 }
 
@@ -175,8 +485,11 @@ inline
 void _ECHMET_TRACE_T4(Args&& ...args)
 {
 	auto &tracer = TRACER_INSTANCE<TracepointIDs>();
-	if (tracer.isTracepointEnabled(TPID))
-		tracer.log(TracepointLogger<TracepointIDs, TPID, T1, T2, T3, T4>::call(std::forward<Args>(args)...));
+	if (tracer.isTracepointEnabled(TPID)) {
+		auto &record = tracer.beginRecord(TPID);
+		TracepointLogger<TracepointIDs, TPID, T1, T2, T3, T4>::call(record, std::forward<Args>(args)...);
+		tracer.endRecord();
+	}
 	/* Do nothing */
 }
 
@@ -187,8 +500,11 @@ inline
 void _ECHMET_TRACE_T5(Args&& ...args)
 {
 	auto &tracer = TRACER_INSTANCE<TracepointIDs>();
-	if (tracer.isTracepointEnabled(TPID))
-		tracer.log(TracepointLogger<TracepointIDs, TPID, T1, T2, T3, T4, T5>::call(std::forward<Args>(args)...));
+	if (tracer.isTracepointEnabled(TPID)) {
+		auto &record = tracer.beginRecord(TPID);
+		TracepointLogger<TracepointIDs, TPID, T1, T2, T3, T4, T5>::call(record, std::forward<Args>(args)...);
+		tracer.endRecord();
+	}
 	/* Do nothing */
 }
 
@@ -1,7 +1,11 @@
 #ifndef _ECHMET_TRACER_TYPES_H
 #define _ECHMET_TRACER_TYPES_H
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <string>
+#include <type_traits>
 
 namespace ECHMET {
 
@@ -23,6 +27,52 @@ class Tracepoint
 public:
 	const TracepointIDs ID;
 	const std::string description;
+	const std::string recordLayout;	/*!< Meaning of the values, indices and label in the records of the tracepoint */
+};
+
+/*!
+ * Binary record of a single hit of a tracepoint.
+ * Loggers only copy the raw data into the record, the record is turned into text
+ * only when the trace is retrieved.
+ */
+class TraceRecord
+{
+public:
+	static constexpr size_t MAX_VALUES = 36;
+	static constexpr size_t MAX_INDICES = 4;
+	static constexpr size_t LABEL_LENGTH = 32;
+
+	void addIndex(const int64_t index)
+	{
+		if (nIndices < MAX_INDICES)
+			indices[nIndices++] = index;
+	}
+
+	void addValue(const double value)
+	{
+		if (nValues < MAX_VALUES)
+			values[nValues++] = value;
+	}
+
+	/* Label is truncated if it is too long */
+	void setLabel(const char *str)
+	{
+		size_t idx = 0;
+		for (; idx < LABEL_LENGTH - 1 && str[idx] != '\0'; idx++)
+			label[idx] = str[idx];
+		label[idx] = '\0';
+	}
+
+	TPIDInt TPID{};
+	uint64_t sequence{};	/*!< Global order in which the records were logged */
+	uint64_t contextId{};	/*!< ID of the trace context the record was logged in. Zero if the record was not logged in any context */
+	uint64_t contextTag{};	/*!< User-defined tag of the trace context, e.g. index of the step */
+	uint32_t nValues{};
+	uint32_t nIndices{};
+	std::array<double, MAX_VALUES> values;
+	std::array<int64_t, MAX_INDICES> indices;
+	std::array<char, LABEL_LENGTH> label{};
+	std::string text{};	/*!< Free-form text for data that cannot be recorded as values */
 };
 
 } // namespace ECHMET
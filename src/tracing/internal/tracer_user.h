@@ -41,6 +41,17 @@
 #define ECHMET_TRACE_T5(TracerClass, TPID, T1, T2, T3, T4, T5, ...) \
 	::ECHMET::_ECHMET_TRACE_T5<TracerClass, TracerClass::TPID, T1, T2, T3, T4, T5>(__VA_ARGS__)
 
+/*!
+ * \def ECHMET_TRACE_CONTEXT(TracerClass, tag)
+ * Keeps all records logged by the current thread until the end of the enclosing scope
+ * together in the merged trace
+ *
+ * @param TracerClass Tracer class
+ * @param tag User-defined tag stored in all records logged within the context
+ */
+#define ECHMET_TRACE_CONTEXT(TracerClass, tag) \
+	::ECHMET::TraceContext<TracerClass> __echmet_trace_context__{tag}
+
 /*!
  * \def ECHMET_TRACER_LOG(TracerClass)
  * Returns the complete log from a given \TracerClass
@@ -50,6 +61,15 @@
 #define ECHMET_TRACER_LOG(TracerClass) \
 	TRACER_INSTANCE<TracerClass>().logged()
 
+/*!
+ * \def ECHMET_TRACER_RECORDS(TracerClass)
+ * Returns all binary records from a given \TracerClass
+ *
+ * @param TracerClass Tracer class
+ */
+#define ECHMET_TRACER_RECORDS(TracerClass) \
+	TRACER_INSTANCE<TracerClass>().records()
+
 #else
 
 inline constinit std::string __empty_trace_string{};
@@ -62,7 +82,9 @@ inline constinit std::string __empty_trace_string{};
 #define ECHMET_TRACE_T3(TraceClass, TPID, ...)
 #define ECHMET_TRACE_T4(TraceClass, TPID, ...)
 #define ECHMET_TRACE_T5(TraceClass, TPID, ...)
+#define ECHMET_TRACE_CONTEXT(TracerClass, tag)
 #define ECHMET_TRACER_LOG(TracerClass) std::string{}
+#define ECHMET_TRACER_RECORDS(TracerClass) std::vector<::ECHMET::TraceRecord>{}
 
 #endif // ECHMET_TRACER_DISABLE_TRACING
 
@@ -2,7 +2,6 @@
 #define _ECHMET_TRACER_UTIL_H
 
 #include "tracer_types.h"
-#include <map>
 #include <tuple>
 #include <vector>
 
@@ -18,6 +17,19 @@ namespace ECHMET {
 template <typename TracerClass, TracerClass TPID>
 Tracepoint<TracerClass> TRACEPOINT_INFO();
 
+/*!
+ * Formats a binary record of a tracepoint as human-readable text
+ *
+ * @tparam TracerClass Tracer class
+ * @tparam TPID ID of the tracepoint that logged the record
+ * @param record Record to format
+ * @return Formatted record
+ */
+template <typename TracerClass, TracerClass TPID>
+std::string TRACEPOINT_FORMAT(const TraceRecord &record);
+
+typedef std::string (*TracepointFormatter)(const TraceRecord &);
+
 /*!
  * Returns ID of the first tracepoint for a given tracer
  *
@@ -82,11 +94,11 @@ bool IS_TPID_VALID(const RTPID &tpid)
  */
 template <typename TracerClass, TracerClass TPID>
 inline
-void TRACEPOINT_INFO_BUILD(std::vector<std::tuple<TPIDInt, std::string>> &tracepointInfoVec)
+void TRACEPOINT_INFO_BUILD(std::vector<std::tuple<TPIDInt, std::string, std::string>> &tracepointInfoVec)
 {
 #ifndef ECHMET_TRACER_DISABLE_TRACING
 	const auto tpinfo = TRACEPOINT_INFO<TracerClass, TPID>();
-	tracepointInfoVec.emplace_back(static_cast<TPIDInt>(tpinfo.ID), tpinfo.description);
+	tracepointInfoVec.emplace_back(static_cast<TPIDInt>(tpinfo.ID), tpinfo.description, tpinfo.recordLayout);
 	TRACEPOINT_INFO_BUILD<TracerClass, NEXT_TRACEPOINT_ID<TracerClass, TPID>()>(tracepointInfoVec);
 #else
 	(void)tracepointInfoVec;
@@ -94,17 +106,24 @@ void TRACEPOINT_INFO_BUILD(std::vector<std::tuple<TPIDInt, std::string>> &tracep
 #endif // TRACER_DISABLE_TRACING
 }
 
+/*!
+ * Builds a table of formatting functions of all tracepoints of
+ * a given tracer. The table is indexed by the tracepoint ID.
+ *
+ * @tparam TracerClass Tracer class
+ * @tparam TPID ID of the tracepoint whose formatter is being added
+ */
 template <typename TracerClass, TracerClass TPID>
 inline
-void TOGGLE_ALL_TRACEPOINTS(const bool state, std::map<TracerClass, bool> &enabledTracepoints)
+void TRACEPOINT_FORMATTERS_BUILD(std::vector<TracepointFormatter> &formatters)
 {
 #ifndef ECHMET_TRACER_DISABLE_TRACING
-	enabledTracepoints[TPID] = state;
-	TOGGLE_ALL_TRACEPOINTS<TracerClass, NEXT_TRACEPOINT_ID<TracerClass, TPID>()>(state, enabledTracepoints);
+	formatters.push_back(&TRACEPOINT_FORMAT<TracerClass, TPID>);
+	TRACEPOINT_FORMATTERS_BUILD<TracerClass, NEXT_TRACEPOINT_ID<TracerClass, TPID>()>(formatters);
 #else
-	(void)enabledTracepoints;
+	(void)formatters;
 	return;
-#endif // ECHMET_TRACER_DISABLE_TRACING
+#endif // TRACER_DISABLE_TRACING
 }
 
 /*!
@@ -120,34 +139,50 @@ class TracepointLogger;
 } // namespace ECHMET
 
 /*!
- * \def ECHMET_MAKE_TRACEPOINT(TracerClass, TPID, description)
+ * \def ECHMET_MAKE_TRACEPOINT(TracerClass, TPID, description, recordLayout)
  * Defines functions necessary to query information about tracepoints for the given \TracerClass
  *
  * @param TracerClass Tracer class
  * @param TPID ID of the tracepoint
  * @param description Human-readable description of the tracepoint
+ * @param recordLayout Human-readable description of the data in the records of the tracepoint
  */
-#define ECHMET_MAKE_TRACEPOINT(TracerClass, TPID, description) \
+#define ECHMET_MAKE_TRACEPOINT(TracerClass, TPID, description, recordLayout) \
 	template <> \
 	inline \
-	Tracepoint<TracerClass> TRACEPOINT_INFO<TracerClass, TracerClass::TPID>() { return Tracepoint<TracerClass>{TracerClass::TPID, description}; }
+	Tracepoint<TracerClass> TRACEPOINT_INFO<TracerClass, TracerClass::TPID>() { return Tracepoint<TracerClass>{TracerClass::TPID, description, recordLayout}; }
 
 /*!
- * \def ECHMET_MAKE_TRACEPOINT_NOINLINE(TracerClass, TPID, description)
+ * \def ECHMET_MAKE_TRACEPOINT_NOINLINE(TracerClass, TPID, description, recordLayout)
  * Defines functions necessary to query information about tracepoints for the given \TracerClass
  * Use this one to define tracepoints in auxiliary compilation units to prevent linking issues.
  *
  * @param TracerClass Tracer class
  * @param TPID ID of the tracepoint
  * @param description Human-readable description of the tracepoint
+ * @param recordLayout Human-readable description of the data in the records of the tracepoint
+ */
+#define ECHMET_MAKE_TRACEPOINT_NOINLINE(TracerClass, TPID, description, recordLayout) \
+	template <> \
+	Tracepoint<TracerClass> TRACEPOINT_INFO<TracerClass, TracerClass::TPID>() { return Tracepoint<TracerClass>{TracerClass::TPID, description, recordLayout}; }
+
+/*!
+ * \def ECHMET_MAKE_FORMATTER_NOINLINE(TracerClass, TPID, record)
+ * Defines the function that formats records of the tracepoint. The definition
+ * of the function body must follow the macro.
+ *
+ * @param TracerClass Tracer class
+ * @param TPID ID of the tracepoint
+ * @param record Name of the formatted record
  */
-#define ECHMET_MAKE_TRACEPOINT_NOINLINE(TracerClass, TPID, description) \
+#define ECHMET_MAKE_FORMATTER_NOINLINE(TracerClass, TPID, record) \
 	template <> \
-	Tracepoint<TracerClass> TRACEPOINT_INFO<TracerClass, TracerClass::TPID>() { return Tracepoint<TracerClass>{TracerClass::TPID, description}; }
+	std::string TRACEPOINT_FORMAT<::TracerClass, ::TracerClass::TPID>(const TraceRecord &record)
 
 /*!
  * \def ECHMET_MAKE_LOGGER(TracerClass, TPID, Args...)
  * Defines logging functor for a given tracer and its tracepoint
+ * The functor copies the data into the passed TraceRecord named "record".
  *
  * @param TracerClass Tracer class
  * @param TPID ID of the tracepoint whose logging function is being declared
@@ -157,50 +192,50 @@ class TracepointLogger;
 	template <> \
 	class TracepointLogger<::TracerClass, ::TracerClass::TPID> { \
 	public: \
-		static std::string call(__VA_ARGS__)
+		static void call(::ECHMET::TraceRecord &record, __VA_ARGS__)
 
 #define ECHMET_BEGIN_MAKE_LOGGER_NOARGS(TracerClass, TPID) \
 	template <> \
 	class TracepointLogger<::TracerClass, ::TracerClass::TPID> { \
 	public: \
-		static std::string call()
+		static void call(::ECHMET::TraceRecord &record)
 
 #define ECHMET_BEGIN_MAKE_LOGGER_T1(TracerClass, TPID, ...) \
 	template <typename T1> \
 	class TracepointLogger<::TracerClass, ::TracerClass::TPID, T1> { \
 	public: \
-		static std::string call(__VA_ARGS__)
+		static void call(::ECHMET::TraceRecord &record, __VA_ARGS__)
 
 #define ECHMET_BEGIN_MAKE_LOGGER_T2(TracerClass, TPID, ...) \
 	template <typename T1, typename T2> \
 	class TracepointLogger<::TracerClass, ::TracerClass::TPID, T1, T2> { \
 	public: \
-		static std::string call(__VA_ARGS__)
+		static void call(::ECHMET::TraceRecord &record, __VA_ARGS__)
 
 #define ECHMET_BEGIN_MAKE_LOGGER_T3(TracerClass, TPID, ...) \
 	template <typename T1, typename T2, typename T3> \
 	class TracepointLogger<::TracerClass, ::TracerClass::TPID, T1, T2, T3> { \
 	public: \
-		static std::string call(__VA_ARGS__)
+		static void call(::ECHMET::TraceRecord &record, __VA_ARGS__)
 
 #define ECHMET_BEGIN_MAKE_LOGGER_T4(TracerClass, TPID, ...) \
 	template <typename T1, typename T2, typename T3, typename T4> \
 	class TracepointLogger<::TracerClass, ::TracerClass::TPID, T1, T2, T3, T4> { \
 	public: \
-		static std::string call(__VA_ARGS__)
+		static void call(::ECHMET::TraceRecord &record, __VA_ARGS__)
 
 #define ECHMET_BEGIN_MAKE_LOGGER_T5(TracerClass, TPID, ...) \
 	template <typename T1, typename T2, typename T3, typename T4, typename T5> \
 	class TracepointLogger<::TracerClass, ::TracerClass::TPID, T1, T2, T3, T4, T5> { \
 	public: \
-		static std::string call(__VA_ARGS__)
+		static void call(::ECHMET::TraceRecord &record, __VA_ARGS__)
 
 /* Five template parameters ought to be enough for everyone! */
 
 #define ECHMET_END_MAKE_LOGGER };
 
 #define ECHMET_LOGGER_ADD_OVERLOAD(...) \
-	static std::string call(__VA_ARGS__)
+	static void call(::ECHMET::TraceRecord &record, __VA_ARGS__)
 
 #ifndef _ECHMET_TRACER_IMPL_SECTION
 	#ifndef ECHMET_TRACER_DISABLE_TRACING
@@ -222,16 +257,17 @@ class TracepointLogger;
 			constexpr ::TracerClass LAST_TRACEPOINT_ID<::TracerClass>() { return ::TracerClass::last; } \
 			template <> \
 			inline \
-			void TRACEPOINT_INFO_BUILD<::TracerClass, ::TracerClass::last>(std::vector<std::tuple<TPIDInt, std::string>> &tracepointInfoVec) \
+			void TRACEPOINT_INFO_BUILD<::TracerClass, ::TracerClass::last>(std::vector<std::tuple<TPIDInt, std::string, std::string>> &tracepointInfoVec) \
 			{ \
 				(void)tracepointInfoVec; \
 				return; /* No-op for the last dummy tracepoint */ \
 			} \
 			template <> \
 			inline \
-			void TOGGLE_ALL_TRACEPOINTS<::TracerClass, ::TracerClass::last>(const bool state, std::map<TracerClass, bool> &enabledTracepoints) \
+			void TRACEPOINT_FORMATTERS_BUILD<::TracerClass, ::TracerClass::last>(std::vector<TracepointFormatter> &formatters) \
 			{ \
-				enabledTracepoints[TracerClass::last] = state; \
+				(void)formatters; \
+				return; /* No-op for the last dummy tracepoint */ \
 			} \
 			template <> \
 			inline \
@@ -244,13 +280,13 @@ class TracepointLogger;
 		constexpr __DUMMY_TRACER_CLASS FIRST_TRACEPOINT_ID<__DUMMY_TRACER_CLASS>() { return __DUMMY_TRACER_CLASS::NONE; }
 		template <>
 		inline
-		void TRACEPOINT_INFO_BUILD<__DUMMY_TRACER_CLASS, __DUMMY_TRACER_CLASS::NONE>(std::vector<std::tuple<TPIDInt, std::string>> &)
+		void TRACEPOINT_INFO_BUILD<__DUMMY_TRACER_CLASS, __DUMMY_TRACER_CLASS::NONE>(std::vector<std::tuple<TPIDInt, std::string, std::string>> &)
 		{
 			return;
 		}
 		template <>
 		inline
-		void TOGGLE_ALL_TRACEPOINTS<__DUMMY_TRACER_CLASS, __DUMMY_TRACER_CLASS::NONE>(const bool, std::map<__DUMMY_TRACER_CLASS, bool> &)
+		void TRACEPOINT_FORMATTERS_BUILD<__DUMMY_TRACER_CLASS, __DUMMY_TRACER_CLASS::NONE>(std::vector<TracepointFormatter> &)
 		{
 			return;
 		}
@@ -6,14 +6,17 @@
 #include <llka_main.h>
 
 #include "elementaries.h"
+#include "mapped_file.hpp"
 #include "templates.hpp"
 #include "../fast_float/fast_float.h"
 
 #include <array>
+#include <charconv>
 #include <filesystem>
-#include <fstream>
-#include <sstream>
-#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
 
 /*
   vvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvv
@@ -25,77 +28,80 @@
 
 namespace LLKAInternal::Csv {
 
-class TokenParseError : public std::runtime_error {
-public:
-    TokenParseError(const std::string &tag) : std::runtime_error{"Cannot parse token " + tag}
-    {
-    }
-};
-
-inline
-auto tagStr(const std::string &tag) -> const std::string & { return tag; }
-
-inline
-auto tagStr(size_t tag) { return std::to_string(tag); }
-
+/*
+ * Converts a field to a value. Fields are views into the parsed text and
+ * are not NULL-terminated. Converters return false if the field is not a valid value.
+ */
 template <typename T>
 struct Convert {
-    template <typename Tag>
-    static auto call(const std::string &s, const Tag &) { return s; }
+    static auto call(const std::string_view &s, T &v) -> bool
+    {
+        v = T{s};
+        return true;
+    }
 };
 
 template <>
 struct Convert<const char *> {
-    template <typename Tag>
-    static auto call(const std::string &s, const Tag &)
+    static auto call(const std::string_view &s, const char * &v) -> bool
     {
-        return duplicateString(s);
+        v = duplicateString(s.data(), s.size());
+        return true;
     }
 };
 
 template <>
 struct Convert<double> {
-    template <typename Tag>
-    static auto call(const std::string &s, const Tag &tag)
+    static auto call(const std::string_view &s, double &v) -> bool
     {
-		double d;
-        auto res = fast_float::from_chars(s.data(), s.data() + s.size(), d);
-		if (res.ec != std::errc()) [[ unlikely ]]
-			throw TokenParseError{tagStr(tag)};
-
-		return d;
+        auto res = fast_float::from_chars(s.data(), s.data() + s.size(), v);
+        return res.ec == std::errc();
     }
 };
 
 template <>
 struct Convert<float> {
-    template <typename Tag>
-    static auto call(const std::string &s, const Tag &tag)
+    static auto call(const std::string_view &s, float &v) -> bool
     {
-		float f;
-        auto res = fast_float::from_chars(s.data(), s.data() + s.size(), f);
-		if (res.ec != std::errc()) [[ unlikely ]]
-			throw TokenParseError{tagStr(tag)};
-
-		return f;
+        auto res = fast_float::from_chars(s.data(), s.data() + s.size(), v);
+        return res.ec == std::errc();
     }
 };
 
 template <>
 struct Convert<int32_t> {
-    template <typename Tag>
-    static auto call(const std::string &s, const Tag &tag)
+    static auto call(const std::string_view &s, int32_t &v) -> bool
     {
-        try {
-            return std::stoi(s);
-        } catch (const std::invalid_argument &) {
-            throw TokenParseError{tagStr(tag)};
-        } catch (const std::out_of_range &) {
-            throw TokenParseError{tagStr(tag)};
-        }
+        auto res = std::from_chars(s.data(), s.data() + s.size(), v);
+        return res.ec == std::errc();
     }
 };
 
+/*
+ * Releases resources owned by a line that will not be handed over to the caller.
+ * Specialize this for lines that contain fields converted to allocated strings.
+ */
+template <typename Line>
+struct Release {
+    static auto call(Line &) -> void {}
+};
+
+/*
+ * Copies a field into a NULL-terminated buffer so that it can be passed to functions
+ * that expect C strings. Returns nullptr if the field does not fit.
+ */
+template <size_t N>
+auto terminated(const std::string_view &s, std::array<char, N> &buf) -> const char *
+{
+    if (s.size() >= N)
+        return nullptr;
+
+    std::copy(s.cbegin(), s.cend(), buf.begin());
+    buf[s.size()] = '\0';
+
+    return buf.data();
+}
+
 template <StringLiteral Tag, typename ValueSetter>
 struct NamedField {
     using Type = typename ValueSetter::Type;
@@ -124,190 +130,214 @@ struct Schema {
     static constexpr SchemaKind Kind = _Kind;
 };
 
-template <typename Line, typename Fields>
-struct FieldsMapper {
-private:
-    static constexpr auto NFields = std::tuple_size<Fields>();
+/*
+ * Returns the next line of the text and advances the text past it.
+ * Line terminators are not included in the returned line.
+ */
+inline
+auto nextLine(std::string_view &text) -> std::string_view
+{
+    const auto end = text.find('\n');
+    auto line = text.substr(0, end);
+    text.remove_prefix(end == std::string_view::npos ? text.size() : end + 1);
 
-    template <size_t Index>
-    static auto mapHeaderNamed(const std::vector<std::string> &tags, std::array<size_t, NFields> &mapping)
-    {
-        using E = std::tuple_element_t<Index, Fields>;
+    if (!line.empty() && line.back() == '\r')
+        line.remove_suffix(1);
 
-        for (size_t idx = 0; idx < tags.size(); idx++) {
-            const auto &tag = tags[idx];
-            if (tag == E::tag) {
-                mapping[Index] = idx;
-                if constexpr (Index == 0)
-                    return mapping;
-                else
-                    return FieldsMapper::mapHeaderNamed<Index - 1>(tags, mapping);
-            }
-        }
+    return line;
+}
 
-        throw std::runtime_error{std::string{"Tag "} + E::tag + " not found"};
-    }
+/*
+ * Calls func(column, field) for every field on the line. Fields may be enclosed in quotes.
+ * Returns the number of fields on the line or throws LLKA_RetCode if the line is malformed
+ * or if func returns an error.
+ */
+template <typename Func>
+auto forEachField(const std::string_view &line, const char delim, const char quote, Func &&func) -> size_t
+{
+    size_t column = 0;
+    size_t idx = 0;
+    while (idx < line.size()) {
+        if (quote != 0 && line[idx] == quote) {
+            const auto next = line.find(quote, idx + 1);
+            if (next == std::string_view::npos)
+                throw LLKA_E_BAD_DATA;    // Unterminated quote
+            else if ((next < line.size() - 1) && (line[next + 1] != delim))
+                throw LLKA_E_BAD_DATA;    // Field separator does not follow the end quote
 
-    template <size_t Index>
-    static auto mapHeaderNumbered(std::array<size_t, NFields> &mapping)
-    {
-        using E = std::tuple_element_t<Index, Fields>;
-        mapping[Index] = E::Index;
+            func(column++, line.substr(idx + 1, next - idx - 1));
+            idx = next + 2;
+        } else {
+            const auto next = line.find(delim, idx);
+
+            func(column++, line.substr(idx, next - idx));
 
-        if constexpr (Index == 0)
-            return mapping;
-        else
-            return mapHeaderNumbered<Index - 1>(mapping);
+            if (next == std::string_view::npos)
+                break;
+            idx = next + 1;
+        }
     }
 
-    template <size_t Index>
-    static auto mapLine(const std::vector<std::string> &toks, const std::array<size_t, NFields> &mapping, Line &line)
+    return column;
+}
+
+/*
+ * Maps columns of a CSV file to the fields of a schema. The mapping is resolved once
+ * from the header so that each field on a line is passed directly to its setter.
+ */
+template <typename Schema>
+class ColumnMapping {
+public:
+    using Line = typename Schema::Line;
+    using FieldSetter = bool (*)(const std::string_view &, Line &);
+
+    static auto fromHeader(const std::string_view &header, const char delim, const char quote) -> ColumnMapping
     {
-        using E = std::tuple_element_t<Index, Fields>;
-        const auto MappedIndex = mapping[Index];
-
-        if (toks.size() < MappedIndex)
-            throw LLKA_E_MISMATCHING_SIZES;
-
-        auto v = Convert<typename E::Type>::call(toks[mapping[Index]], E::tag);
-        E::Setter::set(line, std::move(v));
-        if constexpr (Index == 0)
-            return line;
-        else
-            return mapLine<Index - 1>(toks, mapping, line);
+        ColumnMapping mapping{};
+
+        if constexpr (Schema::Kind == SchemaKind::Named) {
+            std::vector<std::string_view> tags{};
+            tags.reserve(Schema::nFields);
+            forEachField(header, delim, quote, [&tags](size_t, const std::string_view &tag) { tags.push_back(tag); });
+
+            if (tags.size() < Schema::nFields)
+                throw LLKA_E_MISMATCHING_SIZES;
+
+            mapping.m_setters.resize(tags.size(), nullptr);
+            mapping.mapNamed(tags, std::make_index_sequence<Schema::nFields>{});
+        } else {
+            mapping.mapNumbered(std::make_index_sequence<Schema::nFields>{});
+        }
+
+        return mapping;
     }
 
-public:
-    template <SchemaKind Kind>
-    static auto mapHeader(const std::vector<std::string> &tags = {})
+    auto nRequiredColumns() const noexcept
     {
-        std::array<size_t, NFields> mapping{};
-        if constexpr (Kind == SchemaKind::Named)
-            return mapHeaderNamed<NFields - 1>(tags, mapping);
-        else
-            return mapHeaderNumbered<NFields - 1>(mapping);
+        return m_nRequiredColumns;
     }
 
-    static auto mapLine(const std::vector<std::string> &toks, const std::array<size_t, NFields> &mapping)
+    auto setter(size_t column) const noexcept -> FieldSetter
     {
-        Line line{};
-        return mapLine<NFields - 1>(toks, mapping, line);
+        return column < m_setters.size() ? m_setters[column] : nullptr;
     }
-};
 
-template <typename Schema, typename Input>
-static
-auto getMapping(Input &&strm, const char delim)
-{
-    if constexpr (Schema::Kind == SchemaKind::Named) {
-        std::string buf{};
+private:
+    ColumnMapping() = default;
 
-        std::getline(strm, buf);
-        auto tags = split(buf, delim, Schema::nFields);
-        if (tags.size() < Schema::nFields)
-            throw LLKA_E_MISMATCHING_SIZES;
+    template <typename Field>
+    static auto setField(const std::string_view &s, Line &line) -> bool
+    {
+        typename Field::Type v{};
+        if (!Convert<typename Field::Type>::call(s, v)) [[ unlikely ]]
+            return false;
 
-        return FieldsMapper<typename Schema::Line, typename Schema::Fields>::template mapHeader<Schema::Kind>(tags);
-    } else if (Schema::Kind == SchemaKind::Numbered) {
-        return FieldsMapper<typename Schema::Line, typename Schema::Fields>::template mapHeader<Schema::Kind>();
+        Field::Setter::set(line, std::move(v));
+        return true;
     }
-}
 
-inline
-auto splitLine(const std::string &line, const size_t nToks, const char delim, const char quote)
-{
-    if (quote == 0)
-        return split(line, delim, nToks);
+    template <typename Field>
+    auto mapColumn(size_t column) -> void
+    {
+        if (column >= m_setters.size())
+            m_setters.resize(column + 1, nullptr);
 
-    std::vector<std::string> toks{};
-    toks.reserve(nToks);
+        m_setters[column] = &ColumnMapping::setField<Field>;
+        m_nRequiredColumns = std::max(m_nRequiredColumns, column + 1);
+    }
 
-    size_t idx = 0;
-    while (idx < line.length()) {
-        const auto ch = line[idx];
-        if (ch == quote) {
-            auto next = line.find_first_of(quote, idx + 1);
-            if (next == std::string::npos)
-                throw LLKA_E_BAD_DATA;    // Unterminated quote
-            else if ((next < line.length() - 1) && (line[next + 1] != delim))
-                throw LLKA_E_BAD_DATA;    // Field separator does not follow the end quote
+    template <typename Field>
+    auto mapNamedField(const std::vector<std::string_view> &tags) -> void
+    {
+        for (size_t idx = 0; idx < tags.size(); idx++) {
+            if (tags[idx] == Field::tag) {
+                mapColumn<Field>(idx);
+                return;
+            }
+        }
 
-            toks.emplace_back(line.substr(idx + 1, next - idx - 1));
-            idx = next + 2;
-        } else {
-            const auto next = line.find_first_of(delim, idx);
+        throw LLKA_E_MISMATCHING_DATA;    // Tag not found
+    }
 
-            toks.emplace_back(line.substr(idx, next - idx));
+    template <size_t ...Indices>
+    auto mapNamed(const std::vector<std::string_view> &tags, std::index_sequence<Indices...>) -> void
+    {
+        (mapNamedField<std::tuple_element_t<Indices, typename Schema::Fields>>(tags), ...);
+    }
 
-            if (next == std::string::npos)
-                break;
-            idx = next + 1;
-        }
+    template <size_t ...Indices>
+    auto mapNumbered(std::index_sequence<Indices...>) -> void
+    {
+        (mapColumn<std::tuple_element_t<Indices, typename Schema::Fields>>(std::tuple_element_t<Indices, typename Schema::Fields>::Index), ...);
     }
 
-    return toks;
-}
+    std::vector<FieldSetter> m_setters{};
+    size_t m_nRequiredColumns{0};
+};
 
-template <typename Schema, typename Input>
+/*
+ * Parses CSV text. Parsing stops at the first empty line.
+ */
+template <typename Schema>
 static
-auto parse(Input &&strm, const char delim, const char quote)
+auto parse(std::string_view text, const char delim, const char quote, std::vector<typename Schema::Line> &lines) -> LLKA_RetCode
 {
-    using FM = FieldsMapper<typename Schema::Line, typename Schema::Fields>;
-    using Lines = std::vector<typename Schema::Line>;
-    constexpr auto NToks = Schema::nFields;
-    std::vector<std::string> warnings{};
+    using Line = typename Schema::Line;
 
-    Lines lines{};
+    auto releaseAll = [&lines]() {
+        for (auto &line : lines)
+            Release<Line>::call(line);
+        lines.clear();
+    };
 
     try {
-        std::string buf{};
-
-        const auto mapping = getMapping<Schema>(strm, delim);
+        std::string_view header{};
+        if constexpr (Schema::Kind == SchemaKind::Named)
+            header = nextLine(text);
 
-        size_t lineCounter = 2;
-        while (strm) {
-            std::getline(strm, buf);
+        const auto mapping = ColumnMapping<Schema>::fromHeader(header, delim, quote);
 
+        while (!text.empty()) {
+            const auto buf = nextLine(text);
             if (buf.empty())
                 break;
 
-            auto toks = splitLine(buf, NToks, delim, quote);
-
-            try {
-                lines.emplace_back(FM::mapLine(toks, mapping));
-            } catch (const TokenParseError &ex) {
-                std::string warn = "Warning on line " + std::to_string(lineCounter) + ": " + ex.what() + ", skipping that line";
-                warnings.push_back(std::move(warn));
+            Line line{};
+            bool valid = true;
+            const auto nColumns = forEachField(buf, delim, quote, [&mapping, &line, &valid](size_t column, const std::string_view &field) {
+                const auto setter = mapping.setter(column);
+                if (setter != nullptr && valid)
+                    valid = setter(field, line);
+            });
+
+            if (!valid || nColumns < mapping.nRequiredColumns()) [[ unlikely ]] {
+                Release<Line>::call(line);
+                releaseAll();
+                return valid ? LLKA_E_MISMATCHING_SIZES : LLKA_E_BAD_DATA;
             }
 
-            lineCounter++;
+            lines.push_back(line);
         }
-    } catch (const std::runtime_error &) {
-        throw LLKA_E_MISMATCHING_DATA;
+    } catch (const LLKA_RetCode tRet) {
+        releaseAll();
+        return tRet;
     }
 
-    return std::make_tuple(lines, warnings);
+    return LLKA_OK;
 }
 
 template <typename Schema>
 static
-auto parse(const std::filesystem::path &path, const char delim, const char quote)
+auto parse(const std::filesystem::path &path, const char delim, const char quote, std::vector<typename Schema::Line> &lines) -> LLKA_RetCode
 {
-    if (!std::filesystem::is_regular_file(path))
-        throw LLKA_E_NO_FILE;
-
-    std::ifstream ifs{path};
-    if (!ifs)
-        throw LLKA_E_CANNOT_READ_FILE;
-
-    return parse<Schema>(ifs, delim, quote);
-}
+    try {
+        const auto file = MappedFile::map(path);
+        const std::string_view text{static_cast<const char *>(file.data()), file.size()};
 
-template <typename Schema>
-static
-auto parse(const std::string &text, const char delim, const char quote)
-{
-    return parse<Schema>(std::istringstream{text}, delim, quote);
+        return parse<Schema>(text, delim, quote, lines);
+    } catch (const LLKA_RetCode tRet) {
+        return tRet;
+    }
 }
 
 } // namespace LLKAInternal::Csv
@@ -7,9 +7,12 @@
 
 #include "elementaries.h"
 
+#include <array>
 #include <cassert>
+#include <cmath>
 
 #ifdef LLKA_USE_SIMD_X86
+    #include <emmintrin.h>
     #include <xmmintrin.h>
 #elif defined(LLKA_USE_SIMD_WASM)
     #include <wasm_simd128.h>
@@ -210,6 +213,281 @@ auto angle(const LLKA_Point &a, const LLKA_Point &b, const LLKA_Point &c) -> T
     return std::acos(acos);
 }
 
+/*
+ * Batch measurement kernels.
+ *
+ * Input points are laid out as consecutive tuples, e.g. points of the i-th dihedral
+ * are quads[4*i + 0] ... quads[4*i + 3]. Vector math is done for two measurements at once
+ * when SIMD is available. Transcendental functions are evaluated per measurement.
+ */
+
+inline
+auto dihedralFromProjections(double x, double y) -> double
+{
+    // Both projections vanish only if three of the four points are colinear
+    if (x == 0.0 && y == 0.0)
+        return NAN;
+
+    return std::atan2(y, x);
+}
+
+inline
+auto dihedralAngleFromQuad(const LLKA_Point *q) -> double
+{
+    const double b1x = q[1].x - q[0].x, b1y = q[1].y - q[0].y, b1z = q[1].z - q[0].z;
+    const double b2x = q[2].x - q[1].x, b2y = q[2].y - q[1].y, b2z = q[2].z - q[1].z;
+    const double b3x = q[3].x - q[2].x, b3y = q[3].y - q[2].y, b3z = q[3].z - q[2].z;
+
+    const double n1x = b1y * b2z - b1z * b2y, n1y = b1z * b2x - b1x * b2z, n1z = b1x * b2y - b1y * b2x;
+    const double n2x = b2y * b3z - b2z * b3y, n2y = b2z * b3x - b2x * b3z, n2z = b2x * b3y - b2y * b3x;
+
+    const double x = n1x * n2x + n1y * n2y + n1z * n2z;
+    const double y = std::sqrt(b2x * b2x + b2y * b2y + b2z * b2z) * (b1x * n2x + b1y * n2y + b1z * n2z);
+
+    return dihedralFromProjections(x, y);
+}
+
+inline
+auto cosineToAngle(double cosine) -> double
+{
+    cosine = ((-1.0 <= cosine && cosine <= 1.0) * cosine) + ((-1.0 > cosine) * -1.0) + ((cosine > 1.0) * 1.0); // Clamp to <-1; 1>
+
+    return std::acos(cosine);
+}
+
+#if defined(LLKA_USE_SIMD_X86) || defined(LLKA_USE_SIMD_WASM)
+
+#ifdef LLKA_USE_SIMD_X86
+
+using VDReg = __m128d;
+
+inline auto vdMake(double lo, double hi) { return _mm_set_pd(hi, lo); }
+inline auto vdAdd(VDReg a, VDReg b) { return _mm_add_pd(a, b); }
+inline auto vdSub(VDReg a, VDReg b) { return _mm_sub_pd(a, b); }
+inline auto vdMul(VDReg a, VDReg b) { return _mm_mul_pd(a, b); }
+inline auto vdDiv(VDReg a, VDReg b) { return _mm_div_pd(a, b); }
+inline auto vdSqrt(VDReg a) { return _mm_sqrt_pd(a); }
+inline auto vdStore(double *dst, VDReg a) { _mm_storeu_pd(dst, a); }
+inline auto vdLoad(const double *src) { return _mm_loadu_pd(src); }
+inline auto vdSplat(double v) { return _mm_set1_pd(v); }
+inline auto vdMin(VDReg a, VDReg b) { return _mm_min_pd(a, b); }
+inline auto vdRound(VDReg a) { return _mm_cvtepi32_pd(_mm_cvtpd_epi32(a)); }
+inline auto vdZeroUnless(VDReg a, VDReg mask) { return _mm_and_pd(a, mask); }
+inline auto vdGe(VDReg a, VDReg b) { return _mm_cmpge_pd(a, b); }
+inline auto vdIsNaN(VDReg a) { return _mm_cmpunord_pd(a, a); }
+inline auto vdOr(VDReg a, VDReg b) { return _mm_or_pd(a, b); }
+
+// 2^n for integral n within the range of normal doubles
+inline
+auto vdPow2(VDReg n)
+{
+    __m128i e = _mm_add_epi32(_mm_cvtpd_epi32(n), _mm_set1_epi32(1023));
+    e = _mm_unpacklo_epi32(e, _mm_setzero_si128());
+
+    return _mm_castsi128_pd(_mm_slli_epi64(e, 52));
+}
+
+#else
+
+using VDReg = v128_t;
+
+inline auto vdMake(double lo, double hi) { return wasm_f64x2_make(lo, hi); }
+inline auto vdAdd(VDReg a, VDReg b) { return wasm_f64x2_add(a, b); }
+inline auto vdSub(VDReg a, VDReg b) { return wasm_f64x2_sub(a, b); }
+inline auto vdMul(VDReg a, VDReg b) { return wasm_f64x2_mul(a, b); }
+inline auto vdDiv(VDReg a, VDReg b) { return wasm_f64x2_div(a, b); }
+inline auto vdSqrt(VDReg a) { return wasm_f64x2_sqrt(a); }
+inline auto vdStore(double *dst, VDReg a) { wasm_v128_store(dst, a); }
+inline auto vdLoad(const double *src) { return wasm_v128_load(src); }
+inline auto vdSplat(double v) { return wasm_f64x2_splat(v); }
+inline auto vdMin(VDReg a, VDReg b) { return wasm_f64x2_pmin(a, b); }
+inline auto vdRound(VDReg a) { return wasm_f64x2_nearest(a); }
+inline auto vdZeroUnless(VDReg a, VDReg mask) { return wasm_v128_and(a, mask); }
+inline auto vdGe(VDReg a, VDReg b) { return wasm_f64x2_ge(a, b); }
+inline auto vdIsNaN(VDReg a) { return wasm_f64x2_ne(a, a); }
+inline auto vdOr(VDReg a, VDReg b) { return wasm_v128_or(a, b); }
+
+// 2^n for integral n within the range of normal doubles
+inline
+auto vdPow2(VDReg n)
+{
+    v128_t e = wasm_i64x2_extend_low_i32x4(wasm_i32x4_trunc_sat_f64x2_zero(n));
+    e = wasm_i64x2_add(e, wasm_i64x2_splat(1023));
+
+    return wasm_i64x2_shl(e, 52);
+}
+
+#endif // LLKA_USE_SIMD_X86
+
+// Three-component vector of two lanes
+class V3DReg {
+public:
+    VDReg x;
+    VDReg y;
+    VDReg z;
+};
+
+inline
+auto v3dGather(const LLKA_Point &lo, const LLKA_Point &hi) -> V3DReg
+{
+    return { vdMake(lo.x, hi.x), vdMake(lo.y, hi.y), vdMake(lo.z, hi.z) };
+}
+
+inline
+auto v3dSub(const V3DReg &a, const V3DReg &b) -> V3DReg
+{
+    return { vdSub(a.x, b.x), vdSub(a.y, b.y), vdSub(a.z, b.z) };
+}
+
+inline
+auto v3dDot(const V3DReg &a, const V3DReg &b) -> VDReg
+{
+    return vdAdd(vdAdd(vdMul(a.x, b.x), vdMul(a.y, b.y)), vdMul(a.z, b.z));
+}
+
+inline
+auto v3dCross(const V3DReg &a, const V3DReg &b) -> V3DReg
+{
+    return {
+        vdSub(vdMul(a.y, b.z), vdMul(a.z, b.y)),
+        vdSub(vdMul(a.z, b.x), vdMul(a.x, b.z)),
+        vdSub(vdMul(a.x, b.y), vdMul(a.y, b.x))
+    };
+}
+
+/*
+ * Exponential of both lanes. The argument is reduced to |r| <= ln(2)/2 with the Cody-Waite
+ * scheme and exp(r) is evaluated with a degree 12 Taylor polynomial, which keeps the result
+ * within a few ulps of std::exp(). Results that would not be normal doubles are flushed to zero,
+ * arguments above 709 saturate. NaN arguments give NaN, just like std::exp() does.
+ */
+inline
+auto vdExp(VDReg x) -> VDReg
+{
+    constexpr double LOG2E = 1.4426950408889634;
+    constexpr double LN2_HI = 6.93145751953125e-1;
+    constexpr double LN2_LO = 1.42860682030941723212e-6;
+    constexpr double MIN_ARG = -708.3964185322641; // ln(DBL_MIN)
+    constexpr double MAX_ARG = 709.0;
+    constexpr std::array<double, 13> COEFFS{
+        1.0 / 479001600.0, 1.0 / 39916800.0, 1.0 / 3628800.0, 1.0 / 362880.0, 1.0 / 40320.0, 1.0 / 5040.0, 1.0 / 720.0,
+        1.0 / 120.0, 1.0 / 24.0, 1.0 / 6.0, 1.0 / 2.0, 1.0, 1.0
+    };
+
+    const auto valid = vdGe(x, vdSplat(MIN_ARG));
+    const auto xc = vdMin(x, vdSplat(MAX_ARG));
+
+    const auto n = vdRound(vdMul(xc, vdSplat(LOG2E)));
+    const auto r = vdSub(vdSub(xc, vdMul(n, vdSplat(LN2_HI))), vdMul(n, vdSplat(LN2_LO)));
+
+    auto p = vdSplat(COEFFS[0]);
+    for (size_t idx = 1; idx < COEFFS.size(); idx++)
+        p = vdAdd(vdMul(p, r), vdSplat(COEFFS[idx]));
+
+    // NaN lanes fail the range check above, OR the NaN back in
+    return vdOr(vdZeroUnless(vdMul(p, vdPow2(n)), valid), vdZeroUnless(x, vdIsNaN(x)));
+}
+
+#endif // LLKA_USE_SIMD_*
+
+inline
+auto expBatch(const double *in, size_t n, double *out) -> void
+{
+    size_t idx = 0;
+
+#if defined(LLKA_USE_SIMD_X86) || defined(LLKA_USE_SIMD_WASM)
+    for (; idx + 2 <= n; idx += 2)
+        vdStore(out + idx, vdExp(vdLoad(in + idx)));
+#endif // LLKA_USE_SIMD_*
+
+    for (; idx < n; idx++)
+        out[idx] = std::exp(in[idx]);
+}
+
+inline
+auto dihedralAnglesBatch(const LLKA_Point *quads, size_t n, double *out) -> void
+{
+    size_t idx = 0;
+
+#if defined(LLKA_USE_SIMD_X86) || defined(LLKA_USE_SIMD_WASM)
+    for (; idx + 2 <= n; idx += 2) {
+        const LLKA_Point *lo = quads + 4 * idx;
+        const LLKA_Point *hi = lo + 4;
+
+        const auto A = v3dGather(lo[0], hi[0]);
+        const auto B = v3dGather(lo[1], hi[1]);
+        const auto C = v3dGather(lo[2], hi[2]);
+        const auto D = v3dGather(lo[3], hi[3]);
+
+        const auto b1 = v3dSub(B, A);
+        const auto b2 = v3dSub(C, B);
+        const auto b3 = v3dSub(D, C);
+        const auto n1 = v3dCross(b1, b2);
+        const auto n2 = v3dCross(b2, b3);
+
+        double x[2];
+        double y[2];
+        vdStore(x, v3dDot(n1, n2));
+        vdStore(y, vdMul(vdSqrt(v3dDot(b2, b2)), v3dDot(b1, n2)));
+
+        out[idx] = dihedralFromProjections(x[0], y[0]);
+        out[idx + 1] = dihedralFromProjections(x[1], y[1]);
+    }
+#endif // LLKA_USE_SIMD_*
+
+    for (; idx < n; idx++)
+        out[idx] = dihedralAngleFromQuad(quads + 4 * idx);
+}
+
+inline
+auto anglesBatch(const LLKA_Point *triples, size_t n, double *out) -> void
+{
+    size_t idx = 0;
+
+#if defined(LLKA_USE_SIMD_X86) || defined(LLKA_USE_SIMD_WASM)
+    for (; idx + 2 <= n; idx += 2) {
+        const LLKA_Point *lo = triples + 3 * idx;
+        const LLKA_Point *hi = lo + 3;
+
+        const auto B = v3dGather(lo[1], hi[1]);
+        const auto ba = v3dSub(v3dGather(lo[0], hi[0]), B);
+        const auto bc = v3dSub(v3dGather(lo[2], hi[2]), B);
+
+        const auto mags = vdMul(vdSqrt(v3dDot(ba, ba)), vdSqrt(v3dDot(bc, bc)));
+
+        double cosines[2];
+        vdStore(cosines, vdDiv(v3dDot(ba, bc), mags));
+
+        out[idx] = cosineToAngle(cosines[0]);
+        out[idx + 1] = cosineToAngle(cosines[1]);
+    }
+#endif // LLKA_USE_SIMD_*
+
+    for (; idx < n; idx++) {
+        const LLKA_Point *t = triples + 3 * idx;
+        out[idx] = angle<double>(t[0], t[1], t[2]);
+    }
+}
+
+inline
+auto spatialDistancesBatch(const LLKA_Point *pairs, size_t n, double *out) -> void
+{
+    size_t idx = 0;
+
+#if defined(LLKA_USE_SIMD_X86) || defined(LLKA_USE_SIMD_WASM)
+    for (; idx + 2 <= n; idx += 2) {
+        const LLKA_Point *lo = pairs + 2 * idx;
+        const LLKA_Point *hi = lo + 2;
+
+        const auto d = v3dSub(v3dGather(lo[1], hi[1]), v3dGather(lo[0], hi[0]));
+        vdStore(out + idx, vdSqrt(v3dDot(d, d)));
+    }
+#endif // LLKA_USE_SIMD_*
+
+    for (; idx < n; idx++)
+        out[idx] = spatialDistance<double>(pairs[2 * idx], pairs[2 * idx + 1]);
+}
+
 } // namespace LLKAInternal
 
 #endif // _LLKA_UTIL_GEOMETRY_H
@@ -0,0 +1,165 @@
+// vim: set sw=4 ts=4 sts=4 expandtab :
+
+#ifndef _LLKA_UTIL_MAPPED_FILE_HPP
+#define _LLKA_UTIL_MAPPED_FILE_HPP
+
+#include <llka_main.h>
+
+#include <cstddef>
+#include <filesystem>
+#include <system_error>
+#include <utility>
+
+#ifdef LLKA_PLATFORM_WIN32
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif // NOMINMAX
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif // WIN32_LEAN_AND_MEAN
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif // LLKA_PLATFORM_WIN32
+
+namespace LLKAInternal {
+
+/*
+ * Read-only view of an entire file mapped into memory.
+ * Pages of the mapping are shared among all processes that map the same file.
+ */
+class MappedFile {
+public:
+    MappedFile() noexcept = default;
+
+    MappedFile(const MappedFile &) = delete;
+    MappedFile(MappedFile &&other) noexcept :
+        m_data{std::exchange(other.m_data, nullptr)},
+        m_size{std::exchange(other.m_size, 0)}
+    {
+    }
+
+    ~MappedFile()
+    {
+        unmap();
+    }
+
+    auto operator=(const MappedFile &) -> MappedFile & = delete;
+    auto operator=(MappedFile &&other) noexcept -> MappedFile &
+    {
+        if (this != &other) {
+            unmap();
+            m_data = std::exchange(other.m_data, nullptr);
+            m_size = std::exchange(other.m_size, 0);
+        }
+
+        return *this;
+    }
+
+    auto data() const noexcept -> const void *
+    {
+        return m_data;
+    }
+
+    auto size() const noexcept -> size_t
+    {
+        return m_size;
+    }
+
+    /*
+     * Maps the file at the given path. Throws LLKA_RetCode on failure.
+     */
+    static auto map(const std::filesystem::path &path) -> MappedFile
+    {
+        // This is called from the C API, do not let std::filesystem throw its own exceptions
+        std::error_code ec{};
+        const auto status = std::filesystem::status(path, ec);
+        if (status.type() == std::filesystem::file_type::not_found)
+            throw LLKA_E_NO_FILE;
+        if (ec)
+            throw LLKA_E_CANNOT_READ_FILE;
+        if (!std::filesystem::is_regular_file(status))
+            throw LLKA_E_NO_FILE;
+
+        MappedFile mf{};
+
+    #ifdef LLKA_PLATFORM_WIN32
+        HANDLE hFile = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (hFile == INVALID_HANDLE_VALUE)
+            throw LLKA_E_CANNOT_READ_FILE;
+
+        LARGE_INTEGER size;
+        if (!GetFileSizeEx(hFile, &size)) {
+            CloseHandle(hFile);
+            throw LLKA_E_CANNOT_READ_FILE;
+        }
+        if (size.QuadPart == 0) {
+            CloseHandle(hFile);
+            return mf;
+        }
+
+        HANDLE hMapping = CreateFileMappingW(hFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        CloseHandle(hFile);
+        if (hMapping == nullptr)
+            throw LLKA_E_CANNOT_READ_FILE;
+
+        void *data = MapViewOfFile(hMapping, FILE_MAP_READ, 0, 0, 0);
+        CloseHandle(hMapping); // The view keeps the mapping object alive
+        if (data == nullptr)
+            throw LLKA_E_CANNOT_READ_FILE;
+
+        mf.m_data = data;
+        mf.m_size = size_t(size.QuadPart);
+    #else
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0)
+            throw LLKA_E_CANNOT_READ_FILE;
+
+        struct stat st;
+        if (::fstat(fd, &st) != 0) {
+            ::close(fd);
+            throw LLKA_E_CANNOT_READ_FILE;
+        }
+        if (st.st_size == 0) {
+            ::close(fd);
+            return mf;
+        }
+
+        void *data = ::mmap(nullptr, size_t(st.st_size), PROT_READ, MAP_SHARED, fd, 0);
+        ::close(fd); // The mapping stays valid after the descriptor is closed
+        if (data == MAP_FAILED)
+            throw LLKA_E_CANNOT_READ_FILE;
+
+        mf.m_data = data;
+        mf.m_size = size_t(st.st_size);
+    #endif // LLKA_PLATFORM_WIN32
+
+        return mf;
+    }
+
+private:
+    auto unmap() noexcept -> void
+    {
+        if (m_data == nullptr)
+            return;
+
+    #ifdef LLKA_PLATFORM_WIN32
+        UnmapViewOfFile(m_data);
+    #else
+        ::munmap(m_data, m_size);
+    #endif // LLKA_PLATFORM_WIN32
+
+        m_data = nullptr;
+        m_size = 0;
+    }
+
+    void *m_data{nullptr};
+    size_t m_size{0};
+};
+
+} // namespace LLKAInternal
+
+#endif // _LLKA_UTIL_MAPPED_FILE_HPP
@@ -0,0 +1,186 @@
+/* vim: set sw=4 ts=4 sts=4 expandtab : */
+
+#ifndef _LLKA_UTIL_PARALLEL_HPP
+#define _LLKA_UTIL_PARALLEL_HPP
+
+#include <llka_main.h>
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <functional>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace LLKAInternal {
+
+#if !defined(LLKA_PLATFORM_EMSCRIPTEN) || defined(__EMSCRIPTEN_PTHREADS__)
+inline constexpr bool THREADS_AVAILABLE = true;
+#else
+inline constexpr bool THREADS_AVAILABLE = false;
+#endif // !LLKA_PLATFORM_EMSCRIPTEN || __EMSCRIPTEN_PTHREADS__
+
+/*
+ * Upper bound of the number of threads requested through LLKA_NUM_THREADS.
+ */
+inline constexpr size_t MAX_REQUESTED_THREADS = 256;
+
+/*
+ * Parses the value of LLKA_NUM_THREADS. Returns zero if the value is not a positive integer.
+ */
+inline
+auto parseThreadCount(const char *str) -> size_t
+{
+    const char *last = str + std::strlen(str);
+    long long requested = 0;
+
+    const auto [ptr, ec] = std::from_chars(str, last, requested);
+    if (ec != std::errc{} || ptr != last || requested <= 0)
+        return 0;
+
+    return size_t(std::min<long long>(requested, MAX_REQUESTED_THREADS));
+}
+
+/*
+ * Number of threads the machine can run concurrently. The LLKA_NUM_THREADS environment variable
+ * overrides it, which allows to exercise the multithreaded code on a single-CPU machine.
+ * Invalid values of the variable are ignored.
+ */
+inline
+auto availableThreads() -> size_t
+{
+    static const size_t n = []() -> size_t {
+        if (const char *env = std::getenv("LLKA_NUM_THREADS"); env != nullptr) {
+            if (const auto requested = parseThreadCount(env); requested > 0)
+                return requested;
+        }
+
+        return std::max(1U, std::thread::hardware_concurrency());
+    }();
+
+    return n;
+}
+
+/*
+ * Maximum number of threads that parallel work is split into, including the calling thread.
+ * Builds that run on a fixed pool of threads (such as the multithreaded WebAssembly builds)
+ * define LLKA_MAX_THREADS to the size of the pool.
+ */
+inline
+auto maxThreads() -> size_t
+{
+    if constexpr (!THREADS_AVAILABLE)
+        return 1;
+
+    size_t n = availableThreads();
+#ifdef LLKA_MAX_THREADS
+    n = std::min<size_t>(n, LLKA_MAX_THREADS);
+#endif // LLKA_MAX_THREADS
+
+    return n;
+}
+
+/*
+ * Splits the range [0, n) into at most nThreads contiguous blocks of at least minPerThread items
+ * and calls func(first, last) for each block. The first block is processed on the calling thread.
+ * Blocks that cannot be given their own thread are processed on the calling thread too.
+ * If func throws, the exception is rethrown on the calling thread once all blocks have finished.
+ */
+template <typename Func>
+auto parallelFor(const size_t n, const size_t minPerThread, Func &&func, const size_t nThreads = maxThreads()) -> void
+{
+    const size_t nBlocks = THREADS_AVAILABLE ? std::max<size_t>(1, std::min(nThreads, n / std::max<size_t>(1, minPerThread))) : 1;
+    if (nBlocks == 1) {
+        func(size_t(0), n);
+        return;
+    }
+
+    auto blockFirst = [n, nBlocks](size_t block) { return block * n / nBlocks; };
+
+    std::vector<std::exception_ptr> errors(nBlocks);
+    auto run = [&func, &blockFirst, &errors](size_t block) {
+        try {
+            func(blockFirst(block), blockFirst(block + 1));
+        } catch (...) {
+            errors[block] = std::current_exception();
+        }
+    };
+
+    std::vector<std::thread> threads{};
+    threads.reserve(nBlocks - 1);
+
+    size_t block = 1;
+    try {
+        for (; block < nBlocks; block++)
+            threads.emplace_back(run, block);
+    } catch (const std::system_error &) {
+        // Out of threads, do the rest here
+    }
+
+    run(0);
+    for (; block < nBlocks; block++)
+        run(block);
+
+    for (auto &t : threads)
+        t.join();
+
+    for (const auto &e : errors) {
+        if (e)
+            std::rethrow_exception(e);
+    }
+}
+
+/*
+ * Runs the tasks concurrently on at most nThreads threads, the last task runs on the calling thread.
+ * Tasks that cannot be given their own thread run on the calling thread too.
+ * If a task throws, the exception is rethrown on the calling thread once all tasks have finished.
+ */
+template <size_t N>
+auto runConcurrently(const std::array<std::function<LLKA_RetCode ()>, N> &tasks, const size_t nThreads = maxThreads()) -> LLKA_RetCode
+{
+    std::array<LLKA_RetCode, N> results{};
+    std::array<std::exception_ptr, N> errors{};
+    auto run = [&tasks, &results, &errors](size_t idx) {
+        try {
+            results[idx] = tasks[idx]();
+        } catch (...) {
+            errors[idx] = std::current_exception();
+        }
+    };
+
+    std::vector<std::thread> threads{};
+    size_t nStarted = 0;
+    if constexpr (THREADS_AVAILABLE) {
+        const size_t nToStart = std::min(N, std::max<size_t>(1, nThreads)) - 1;
+        try {
+            threads.reserve(nToStart);
+            for (; nStarted < nToStart; nStarted++)
+                threads.emplace_back(run, nStarted);
+        } catch (const std::system_error &) {
+            // Out of threads, do the rest here
+        }
+    }
+
+    for (size_t idx = nStarted; idx < N; idx++)
+        run(idx);
+    for (auto &t : threads)
+        t.join();
+
+    for (const auto &e : errors) {
+        if (e)
+            std::rethrow_exception(e);
+    }
+    for (const auto tRet : results) {
+        if (tRet != LLKA_OK)
+            return tRet;
+    }
+    return LLKA_OK;
+}
+
+} // namespace LLKAInternal
+
+#endif // _LLKA_UTIL_PARALLEL_HPP
@@ -1,13 +1,50 @@
 /* vim: set sw=4 ts=4 sts=4 expandtab : */
 
+#include "../src/ntc_bones.hpp"
 #include "../src/util/elementaries.h"
+#include "../src/util/parallel.hpp"
+#include "../src/tracing/echmet_tracer.h"
 
 
 #include "effedup.hpp"
 
+#include <array>
+#include <atomic>
+#include <compare>
+#include <cstdint>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
+// Tracer of its own so that the test does not depend on what the library traces
+enum class TestTracing {
+    THREAD_RECORD,
+    __LAST
+};
+
+ECHMET_MAKE_TRACEPOINT_IDS(TestTracing, THREAD_RECORD, __LAST)
+ECHMET_MAKE_TRACER(TestTracing)
+
+namespace ECHMET {
+
+ECHMET_MAKE_TRACEPOINT(TestTracing, THREAD_RECORD, "Record logged by a test thread", "indices: thread, record")
+ECHMET_BEGIN_MAKE_LOGGER(TestTracing, THREAD_RECORD, size_t thread, size_t idx)
+{
+    record.addIndex(int64_t(thread));
+    record.addIndex(int64_t(idx));
+}
+ECHMET_END_MAKE_LOGGER
+
+ECHMET_MAKE_FORMATTER_NOINLINE(TestTracing, THREAD_RECORD, record)
+{
+    return std::to_string(record.indices[0]) + " " + std::to_string(record.indices[1]);
+}
+
+} // namespace ECHMET
+
 static
 auto testSignTemplated()
 {
@@ -46,9 +83,210 @@ auto testSignDouble()
     }
 }
 
+static
+auto testANStringOverlong()
+{
+    const LLKABones::ANString overlong{std::string{"ABCDEFGH"}};
+    const LLKABones::ANString otherOverlong{std::string{"ABCDEFGHIJ"}};
+    const LLKABones::ANString fits{"ABCDEFG"};
+
+    EFF_expect(overlong.overlong(), true, "overlong name was not marked");
+    EFF_expect(fits.overlong(), false, "name that fits was marked as overlong");
+    EFF_expect(fits == LLKABones::ANString{"ABCDEFG"}, true, "equal names do not compare equal");
+    EFF_expect(overlong == overlong, true, "overlong name does not compare equal to itself");
+    EFF_expect(overlong == otherOverlong, true, "overlong names are not the same invalid name");
+    EFF_expect(overlong == fits, false, "overlong name compares equal to a name that fits");
+    EFF_expect(overlong.matches("ABCDEFGH"), false, "overlong name matches");
+    EFF_expect(std::string{overlong.c_str()}, std::string{}, "overlong name is not empty");
+
+    // Names are totally ordered
+    EFF_expect((overlong <=> overlong) == std::strong_ordering::equal, true, "overlong name is not equivalent to itself");
+    EFF_expect((overlong <=> fits) == std::strong_ordering::less, true, "overlong name is not ordered before names");
+    EFF_expect((LLKABones::ANString{} <=> overlong) == std::strong_ordering::less, true, "empty name is not ordered first");
+    EFF_expect((LLKABones::ANString{"C1'"} <=> LLKABones::ANString{"C2'"}) == std::strong_ordering::less, true, "names are not ordered lexicographically");
+
+    const std::set<LLKABones::ANString> names{ overlong, otherOverlong, fits, LLKABones::ANString{"P"}, LLKABones::ANString{"P"} };
+    EFF_expect(names.size(), size_t(3), "names cannot be used as a lookup key");
+}
+
+static
+auto testParallelFor()
+{
+    for (size_t n : { 0, 1, 15, 100, 1001 }) {
+        std::vector<int> visits(n, 0);
+        std::atomic<size_t> nBlocks{0};
+
+        LLKAInternal::parallelFor(
+            n, 16,
+            [&visits, &nBlocks](size_t first, size_t last) {
+                nBlocks++;
+                for (size_t idx = first; idx < last; idx++)
+                    visits[idx]++;
+            },
+            4
+        );
+
+        for (const auto v : visits)
+            EFF_expect(v, 1, "parallelFor() did not visit every item exactly once");
+        EFF_expect(nBlocks.load() <= 4, true, "parallelFor() used more blocks than threads");
+    }
+}
+
+static
+auto testParallelExceptions()
+{
+    // Exceptions thrown on worker threads must reach the caller
+    bool caught = false;
+    try {
+        LLKAInternal::parallelFor(
+            100, 16,
+            [](size_t first, size_t) {
+                if (first > 0)
+                    throw std::runtime_error{"block failed"};
+            },
+            4
+        );
+    } catch (const std::runtime_error &) {
+        caught = true;
+    }
+    EFF_expect(caught, true, "exception thrown by parallelFor() block was lost");
+
+    caught = false;
+    try {
+        LLKAInternal::runConcurrently<3>({
+            []() { return LLKA_OK; },
+            []() -> LLKA_RetCode { throw std::runtime_error{"task failed"}; },
+            []() { return LLKA_OK; }
+        });
+    } catch (const std::runtime_error &) {
+        caught = true;
+    }
+    EFF_expect(caught, true, "exception thrown by a concurrent task was lost");
+}
+
+static
+auto testThreadCount()
+{
+    EFF_expect(LLKAInternal::parseThreadCount("4"), size_t(4), "valid thread count rejected");
+    EFF_expect(LLKAInternal::parseThreadCount("100000"), LLKAInternal::MAX_REQUESTED_THREADS, "thread count not capped");
+    for (const char *invalid : { "", "0", "-1", "4x", " 4", "x" })
+        EFF_expect(LLKAInternal::parseThreadCount(invalid), size_t(0), "invalid thread count accepted");
+
+    // A single thread runs all tasks on the calling thread
+    const auto caller = std::this_thread::get_id();
+    std::array<std::thread::id, 3> ids{};
+    const auto tRet = LLKAInternal::runConcurrently<3>(
+        {
+            [&ids]() { ids[0] = std::this_thread::get_id(); return LLKA_OK; },
+            [&ids]() { ids[1] = std::this_thread::get_id(); return LLKA_OK; },
+            [&ids]() { ids[2] = std::this_thread::get_id(); return LLKA_OK; }
+        },
+        1
+    );
+    EFF_expect(tRet, LLKA_OK, "concurrent tasks failed");
+    for (const auto &id : ids)
+        EFF_expect(id == caller, true, "task did not run on the calling thread");
+}
+
+static
+auto testTracingThreads()
+{
+    static constexpr size_t N_THREADS = 4;
+    static constexpr size_t N_CONTEXTS = 5;
+    // Contexts span the block boundaries of the thread buffers
+    static constexpr size_t N_PER_CONTEXT = 150;
+    static constexpr size_t N_PER_THREAD = N_CONTEXTS * N_PER_CONTEXT;
+
+    auto &tracer = ECHMET::TRACER_INSTANCE<TestTracing>();
+    tracer.enableAllTracepoints();
+    const auto nBuffers = tracer.threadBufferCount();
+
+    auto log = [](size_t thread) {
+        for (size_t ctx = 0; ctx < N_CONTEXTS; ctx++) {
+            ECHMET_TRACE_CONTEXT(TestTracing, thread);
+            for (size_t idx = 0; idx < N_PER_CONTEXT; idx++)
+                ECHMET_TRACE(TestTracing, THREAD_RECORD, thread, ctx * N_PER_CONTEXT + idx);
+        }
+    };
+    auto checkComplete = [](const std::vector<ECHMET::TraceRecord> &records) {
+        std::vector<std::vector<bool>> seen(N_THREADS, std::vector<bool>(N_PER_THREAD, false));
+
+        EFF_expect(records.size(), N_THREADS * N_PER_THREAD, "wrong number of trace records");
+        for (const auto &rec : records) {
+            EFF_expect(rec.nIndices, 2U, "incomplete trace record");
+            const auto thread = size_t(rec.indices[0]);
+            const auto idx = size_t(rec.indices[1]);
+            EFF_expect(thread < N_THREADS && idx < N_PER_THREAD, true, "corrupted trace record");
+            EFF_expect(bool(seen[thread][idx]), false, "duplicate trace record");
+            EFF_expect(rec.contextTag, uint64_t(thread), "trace record was logged in a wrong context");
+            seen[thread][idx] = true;
+        }
+    };
+
+    // Drain the records while the threads are still logging
+    {
+        std::atomic<size_t> running{N_THREADS};
+        std::vector<std::thread> threads{};
+        for (size_t thread = 0; thread < N_THREADS; thread++)
+            threads.emplace_back([&log, &running, thread]() { log(thread); running--; });
+
+        std::vector<ECHMET::TraceRecord> records{};
+        auto drain = [&tracer, &records]() {
+            auto batch = tracer.records();
+            records.insert(records.end(), batch.begin(), batch.end());
+        };
+        while (running.load() > 0)
+            drain();
+        for (auto &t : threads)
+            t.join();
+        drain();
+
+        checkComplete(records);
+    }
+    EFF_expect(tracer.threadBufferCount(), nBuffers, "buffers of exited threads were not released");
+
+    // Records of each context must be grouped together in the merged trace
+    {
+        std::vector<std::thread> threads{};
+        for (size_t thread = 0; thread < N_THREADS; thread++)
+            threads.emplace_back(log, thread);
+        for (auto &t : threads)
+            t.join();
+
+        const auto records = tracer.records(true);
+        checkComplete(records);
+
+        std::set<uint64_t> finished{};
+        for (size_t idx = 0; idx < records.size(); idx++) {
+            const auto &rec = records[idx];
+            EFF_expect(rec.contextId != 0, true, "trace record was logged outside of a context");
+
+            if (idx == 0 || rec.contextId != records[idx - 1].contextId) {
+                EFF_expect(finished.contains(rec.contextId), false, "records of a trace context are not grouped");
+                if (idx > 0)
+                    finished.insert(records[idx - 1].contextId);
+            } else
+                EFF_expect(rec.indices[1], records[idx - 1].indices[1] + 1, "records of a trace context are out of order");
+        }
+        EFF_expect(finished.size(), N_THREADS * N_CONTEXTS - 1, "wrong number of trace contexts");
+
+        // Kept records are not drained so the buffers must stay around
+        EFF_expect(tracer.threadBufferCount(), nBuffers + N_THREADS, "buffers were released before they were drained");
+        EFF_expect(tracer.records().size(), N_THREADS * N_PER_THREAD, "kept records were lost");
+        EFF_expect(tracer.threadBufferCount(), nBuffers, "buffers of exited threads were not released");
+    }
+
+    tracer.disableAllTracepoints();
+}
+
 auto main() -> int
 {
     testSignTemplated();
     testSignDouble();
+    testANStringOverlong();
+    testParallelFor();
+    testParallelExceptions();
+    testThreadCount();
+    testTracingThreads();
 }
 
@@ -3,12 +3,26 @@
 #include "testing_structures.h"
 
 #include <llka_classification.h>
+#include <llka_profiling.h>
 #include <llka_resource_loaders.h>
 #include <llka_tracing.h>
 
 #include "effedup.hpp"
 
 #include "../src/util/elementaries.h"
+#include "../src/util/geometry.h"
+
+#include <array>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <string>
+#include <tuple>
+#include <vector>
+
+static const double MAX_CLOSE_ENOUGH_RMSD = 0.5;
 
 namespace EffedUp {
 
@@ -137,6 +151,281 @@ auto testClassifyViolations(const LLKA_ClassificationContext *ctx)
     LLKA_destroyStructure(&stru);
 }
 
+static
+auto testResourceLoading()
+{
+    // File and text must load the same data
+    std::ifstream ifs{"./golden_steps.csv", std::ios::binary};
+    const std::string text{std::istreambuf_iterator<char>{ifs}, std::istreambuf_iterator<char>{}};
+
+    LLKA_Resource fromFile = {};
+    fromFile.type = LLKA_RES_GOLDEN_STEPS;
+    auto tRet = LLKA_loadResourceFile(LLKA_PathLiteral("./golden_steps.csv"), &fromFile);
+    EFF_expect(tRet, LLKA_OK, "could not load golden steps from file");
+
+    LLKA_Resource fromText = {};
+    fromText.type = LLKA_RES_GOLDEN_STEPS;
+    tRet = LLKA_loadResourceText(text.c_str(), &fromText);
+    EFF_expect(tRet, LLKA_OK, "could not load golden steps from text");
+
+    EFF_expect(fromFile.count, fromText.count, "different number of golden steps loaded from file and text");
+    const auto &last = fromText.data.goldenSteps[fromText.count - 1];
+    EFF_expect(std::string{fromFile.data.goldenSteps[fromFile.count - 1].name}, std::string{last.name}, "different golden steps loaded from file and text");
+    EFF_expect(last.pucker_1 != LLKA_INVALID_SUGAR_PUCKER, true, "sugar pucker of the last golden step was not loaded");
+
+    LLKA_destroyResource(&fromFile);
+    LLKA_destroyResource(&fromText);
+
+    // Malformed variants of the golden steps
+    const auto headerEnd = text.find('\n');
+    const auto firstLineEnd = text.find('\n', headerEnd + 1);
+    const auto header = text.substr(0, headerEnd + 1);
+    const auto firstLine = text.substr(headerEnd + 1, firstLineEnd - headerEnd);
+
+    std::array<std::tuple<std::string, LLKA_RetCode, const char *>, 5> malformed{{
+        { "clusterNumber;delta_1\n" + firstLine, LLKA_E_MISMATCHING_SIZES, "short header was accepted" },
+        { "x" + text, LLKA_E_MISMATCHING_DATA, "header with missing tag was accepted" },
+        { header + firstLine.substr(0, firstLine.find(';', 10)) + "\n", LLKA_E_MISMATCHING_SIZES, "short line was accepted" },
+        { header + "x" + firstLine, LLKA_E_BAD_DATA, "invalid number was accepted" },
+        { header + "\"" + firstLine, LLKA_E_BAD_DATA, "unterminated quote was accepted" }
+    }};
+    for (const auto &[csv, expected, msg] : malformed) {
+        LLKA_Resource res = {};
+        res.type = LLKA_RES_GOLDEN_STEPS;
+        tRet = LLKA_loadResourceText(csv.c_str(), &res);
+        EFF_expect(tRet, expected, msg);
+    }
+}
+
+static
+auto classificationLimits()
+{
+    LLKA_ClassificationLimits limits = {};
+    limits.averageNeighborsTorsionCutoff = LLKAInternal::D2R(28.0);
+    limits.nearestNeighborTorsionsCutoff = LLKAInternal::D2R(28.0);
+    limits.totalDistanceCutoff = LLKAInternal::D2R(60.0);
+    limits.pseudorotationCutoff = LLKAInternal::D2R(72.0);
+    limits.minimumClusterVotes = 0.001111;
+    limits.minimumNearestNeighbors = 7;
+    limits.numberOfUsedNearestNeighbors = 11;
+
+    return limits;
+}
+
+static
+auto readText(const char *path)
+{
+    std::ifstream ifs{path, std::ios::binary};
+    return std::string{std::istreambuf_iterator<char>{ifs}, std::istreambuf_iterator<char>{}};
+}
+
+static
+auto testContextFromResources(const LLKA_ClassificationContext *ctx)
+{
+    const auto limits = classificationLimits();
+
+    LLKA_ClassificationContext *dirCtx = nullptr;
+    auto tRet = LLKA_initializeClassificationContextFromDirectory(LLKA_PathLiteral("."), &limits, MAX_CLOSE_ENOUGH_RMSD, &dirCtx);
+    EFF_expect(tRet, LLKA_OK, "unable to initialize classification context from directory");
+
+    const auto clusters = readText("./clusters.csv");
+    const auto goldenSteps = readText("./golden_steps.csv");
+    const auto confals = readText("./confals.csv");
+    const auto nuAngles = readText("./nu_angles.csv");
+    const auto confalPercentiles = readText("./confal_percentiles.csv");
+
+    LLKA_ClassificationResourceBundle bundle = {};
+    bundle.clusters = clusters.c_str();
+    bundle.goldenSteps = goldenSteps.c_str();
+    bundle.confals = confals.c_str();
+    bundle.clusterNuAngles = nuAngles.c_str();
+    bundle.confalPercentiles = confalPercentiles.c_str();
+
+    LLKA_ClassificationContext *bundleCtx = nullptr;
+    tRet = LLKA_initializeClassificationContextFromBundle(&bundle, &limits, MAX_CLOSE_ENOUGH_RMSD, &bundleCtx);
+    EFF_expect(tRet, LLKA_OK, "unable to initialize classification context from bundle");
+
+    // Both contexts must classify exactly the same as a context initialized from resources
+    const std::array<std::tuple<const LLKA_Atom *, size_t>, 3> structures{{
+        { REAL_1BNA_A_1_2_ATOMS, REAL_1BNA_A_1_2_ATOMS_LEN },
+        { REAL_3VOK_U_1_2_ATOMS, REAL_3VOK_U_1_2_ATOMS_LEN },
+        { REAL_1DK1_B_27_28_ATOMS, REAL_1DK1_B_27_28_ATOMS_LEN }
+    }};
+    for (const auto &[atoms, nAtoms] : structures) {
+        LLKA_Structure stru = LLKA_makeStructure(atoms, nAtoms);
+
+        LLKA_ClassifiedStep original{};
+        auto tRetOriginal = LLKA_classifyStep(&stru, ctx, &original);
+
+        for (const auto other : { dirCtx, bundleCtx }) {
+            LLKA_ClassifiedStep classified{};
+            tRet = LLKA_classifyStep(&stru, other, &classified);
+            EFF_expect(tRet, tRetOriginal, "mismatching classification return codes");
+
+            if (tRetOriginal == LLKA_OK) {
+                EFF_expect(classified.assignedNtC, original.assignedNtC, "mismatching assigned NtC");
+                EFF_expect(std::string{classified.closestGoldenStep}, std::string{original.closestGoldenStep}, "mismatching closest golden step");
+                EFF_expect(classified.confalScore.total, original.confalScore.total, "mismatching confal score");
+            }
+        }
+
+        LLKA_destroyStructure(&stru);
+    }
+
+    LLKA_destroyClassificationContext(dirCtx);
+    LLKA_destroyClassificationContext(bundleCtx);
+
+    LLKA_ClassificationContext *badCtx = nullptr;
+    tRet = LLKA_initializeClassificationContextFromDirectory(LLKA_PathLiteral("./no_such_directory"), &limits, MAX_CLOSE_ENOUGH_RMSD, &badCtx);
+    EFF_expect(tRet, LLKA_E_NO_FILE, "missing resource files were not reported");
+
+    bundle.confals = bundle.clusters;
+    tRet = LLKA_initializeClassificationContextFromBundle(&bundle, &limits, MAX_CLOSE_ENOUGH_RMSD, &badCtx);
+    EFF_expect(tRet, LLKA_E_MISMATCHING_DATA, "clusters were accepted as confals");
+
+    bundle.confals = nullptr;
+    tRet = LLKA_initializeClassificationContextFromBundle(&bundle, &limits, MAX_CLOSE_ENOUGH_RMSD, &badCtx);
+    EFF_expect(tRet, LLKA_E_INVALID_ARGUMENT, "incomplete bundle was accepted");
+}
+
+static
+auto testContextSnapshot(const LLKA_ClassificationContext *ctx)
+{
+    auto tRet = LLKA_saveClassificationContext(ctx, LLKA_PathLiteral("./classification_context.snapshot"));
+    EFF_expect(tRet, LLKA_OK, "unable to save classification context snapshot");
+
+    LLKA_ClassificationContext *mappedCtx = nullptr;
+    tRet = LLKA_mapClassificationContext(LLKA_PathLiteral("./classification_context.snapshot"), &mappedCtx);
+    EFF_expect(tRet, LLKA_OK, "unable to map classification context snapshot");
+
+    // Context from the snapshot must classify exactly the same as the original one
+    const std::array<std::tuple<const LLKA_Atom *, size_t>, 4> structures{{
+        { REAL_1BNA_A_1_2_ATOMS, REAL_1BNA_A_1_2_ATOMS_LEN },
+        { REAL_3VOK_U_1_2_ATOMS, REAL_3VOK_U_1_2_ATOMS_LEN },
+        { REAL_1DK1_B_5_6_ATOMS, REAL_1DK1_B_5_6_ATOMS_LEN },
+        { REAL_1DK1_B_27_28_ATOMS, REAL_1DK1_B_27_28_ATOMS_LEN }
+    }};
+    for (const auto &[atoms, nAtoms] : structures) {
+        LLKA_Structure stru = LLKA_makeStructure(atoms, nAtoms);
+
+        LLKA_ClassifiedStep original{};
+        LLKA_ClassifiedStep mapped{};
+        auto tRetOriginal = LLKA_classifyStep(&stru, ctx, &original);
+        auto tRetMapped = LLKA_classifyStep(&stru, mappedCtx, &mapped);
+        EFF_expect(tRetMapped, tRetOriginal, "mismatching classification return codes");
+
+        if (tRetOriginal == LLKA_OK) {
+            EFF_expect(mapped.violations, original.violations, "mismatching violations");
+            EFF_expect(mapped.assignedNtC, original.assignedNtC, "mismatching assigned NtC");
+            EFF_expect(mapped.closestNtC, original.closestNtC, "mismatching closest NtC");
+            EFF_expect(std::string{mapped.closestGoldenStep}, std::string{original.closestGoldenStep}, "mismatching closest golden step");
+            EFF_expect(mapped.confalScore.total, original.confalScore.total, "mismatching confal score");
+            EFF_expect(mapped.rmsdToClosestNtC, original.rmsdToClosestNtC, "mismatching RMSD to closest NtC");
+        }
+
+        LLKA_destroyStructure(&stru);
+    }
+    EFF_expect(LLKA_confalPercentile(42.5, mappedCtx), LLKA_confalPercentile(42.5, ctx), "mismatching confal percentile");
+
+    LLKA_destroyClassificationContext(mappedCtx);
+
+    // Snapshot in memory must be validated
+    std::ifstream ifs{"./classification_context.snapshot", std::ios::binary};
+    std::vector<char> snapshot{std::istreambuf_iterator<char>{ifs}, std::istreambuf_iterator<char>{}};
+
+    LLKA_ClassificationContext *memoryCtx = nullptr;
+    tRet = LLKA_classificationContextFromSnapshot(snapshot.data(), snapshot.size(), &memoryCtx);
+    EFF_expect(tRet, LLKA_OK, "unable to create classification context from snapshot in memory");
+    LLKA_destroyClassificationContext(memoryCtx);
+
+    tRet = LLKA_classificationContextFromSnapshot(snapshot.data(), snapshot.size() - 1, &memoryCtx);
+    EFF_expect(tRet, LLKA_E_BAD_DATA, "truncated snapshot was not rejected");
+
+    snapshot[0] = 'X';
+    tRet = LLKA_classificationContextFromSnapshot(snapshot.data(), snapshot.size(), &memoryCtx);
+    EFF_expect(tRet, LLKA_E_BAD_DATA, "snapshot with bad magic was not rejected");
+
+    // Paths that are not regular files must be reported, not thrown
+    tRet = LLKA_mapClassificationContext(LLKA_PathLiteral("./no_such.snapshot"), &memoryCtx);
+    EFF_expect(tRet, LLKA_E_NO_FILE, "missing snapshot was not reported");
+    tRet = LLKA_mapClassificationContext(LLKA_PathLiteral("."), &memoryCtx);
+    EFF_expect(tRet, LLKA_E_NO_FILE, "directory was mapped as a snapshot");
+
+    ifs.close();
+    std::filesystem::remove("./classification_context.snapshot");
+}
+
+static
+auto testConfalScoreAccuracy(const LLKA_ClassificationContext *ctx)
+{
+    // Exponential used by the confal score must closely match std::exp()
+    std::array<double, 2> in;
+    std::array<double, 2> out;
+    for (double x = -708.0; x <= 0.0; x += 0.0137) {
+        in = { x, x * 0.001 };
+        LLKAInternal::expBatch(in.data(), in.size(), out.data());
+
+        for (size_t idx = 0; idx < in.size(); idx++) {
+            const auto expected = std::exp(in[idx]);
+            EFF_expect(std::abs(out[idx] - expected) <= 1.0e-14 * expected, true, "exponential approximation exceeds tolerance");
+        }
+    }
+    in = { -800.0, -1.0e6 };
+    LLKAInternal::expBatch(in.data(), in.size(), out.data());
+    EFF_expect(out[0], 0.0, "exponential of a very negative argument is not zero");
+    EFF_expect(out[1], 0.0, "exponential of a very negative argument is not zero");
+    in = { std::numeric_limits<double>::quiet_NaN(), -1.0 };
+    LLKAInternal::expBatch(in.data(), in.size(), out.data());
+    EFF_expect(std::isnan(out[0]), true, "exponential of NaN is not NaN");
+    EFF_cmpFlt(out[1], std::exp(-1.0), "exponential next to a NaN lane differs");
+
+    // Confal scores must match the straightforward calculation
+    const std::array<std::tuple<const LLKA_Atom *, size_t>, 2> structures{{
+        { REAL_1BNA_A_1_2_ATOMS, REAL_1BNA_A_1_2_ATOMS_LEN },
+        { REAL_3VOK_U_1_2_ATOMS, REAL_3VOK_U_1_2_ATOMS_LEN }
+    }};
+    for (const auto &[atoms, nAtoms] : structures) {
+        LLKA_Structure stru = LLKA_makeStructure(atoms, nAtoms);
+
+        LLKA_ClassifiedStep classifiedStep{};
+        auto tRet = LLKA_classifyStep(&stru, ctx, &classifiedStep);
+        EFF_expect(tRet, LLKA_OK, "unable to classify step");
+
+        LLKA_Confal confal;
+        tRet = LLKA_confalForNtC(classifiedStep.assignedNtC, ctx, &confal);
+        EFF_expect(tRet, LLKA_OK, "unable to get confal for NtC");
+
+        const auto &diffs = classifiedStep.differencesFromNtCAverages;
+        const auto &score = classifiedStep.confalScore;
+        auto gauss = [](double diff, double sigma) { return 100.0 * std::exp(-(diff * diff) / (2.0 * sigma * sigma)); };
+
+        const std::array<std::tuple<double, double, double>, 12> parts{{
+            { LLKAInternal::R2D(diffs.delta_1), confal.delta_1, score.delta_1 },
+            { LLKAInternal::R2D(diffs.epsilon_1), confal.epsilon_1, score.epsilon_1 },
+            { LLKAInternal::R2D(diffs.zeta_1), confal.zeta_1, score.zeta_1 },
+            { LLKAInternal::R2D(diffs.alpha_2), confal.alpha_2, score.alpha_2 },
+            { LLKAInternal::R2D(diffs.beta_2), confal.beta_2, score.beta_2 },
+            { LLKAInternal::R2D(diffs.gamma_2), confal.gamma_2, score.gamma_2 },
+            { LLKAInternal::R2D(diffs.delta_2), confal.delta_2, score.delta_2 },
+            { LLKAInternal::R2D(diffs.chi_1), confal.chi_1, score.chi_1 },
+            { LLKAInternal::R2D(diffs.chi_2), confal.chi_2, score.chi_2 },
+            { diffs.CC, confal.CC, score.CC },
+            { diffs.NN, confal.NN, score.NN },
+            { LLKAInternal::R2D(diffs.mu), confal.mu, score.mu }
+        }};
+
+        double invTotal = 0;
+        for (const auto &[diff, sigma, actual] : parts) {
+            const auto expected = gauss(diff, sigma);
+            EFF_cmpFlt(actual, expected, "wrong partial confal score");
+            invTotal += 1.0 / expected;
+        }
+        EFF_cmpFlt(score.total, (12.0 / invTotal) + 0.5, "wrong total confal score");
+
+        LLKA_destroyStructure(&stru);
+    }
+}
+
 static
 auto testGetCluster(const LLKA_ClassificationContext *ctx)
 {
@@ -150,6 +439,155 @@ auto testGetCluster(const LLKA_ClassificationContext *ctx)
     EFF_expect(tRet, LLKA_E_INVALID_ARGUMENT, "LLKA_classificationClusterForNtC() returned unexpected value");
 }
 
+static
+auto testTracing(const LLKA_ClassificationContext *ctx)
+{
+    auto infos = LLKA_tracepointInfo();
+    if (infos.nInfos == 0)
+        return; // Tracing is disabled in this build
+
+    LLKA_toggleAllTracepoints(LLKA_FALSE);
+    const auto tpid = infos.infos[0].TPID;
+    LLKA_toggleTracepoint(tpid, LLKA_TRUE);
+    EFF_expect(LLKA_tracepointState(tpid), LLKA_TRUE, "tracepoint was not enabled");
+    for (size_t idx = 1; idx < infos.nInfos; idx++)
+        EFF_expect(LLKA_tracepointState(infos.infos[idx].TPID), LLKA_FALSE, "tracepoint was not disabled");
+    LLKA_toggleTracepoint(tpid, LLKA_FALSE);
+    EFF_expect(LLKA_tracepointState(tpid), LLKA_FALSE, "tracepoint was not disabled");
+
+    LLKA_destroyTrace(LLKA_trace(LLKA_FALSE));
+    LLKA_toggleAllTracepoints(LLKA_TRUE);
+
+    std::array<LLKA_Structure, 2> strus{
+        LLKA_makeStructure(REAL_1BNA_A_1_2_ATOMS, REAL_1BNA_A_1_2_ATOMS_LEN),
+        LLKA_makeStructure(REAL_3VOK_U_1_2_ATOMS, REAL_3VOK_U_1_2_ATOMS_LEN)
+    };
+    LLKA_Structures structures{ .strus = strus.data(), .nStrus = strus.size() };
+    LLKA_ClassifiedSteps classifiedSteps{};
+    auto tRet = LLKA_classifyStepsMultiple(&structures, ctx, &classifiedSteps);
+    EFF_expect(tRet, LLKA_OK, "unable to classify steps");
+
+    LLKA_toggleAllTracepoints(LLKA_FALSE);
+
+    auto records = LLKA_traceRecords(LLKA_TRUE);
+    EFF_expect(records.nRecords > 0, true, "no trace records");
+    bool secondStepSeen = false;
+    for (size_t idx = 0; idx < records.nRecords; idx++) {
+        const auto &rec = records.records[idx];
+        EFF_expect(rec.nValues <= LLKA_TRACE_RECORD_MAX_VALUES, true, "too many values in trace record");
+        EFF_expect(rec.nIndices <= LLKA_TRACE_RECORD_MAX_INDICES, true, "too many indices in trace record");
+        EFF_expect(rec.contextId != 0, true, "trace record was not logged in a step context");
+        if (rec.stepIdx == 1)
+            secondStepSeen = true;
+        else
+            EFF_expect(secondStepSeen, false, "trace records of the first step are not grouped");
+    }
+    EFF_expect(secondStepSeen, true, "trace records of the second step are missing");
+    for (size_t idx = 0; idx < infos.nInfos; idx++)
+        EFF_expect(std::string{infos.infos[idx].recordLayout}.empty(), false, "tracepoint has no record layout");
+    LLKA_destroyTraceRecords(&records);
+
+    // Records of each step must follow the record that announces the step
+    const auto kept = LLKA_trace(LLKA_TRUE);
+    const auto trace = LLKA_trace(LLKA_FALSE);
+    EFF_expect(std::string{kept}, std::string{trace}, "trace was cleared");
+
+    const std::string t{trace};
+    const auto first = t.find("Attempting to classify step 0");
+    const auto second = t.find("Attempting to classify step 1");
+    EFF_expect(first, size_t(0), "trace does not begin with the first step");
+    EFF_expect(second != std::string::npos, true, "second step is missing in the trace");
+    EFF_expect(t.find("Measuring against golden step") < second, true, "records of the first step are not grouped");
+    EFF_expect(t.find("Measuring against golden step", second) != std::string::npos, true, "records of the second step are missing");
+
+    const auto cleared = LLKA_trace(LLKA_FALSE);
+    EFF_expect(std::string{cleared}, std::string{}, "trace was not cleared");
+
+    LLKA_destroyTrace(kept);
+    LLKA_destroyTrace(trace);
+    LLKA_destroyTrace(cleared);
+    LLKA_destroyClassifiedSteps(&classifiedSteps);
+    for (auto &stru : strus)
+        LLKA_destroyStructure(&stru);
+    LLKA_destroyTracepointInfo(&infos);
+}
+
+static
+auto testProfiling(const LLKA_ClassificationContext *ctx)
+{
+    if (!LLKA_profilingEnabled()) {
+        auto counters = LLKA_profileCounters();
+        EFF_expect(counters.nCounters, size_t(0), "profile counters available in a build without profiling");
+        return;
+    }
+
+    LLKA_resetProfileCounters();
+
+    std::array<LLKA_Structure, 2> strus{
+        LLKA_makeStructure(REAL_1BNA_A_1_2_ATOMS, REAL_1BNA_A_1_2_ATOMS_LEN),
+        LLKA_makeStructure(REAL_3VOK_U_1_2_ATOMS, REAL_3VOK_U_1_2_ATOMS_LEN)
+    };
+    LLKA_Structures structures{ .strus = strus.data(), .nStrus = strus.size() };
+    LLKA_ClassifiedSteps classifiedSteps{};
+    auto tRet = LLKA_classifyStepsMultiple(&structures, ctx, &classifiedSteps);
+    EFF_expect(tRet, LLKA_OK, "unable to classify steps");
+
+    auto counters = LLKA_profileCounters();
+    EFF_expect(counters.nCounters, size_t(LLKA_PROFILE_NUM_PHASES), "wrong number of profile counters");
+    const auto &classify = counters.counters[LLKA_PROFILE_CLASSIFY_STEP];
+    EFF_expect(classify.phase, LLKA_PROFILE_CLASSIFY_STEP, "profile counters are not ordered by phase");
+    EFF_expect(classify.calls, uint64_t(2), "wrong number of profiled step classifications");
+    EFF_expect(counters.counters[LLKA_PROFILE_GOLDEN_STEP_SCAN].nanoseconds <= classify.nanoseconds, true, "nested phase took longer than the enclosing phase");
+    LLKA_destroyProfileCounters(&counters);
+
+    LLKA_resetProfileCounters();
+    counters = LLKA_profileCounters();
+    EFF_expect(counters.counters[LLKA_PROFILE_CLASSIFY_STEP].calls, uint64_t(0), "profile counters were not reset");
+    LLKA_destroyProfileCounters(&counters);
+
+    LLKA_destroyClassifiedSteps(&classifiedSteps);
+    for (auto &stru : strus)
+        LLKA_destroyStructure(&stru);
+}
+
+static
+auto testClassifyMultipleMatchesSingle(const LLKA_ClassificationContext *ctx)
+{
+    // Enough steps to be split among multiple threads
+    std::array<LLKA_Structure, 2> templates{
+        LLKA_makeStructure(REAL_1BNA_A_1_2_ATOMS, REAL_1BNA_A_1_2_ATOMS_LEN),
+        LLKA_makeStructure(REAL_3VOK_U_1_2_ATOMS, REAL_3VOK_U_1_2_ATOMS_LEN)
+    };
+    std::vector<LLKA_Structure> strus{};
+    for (size_t idx = 0; idx < 100; idx++)
+        strus.push_back(templates[idx % templates.size()]);
+
+    LLKA_Structures structures{ .strus = strus.data(), .nStrus = strus.size() };
+    LLKA_ClassifiedSteps classifiedSteps{};
+    auto tRet = LLKA_classifyStepsMultiple(&structures, ctx, &classifiedSteps);
+    EFF_expect(tRet, LLKA_OK, "unable to classify steps");
+    EFF_expect(classifiedSteps.nAttemptedSteps, strus.size(), "wrong number of classified steps");
+
+    std::array<LLKA_ClassifiedStep, 2> expected{};
+    for (size_t idx = 0; idx < templates.size(); idx++) {
+        tRet = LLKA_classifyStep(&templates[idx], ctx, &expected[idx]);
+        EFF_expect(tRet, LLKA_OK, "unable to classify step");
+    }
+
+    for (size_t idx = 0; idx < classifiedSteps.nAttemptedSteps; idx++) {
+        const auto &attempt = classifiedSteps.attemptedSteps[idx];
+        const auto &exp = expected[idx % expected.size()];
+        EFF_expect(attempt.status, LLKA_OK, "unable to classify step");
+        EFF_expect(attempt.step.assignedNtC, exp.assignedNtC, "mismatching assigned NtC");
+        EFF_expect(attempt.step.confalScore.total, exp.confalScore.total, "mismatching confal score");
+        EFF_expect(attempt.step.rmsdToClosestNtC, exp.rmsdToClosestNtC, "mismatching RMSD");
+    }
+
+    LLKA_destroyClassifiedSteps(&classifiedSteps);
+    for (auto &stru : templates)
+        LLKA_destroyStructure(&stru);
+}
+
 static
 auto testSugarPuckerNaming()
 {
@@ -209,15 +647,7 @@ auto initializeClassificationContext()
     tRet = LLKA_loadResourceFile(LLKA_PathLiteral("./confal_percentiles.csv"), &confalPercentiles);
     EFF_expect(tRet, LLKA_OK, "could not load confal percentiles definitions");
 
-    LLKA_ClassificationLimits limits = {};
-    limits.averageNeighborsTorsionCutoff = LLKAInternal::D2R(28.0);
-    limits.nearestNeighborTorsionsCutoff = LLKAInternal::D2R(28.0);
-    limits.totalDistanceCutoff = LLKAInternal::D2R(60.0);
-    limits.pseudorotationCutoff = LLKAInternal::D2R(72.0);
-    limits.minimumClusterVotes = 0.001111;
-    limits.minimumNearestNeighbors = 7;
-    limits.numberOfUsedNearestNeighbors = 11;
-    const double MAX_CLOSE_ENOUGH_RMSD = 0.5;
+    const auto limits = classificationLimits();
 
     LLKA_ClassificationContext *ctx;
     tRet = LLKA_initializeClassificationContext(
@@ -244,6 +674,7 @@ auto initializeClassificationContext()
 auto main(int, char **) -> int
 {
     testSugarPuckerNaming();
+    testResourceLoading();
 
     auto ctx = initializeClassificationContext();
 
@@ -251,7 +682,13 @@ auto main(int, char **) -> int
     testClassifyThorough(ctx);
     testClassifyViolations(ctx);
     testClassifyNotClassifiable(ctx);
+    testClassifyMultipleMatchesSingle(ctx);
     testGetCluster(ctx);
+    testConfalScoreAccuracy(ctx);
+    testContextFromResources(ctx);
+    testContextSnapshot(ctx);
+    testTracing(ctx);
+    testProfiling(ctx);
 
     LLKA_destroyClassificationContext(ctx);
 }
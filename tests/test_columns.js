@@ -0,0 +1,47 @@
+// Usage: node test_columns.js LIBLLKA_JS CIF_FILE
+//
+// Checks that the columns exported through embind are typed arrays that view the WASM memory.
+
+'use strict';
+
+const fs = require('fs');
+const path = require('path');
+
+function expect(cond, msg) {
+    if (!cond) {
+        console.error(`Test failed: ${msg}`);
+        process.exit(1);
+    }
+}
+
+async function main() {
+    const factory = require(path.resolve(process.argv[2]));
+    const LLKA = await factory();
+
+    const text = fs.readFileSync(process.argv[3], 'utf8');
+    const res = LLKA.cifToStructureColumns(text, 0);
+    expect(res.isSuccess(), 'Cif was not imported');
+
+    const columns = res.success();
+    const x = columns.x();
+    expect(x instanceof Float64Array, 'x column is not a Float64Array');
+    expect(x.length === columns.nAtoms(), 'x column has wrong length');
+    expect(columns.nAtoms() === 566, 'wrong number of atoms');
+    expect(Math.abs(x[0] - 18.935) < 1.0e-9, 'wrong x coordinate of the first atom');
+
+    const seqIds = columns.labelSeqIds();
+    expect(seqIds instanceof Int32Array, 'labelSeqIds column is not an Int32Array');
+    expect(seqIds[165] === 9, 'unexpected label_seq_id');
+
+    // Repeated calls must return views of the same memory, not copies
+    const again = columns.x();
+    expect(again.buffer === x.buffer && again.byteOffset === x.byteOffset, 'x column is not a view');
+
+    columns.delete();
+    res.delete();
+}
+
+main().catch((e) => {
+    console.error(e);
+    process.exit(1);
+});
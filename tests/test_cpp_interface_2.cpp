@@ -7,6 +7,9 @@
 
 #include "../src/util/elementaries.h"
 
+#include <fstream>
+#include <iterator>
+
 #ifndef LLKA_FILESYSTEM_ACCESS_DISABLED
 
 static
@@ -171,6 +174,144 @@ auto resource_loaders_load()
     EFF_expect(resource.front().clusterNumber, 901, "wrong cluster number");
 }
 
+#ifndef LLKA_PLATFORM_EMSCRIPTEN
+
+static
+auto handles_testImportAndClassify(const LLKA::ClassificationContext &ctx)
+{
+    auto res = LLKA::cifToStructureHandle(std::filesystem::path{"./1BNA.cif"});
+    EFF_expect(res.isSuccess(), true, "unexpected return value " + LLKA::errorToString(res.failure().tRet) + ", " + res.failure().error)
+    auto imported = res.success();
+    EFF_expect(imported.id(), std::string_view{"1BNA"}, "wrong entry id");
+    EFF_expect(imported.atoms().size(), 566UL, "wrong number of atoms in structure");
+    EFF_expect(imported.atoms()[165].label_seq_id, 9, "unexpected label_seq_id");
+
+    // Moving a handle must not copy or destroy the data
+    const auto atomsData = imported.atoms().data();
+    LLKA::ImportedStructureHandle moved{std::move(imported)};
+    EFF_expect(imported.isValid(), false, "moved-from handle is still valid");
+    EFF_expect(moved.atoms().data(), atomsData, "moving the handle copied the atoms");
+    // Moved-from handles must not point to the data of the new owner
+    EFF_expect(imported.atoms().empty(), true, "moved-from handle still has atoms");
+    EFF_expect(imported.id().empty(), true, "moved-from handle still has an entry id");
+    EFF_expect(imported.structure().atoms == nullptr, true, "moved-from handle still points to the atoms");
+
+    auto resSteps = LLKA::splitStructureToDinucleotideSteps(moved.structure());
+    EFF_expect(resSteps.isSuccess(), true, "unexpected return value " + LLKA::errorToString(resSteps.failure()))
+    auto steps = resSteps.success();
+
+    // Handles must give the same results as the value types
+    auto resValueSteps = LLKA::splitStructureToDinucleotideSteps(LLKA::makeStructure(moved.atoms().data(), moved.atoms().size()));
+    const auto &valueSteps = resValueSteps.success();
+    EFF_expect(steps.size(), valueSteps.size(), "wrong number of steps");
+    EFF_expect(steps[0].nAtoms, valueSteps[0].size(), "wrong number of atoms in the first step");
+
+    auto resClassified = LLKA::classifySteps(steps, ctx);
+    EFF_expect(resClassified.isSuccess(), true, "unexpected return value " + LLKA::errorToString(resClassified.failure()))
+    auto classified = resClassified.success();
+    EFF_expect(classified.steps().size(), steps.size(), "wrong number of classified steps");
+
+    LLKA::ClassifiedStepsHandle movedClassified{};
+    movedClassified = std::move(classified);
+    EFF_expect(classified.steps().empty(), true, "moved-from handle still has classified steps");
+    EFF_expect(movedClassified.steps().size(), steps.size(), "move assignment lost the classified steps");
+    classified = std::move(movedClassified);
+    EFF_expect(movedClassified.isValid(), false, "moved-from handle is still valid");
+
+    auto resColumns = LLKA::classifyStepsColumns(steps, ctx, std::string{moved.id()});
+    EFF_expect(resColumns.isSuccess(), true, "unexpected return value " + LLKA::errorToString(resColumns.failure()))
+    const auto &columns = resColumns.success();
+    EFF_expect(columns.nSteps(), steps.size(), "wrong number of steps in columns");
+    EFF_expect(columns.stepNames[0], std::string{"1bna_A_DC_1_DG_2"}, "wrong step name");
+    EFF_expect(columns.assignedNtCs[0], int32_t(classified.steps()[0].step.assignedNtC), "mismatching assigned NtC");
+
+    auto resStep = LLKA::classifyStep(steps[0], ctx);
+    EFF_expect(resStep.isSuccess(), true, "unexpected return value " + LLKA::errorToString(resStep.failure()))
+    EFF_expect(resStep.success().assignedNtC, classified.steps()[0].step.assignedNtC, "mismatching assigned NtC");
+
+    auto resBackbone = LLKA::extractBackbone(steps[0]);
+    EFF_expect(resBackbone.isSuccess(), true, "unexpected return value " + LLKA::errorToString(resBackbone.failure()))
+    auto backbone = resBackbone.success();
+    EFF_expect(backbone.toStructure().size(), backbone.size(), "wrong number of atoms in the converted backbone");
+}
+
+#endif // LLKA_PLATFORM_EMSCRIPTEN
+
+static
+auto columns_testExport(const LLKA::ClassificationContext &ctx)
+{
+    std::ifstream ifs{"./1BNA.cif", std::ios::binary};
+    const std::string text{std::istreambuf_iterator<char>{ifs}, std::istreambuf_iterator<char>{}};
+
+    auto res = LLKA::cifToStructureColumns(text);
+    EFF_expect(res.isSuccess(), true, "unexpected return value " + LLKA::errorToString(res.failure().tRet) + ", " + res.failure().error)
+    const auto &columns = res.success();
+
+    // Columns must hold the same values as the value types
+    const auto stru = LLKA::cifToStructure(text).success().structure;
+    EFF_expect(columns.nAtoms(), stru.size(), "wrong number of atoms in columns");
+    EFF_expect(columns.z.size(), stru.size(), "wrong length of column");
+    EFF_expect(columns.x[165], stru[165].coords.x, "mismatching x coordinate");
+    EFF_expect(columns.z[165], stru[165].coords.z, "mismatching z coordinate");
+    EFF_expect(columns.labelSeqIds[165], 9, "unexpected label_seq_id");
+    EFF_expect(columns.ids[165], int32_t(stru[165].id), "mismatching atom id");
+
+    const LLKA::StructureColumns fromValue{stru};
+    EFF_expect(fromValue.y == columns.y, true, "columns built from value types differ");
+
+    auto resSteps = LLKA::splitStructureToDinucleotideSteps(stru);
+    const auto &steps = resSteps.success();
+
+    auto resClassified = LLKA::classifySteps(steps, ctx);
+    const auto &classified = resClassified.success();
+
+    auto resColumns = LLKA::classifyStepsColumns(steps, ctx);
+    EFF_expect(resColumns.isSuccess(), true, "unexpected return value " + LLKA::errorToString(resColumns.failure()))
+    const auto &stepColumns = resColumns.success();
+    EFF_expect(stepColumns.nSteps(), classified.size(), "wrong number of steps in columns");
+    EFF_expect(stepColumns.metrics.size(), LLKA::ClassifiedStepsColumns::NUM_METRICS * classified.size(), "wrong length of metrics");
+    EFF_expect(stepColumns.metric(LLKA::ClassifiedStepsColumns::NUM_METRICS).empty(), true, "metric out of range is not empty");
+
+    for (size_t idx = 0; idx < classified.size(); idx++) {
+        EFF_expect(stepColumns.statuses[idx], int32_t(classified[idx].status), "mismatching status");
+        if (classified[idx].status != LLKA_OK)
+            continue;
+
+        const auto &step = classified[idx].step;
+        EFF_expect(stepColumns.assignedNtCs[idx], int32_t(step.assignedNtC), "mismatching assigned NtC");
+        EFF_expect(stepColumns.closestCANAs[idx], int32_t(step.closestCANA), "mismatching closest CANA");
+        EFF_expect(stepColumns.confalScores[idx], step.confalScore.total, "mismatching confal score");
+        EFF_expect(stepColumns.metric(0)[idx], step.metrics.delta_1, "mismatching delta_1");
+        EFF_expect(stepColumns.metric(11)[idx], step.metrics.mu, "mismatching mu");
+    }
+
+    // Steps classified from value types have no entry id to name them after
+    EFF_expect(stepColumns.stepNames[0], std::string{"A_DC_1_DG_2"}, "wrong step name");
+
+    auto resCif = LLKA::classifyCifColumns(text, ctx);
+    EFF_expect(resCif.isSuccess(), true, "unexpected return value " + LLKA::errorToString(resCif.failure().tRet) + ", " + resCif.failure().error)
+    const auto &cifColumns = resCif.success();
+    EFF_expect(cifColumns.nSteps(), stepColumns.nSteps(), "wrong number of steps in columns");
+    EFF_expect(cifColumns.assignedNtCs == stepColumns.assignedNtCs, true, "mismatching assigned NtCs");
+    EFF_expect(cifColumns.labelSeqIdsFirst == stepColumns.labelSeqIdsFirst, true, "mismatching label_seq_ids");
+
+    // Step identity must allow to join the columns back to the residues
+    const size_t last = cifColumns.nSteps() - 1;
+    EFF_expect(cifColumns.stepNames[0], std::string{"1bna_A_DC_1_DG_2"}, "wrong step name");
+    EFF_expect(cifColumns.authAsymIds[0], std::string{"A"}, "wrong chain id");
+    EFF_expect(cifColumns.labelSeqIdsFirst[0], 1, "wrong label_seq_id of the first residue");
+    EFF_expect(cifColumns.labelSeqIdsSecond[0], 2, "wrong label_seq_id of the second residue");
+    EFF_expect(cifColumns.compIdsFirst[0], std::string{"DC"}, "wrong comp_id of the first residue");
+    EFF_expect(cifColumns.compIdsSecond[0], std::string{"DG"}, "wrong comp_id of the second residue");
+    EFF_expect(cifColumns.altIdsFirst[0].empty(), true, "unexpected alternate position id");
+    EFF_expect(cifColumns.insCodesFirst[0].empty(), true, "unexpected insertion code");
+    EFF_expect(cifColumns.authAsymIds[last], std::string{"B"}, "wrong chain id");
+    EFF_expect(cifColumns.stepNames[last], "1bna_B_" + cifColumns.compIdsFirst[last] + "_23_" + cifColumns.compIdsSecond[last] + "_24", "wrong step name");
+
+    auto resBad = LLKA::classifyCifColumns("not a cif", ctx);
+    EFF_expect(resBad.isSuccess(), false, "invalid CIF text was accepted");
+}
+
 #endif // LLKA_FILESYSTEM_ACCESS_DISABLED
 
 static
@@ -214,6 +355,11 @@ auto main() -> int
     classification_testClassifySimple(ctx);
     classification_testClassifyThorough(ctx);
     classification_testClassifyViolations(ctx);
+
+#ifndef LLKA_PLATFORM_EMSCRIPTEN
+    handles_testImportAndClassify(ctx);
+#endif // LLKA_PLATFORM_EMSCRIPTEN
+    columns_testExport(ctx);
 #endif // LLKA_FILESYSTEM_ACCESS_DISABLED
 
     splitting_testSplitAltIds();
@@ -107,6 +107,28 @@ auto testSegmentationMultipleModels()
     }
 }
 
+static
+auto testRemoveAtoms()
+{
+    auto stru = LLKA::makeStructure(REAL_1BNA_A_3_4_ATOMS, REAL_1BNA_A_3_4_ATOMS_LEN);
+    const auto nAtoms = stru.size();
+    const auto firstId = stru.front().id;
+    const auto lastId = stru.back().id;
+
+    auto removed = LLKA::removeAtomsByIds(stru, { firstId, lastId });
+    EFF_expect(removed, 2UL, "Wrong number of atoms removed by ids");
+    EFF_expect(stru.size(), nAtoms - 2, "Wrong number of atoms after removal by ids");
+    EFF_expect(stru.front().id, firstId + 1, "Wrong id of the first atom after removal by ids");
+
+    removed = LLKA::removeAtomsIf(stru, [](const LLKA::Atom &atom) { return atom.label_seq_id == 4; });
+    EFF_expect(stru.size() + removed, nAtoms - 2, "Wrong number of atoms after removal by predicate");
+    EFF_expect(
+        std::all_of(stru.cbegin(), stru.cend(), [](const LLKA::Atom &atom) { return atom.label_seq_id == 3; }),
+        true,
+        "Atoms matching the predicate were not removed"
+    );
+}
+
 static
 auto testSugarPucker()
 {
@@ -131,4 +153,6 @@ auto main() -> int
     testSegmentationMultipleModels();
 
     testSugarPucker();
+
+    testRemoveAtoms();
 }
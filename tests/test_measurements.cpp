@@ -6,6 +6,9 @@
 #include <llka_measurements.h>
 #include <llka_structure.h>
 
+#include <cmath>
+#include <vector>
+
 static
 auto testAngles(LLKA_Structure &stru)
 {
@@ -90,6 +93,45 @@ auto testDistances(LLKA_Structure &stru)
     EFF_cmpFlt(dist, 7.2086283022500197, "unexpected distance between O5'_1 -> O5'_2 atoms");
 }
 
+static
+auto testBatches(LLKA_Structure &stru)
+{
+    // Odd counts make sure that both the vectorized and the remainder paths are used
+    constexpr size_t N_DIHEDRALS = 7;
+    constexpr size_t N_ANGLES = 9;
+    constexpr size_t N_DISTANCES = 13;
+    assert(stru.nAtoms >= 4 * N_DIHEDRALS); assert(stru.nAtoms >= 3 * N_ANGLES); assert(stru.nAtoms >= 2 * N_DISTANCES);
+
+    std::vector<LLKA_Point> points{};
+    for (size_t idx = 0; idx < stru.nAtoms; idx++)
+        points.push_back(stru.atoms[idx].coords);
+
+    std::vector<double> out(stru.nAtoms);
+
+    LLKA_measureDihedralsBatch(points.data(), N_DIHEDRALS, out.data());
+    for (size_t idx = 0; idx < N_DIHEDRALS; idx++) {
+        const auto atoms = &stru.atoms[4 * idx];
+        EFF_cmpFlt(out[idx], LLKA_measureDihedral(&atoms[0], &atoms[1], &atoms[2], &atoms[3]), "batch dihedral does not match single dihedral");
+    }
+
+    LLKA_measureAnglesBatch(points.data(), N_ANGLES, out.data());
+    for (size_t idx = 0; idx < N_ANGLES; idx++) {
+        const auto atoms = &stru.atoms[3 * idx];
+        EFF_cmpFlt(out[idx], LLKA_measureAngle(&atoms[0], &atoms[1], &atoms[2]), "batch angle does not match single angle");
+    }
+
+    LLKA_measureDistancesBatch(points.data(), N_DISTANCES, out.data());
+    for (size_t idx = 0; idx < N_DISTANCES; idx++) {
+        const auto atoms = &stru.atoms[2 * idx];
+        EFF_cmpFlt(out[idx], LLKA_measureDistance(&atoms[0], &atoms[1]), "batch distance does not match single distance");
+    }
+
+    // Degenerate dihedral
+    const LLKA_Point colinear[4] = { { 0.0, 0.0, 0.0 }, { 1.0, 0.0, 0.0 }, { 2.0, 0.0, 0.0 }, { 2.0, 1.0, 0.0 } };
+    LLKA_measureDihedralsBatch(colinear, 1, out.data());
+    EFF_expect(std::isnan(out[0]), true, "degenerate dihedral is not NAN");
+}
+
 auto main(int , char **) -> int
 {
     LLKA_Structure stru = LLKA_makeStructure(REAL_1BNA_A_1_2_ATOMS, REAL_1BNA_A_1_2_ATOMS_LEN);
@@ -97,6 +139,7 @@ auto main(int , char **) -> int
     testDistances(stru);
     testAngles(stru);
     testDihedrals(stru);
+    testBatches(stru);
 
     LLKA_destroyStructure(&stru);
 }
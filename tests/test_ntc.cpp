@@ -5,6 +5,11 @@
 
 #include <llka_ntc.h>
 
+#include <array>
+#include <string>
+#include <utility>
+#include <vector>
+
 static
 auto testCANA()
 {
@@ -61,6 +66,222 @@ auto testDifferenceAgainstReference()
     LLKA_destroyStructure(&stru);
 }
 
+class ExpectedAtom {
+public:
+    size_t idx;
+    const char *name;
+    int32_t seqId;
+};
+
+static
+auto checkMappedAtom(const LLKA_Structure &stru, const LLKA_Atom *atom, const ExpectedAtom &expected, const std::string &what)
+{
+    EFF_expect(atom != nullptr, true, "missing atom in " + what)
+    EFF_expect(size_t(atom - stru.atoms), expected.idx, "wrong atom in " + what)
+    EFF_expect(std::string{atom->label_atom_id}, std::string{expected.name}, "wrong atom name in " + what)
+    EFF_expect(atom->label_seq_id, expected.seqId, "wrong residue in " + what)
+}
+
+/*
+ * Checks the atom map against atoms picked by hand. The indices refer to the atoms
+ * of REAL_1BNA_A_3_4_ATOMS. Residue 3 is DC, residue 4 is DG.
+ */
+static
+auto checkStepAtomMap(const LLKA_Structure &stru, const std::array<std::array<ExpectedAtom, 4>, 9> &torsions)
+{
+    static constexpr ExpectedAtom C1_1{ 10, "C1'", 3 };
+    static constexpr ExpectedAtom N1_1{ 11, "N1", 3 };
+    static constexpr ExpectedAtom C1_2{ 29, "C1'", 4 };
+    static constexpr ExpectedAtom N9_2{ 30, "N9", 4 };
+
+    LLKA_StepAtomMap map;
+    auto tRet = LLKA_stepAtomMap(&stru, &map);
+    EFF_expect(tRet, LLKA_OK, "LLKA_stepAtomMap() returned unexpected value")
+
+    for (size_t tor = 0; tor < torsions.size(); tor++) {
+        for (size_t idx = 0; idx < 4; idx++)
+            checkMappedAtom(stru, map.torsions[tor][idx], torsions[tor][idx], std::string{"torsion "} + LLKA_dinucleotideTorsionName(LLKA_DinucleotideTorsion(tor), false));
+    }
+
+    checkMappedAtom(stru, map.CC[0], C1_1, "CC distance");
+    checkMappedAtom(stru, map.CC[1], C1_2, "CC distance");
+    checkMappedAtom(stru, map.NN[0], N1_1, "NN distance");
+    checkMappedAtom(stru, map.NN[1], N9_2, "NN distance");
+    checkMappedAtom(stru, map.mu[0], N1_1, "mu torsion");
+    checkMappedAtom(stru, map.mu[1], C1_1, "mu torsion");
+    checkMappedAtom(stru, map.mu[2], C1_2, "mu torsion");
+    checkMappedAtom(stru, map.mu[3], N9_2, "mu torsion");
+
+    // Metrics calculated from the map must match those calculated from the structure
+    LLKA_StepMetrics metrics;
+    LLKA_StepMetrics metricsFromMap;
+
+    tRet = LLKA_calculateStepMetricsFromAtomMap(&map, &metricsFromMap);
+    EFF_expect(tRet, LLKA_OK, "LLKA_calculateStepMetricsFromAtomMap() returned unexpected value")
+
+    tRet = LLKA_calculateStepMetrics(&stru, &metrics);
+    EFF_expect(tRet, LLKA_OK, "LLKA_calculateStepMetrics() returned unexpected value")
+
+    EFF_cmpFlt(metricsFromMap.delta_1, metrics.delta_1, "delta_1 metric differs");
+    EFF_cmpFlt(metricsFromMap.zeta_1, metrics.zeta_1, "zeta_1 metric differs");
+    EFF_cmpFlt(metricsFromMap.chi_2, metrics.chi_2, "chi_2 metric differs");
+    EFF_cmpFlt(metricsFromMap.mu, metrics.mu, "mu metric differs");
+}
+
+static
+auto testStepAtomMap()
+{
+    // Atoms of REAL_1BNA_A_3_4_ATOMS
+    static constexpr ExpectedAtom C5_1{ 4, "C5'", 3 };
+    static constexpr ExpectedAtom C4_1{ 5, "C4'", 3 };
+    static constexpr ExpectedAtom O4_1{ 6, "O4'", 3 };
+    static constexpr ExpectedAtom C3_1{ 7, "C3'", 3 };
+    static constexpr ExpectedAtom O3_1{ 8, "O3'", 3 };
+    static constexpr ExpectedAtom C1_1{ 10, "C1'", 3 };
+    static constexpr ExpectedAtom N1_1{ 11, "N1", 3 };
+    static constexpr ExpectedAtom C2_1{ 12, "C2", 3 };
+    static constexpr ExpectedAtom P_2{ 19, "P", 4 };
+    static constexpr ExpectedAtom O5_2{ 22, "O5'", 4 };
+    static constexpr ExpectedAtom C5_2{ 23, "C5'", 4 };
+    static constexpr ExpectedAtom C4_2{ 24, "C4'", 4 };
+    static constexpr ExpectedAtom O4_2{ 25, "O4'", 4 };
+    static constexpr ExpectedAtom C3_2{ 26, "C3'", 4 };
+    static constexpr ExpectedAtom O3_2{ 27, "O3'", 4 };
+    static constexpr ExpectedAtom C1_2{ 29, "C1'", 4 };
+    static constexpr ExpectedAtom N9_2{ 30, "N9", 4 };
+    static constexpr ExpectedAtom C4B_2{ 40, "C4", 4 };
+
+    LLKA_Structure stru = LLKA_makeStructure(REAL_1BNA_A_3_4_ATOMS, REAL_1BNA_A_3_4_ATOMS_LEN);
+    checkStepAtomMap(stru, {{
+        { C5_1, C4_1, C3_1, O3_1 },     // delta_1
+        { C4_1, C3_1, O3_1, P_2 },      // epsilon_1
+        { C3_1, O3_1, P_2, O5_2 },      // zeta_1
+        { O3_1, P_2, O5_2, C5_2 },      // alpha_2
+        { P_2, O5_2, C5_2, C4_2 },      // beta_2
+        { O5_2, C5_2, C4_2, C3_2 },     // gamma_2
+        { C5_2, C4_2, C3_2, O3_2 },     // delta_2
+        { O4_1, C1_1, N1_1, C2_1 },     // chi_1
+        { O4_2, C1_2, N9_2, C4B_2 }     // chi_2
+    }});
+    LLKA_destroyStructure(&stru);
+
+    // Residue 4 turned into 5FA, which has a non-standard backbone. The backbone torsions
+    // then follow the quads built by nonStandardBackboneQuads().
+    std::vector<LLKA_Atom> atoms{REAL_1BNA_A_3_4_ATOMS, REAL_1BNA_A_3_4_ATOMS + REAL_1BNA_A_3_4_ATOMS_LEN};
+    for (auto &atom : atoms) {
+        if (atom.label_seq_id != 4)
+            continue;
+        atom.label_comp_id = "5FA";
+        if (std::string{atom.label_atom_id} == "OP1")
+            atom.label_atom_id = "PA";
+    }
+
+    stru = LLKA_makeStructure(atoms.data(), atoms.size());
+    checkStepAtomMap(stru, {{
+        { C5_1, C4_1, O4_1, C3_1 },     // delta_1
+        { C4_1, O4_1, C3_1, O3_2 },     // epsilon_1
+        { O4_1, C3_1, O3_2, P_2 },      // zeta_1
+        { C3_1, O3_2, P_2, O5_2 },      // alpha_2
+        { O3_2, P_2, O5_2, C5_2 },      // beta_2
+        { P_2, O5_2, C5_2, C4_2 },      // gamma_2
+        { O5_2, C5_2, C4_2, O4_2 },     // delta_2
+        { O4_1, C1_1, N1_1, C2_1 },     // chi_1
+        { O4_2, C1_2, N9_2, C4B_2 }     // chi_2
+    }});
+    LLKA_destroyStructure(&stru);
+}
+
+/*
+ * Whole-structure metrics must match metrics calculated for each step separately
+ */
+static
+auto checkStructureStepMetrics(const LLKA_Structure &stru, size_t nSteps)
+{
+    LLKA_StructureStepMetrics all;
+
+    auto tRet = LLKA_calculateStructureStepMetrics(&stru, &all);
+    EFF_expect(tRet, LLKA_OK, "LLKA_calculateStructureStepMetrics() returned unexpected value")
+    EFF_expect(all.steps.nStrus, nSteps, "wrong number of steps")
+    EFF_expect(all.nAttemptedMetrics, nSteps, "wrong number of attempted metrics")
+
+    for (size_t idx = 0; idx < all.nAttemptedMetrics; idx++) {
+        const auto &step = all.steps.strus[idx];
+        const auto &attempted = all.attemptedMetrics[idx];
+        EFF_expect(attempted.status, LLKA_OK, "unexpected status of attempted metrics")
+
+        LLKA_StepMetrics metrics;
+        tRet = LLKA_calculateStepMetrics(&step, &metrics);
+        EFF_expect(tRet, LLKA_OK, "LLKA_calculateStepMetrics() returned unexpected value")
+
+        EFF_cmpFlt(attempted.metrics.delta_1, metrics.delta_1, "delta_1 metric differs");
+        EFF_cmpFlt(attempted.metrics.epsilon_1, metrics.epsilon_1, "epsilon_1 metric differs");
+        EFF_cmpFlt(attempted.metrics.zeta_1, metrics.zeta_1, "zeta_1 metric differs");
+        EFF_cmpFlt(attempted.metrics.alpha_2, metrics.alpha_2, "alpha_2 metric differs");
+        EFF_cmpFlt(attempted.metrics.beta_2, metrics.beta_2, "beta_2 metric differs");
+        EFF_cmpFlt(attempted.metrics.gamma_2, metrics.gamma_2, "gamma_2 metric differs");
+        EFF_cmpFlt(attempted.metrics.delta_2, metrics.delta_2, "delta_2 metric differs");
+        EFF_cmpFlt(attempted.metrics.chi_1, metrics.chi_1, "chi_1 metric differs");
+        EFF_cmpFlt(attempted.metrics.chi_2, metrics.chi_2, "chi_2 metric differs");
+        EFF_cmpFlt(attempted.metrics.CC, metrics.CC, "CC metric differs");
+        EFF_cmpFlt(attempted.metrics.NN, metrics.NN, "NN metric differs");
+        EFF_cmpFlt(attempted.metrics.mu, metrics.mu, "mu metric differs");
+
+        const auto &first = step.atoms[0];
+        const auto &last = step.atoms[step.nAtoms - 1];
+        const std::pair<const LLKA_Atom *, const LLKA_RiboseMetrics *> nucleotides[] = { { &first, &attempted.ribose_1 }, { &last, &attempted.ribose_2 } };
+        for (const auto &[atom, ribose] : nucleotides) {
+            LLKA_Structure nucl = LLKA_extractNucleotide(&step, atom->pdbx_PDB_model_num, atom->label_asym_id, atom->label_seq_id);
+            LLKA_RiboseMetrics riboseMetrics;
+
+            tRet = LLKA_riboseMetrics(&nucl, &riboseMetrics);
+            EFF_expect(tRet, LLKA_OK, "LLKA_riboseMetrics() returned unexpected value")
+
+            EFF_cmpFlt(ribose->nus.nu_0, riboseMetrics.nus.nu_0, "nu_0 angle differs");
+            EFF_cmpFlt(ribose->nus.nu_3, riboseMetrics.nus.nu_3, "nu_3 angle differs");
+            EFF_cmpFlt(ribose->P, riboseMetrics.P, "pseudorotation differs");
+            EFF_cmpFlt(ribose->tMax, riboseMetrics.tMax, "tMax differs");
+            EFF_expect(ribose->pucker, riboseMetrics.pucker, "sugar pucker differs")
+
+            LLKA_destroyStructure(&nucl);
+        }
+    }
+
+    LLKA_destroyStructureStepMetrics(&all);
+}
+
+static
+auto testStructureStepMetrics()
+{
+    LLKA_Structure stru = LLKA_makeStructure(REAL_1DK1_B_26_28_ATOMS, REAL_1DK1_B_26_28_ATOMS_LEN);
+    checkStructureStepMetrics(stru, 3);
+    LLKA_destroyStructure(&stru);
+
+    // Residues 3 to 6 of 1BNA chain A with residue 4 turned into 5FA. 5FA has a non-standard backbone,
+    // the delta torsions of the steps next to it are measured on different atoms than in the other steps.
+    std::vector<LLKA_Atom> atoms{};
+    for (size_t idx = 0; idx < REAL_1BNA_A_3_4_ATOMS_LEN; idx++)
+        atoms.push_back(REAL_1BNA_A_3_4_ATOMS[idx]);
+    for (size_t idx = 0; idx < REAL_1BNA_A_4_5_ATOMS_LEN; idx++) {
+        if (REAL_1BNA_A_4_5_ATOMS[idx].label_seq_id == 5)
+            atoms.push_back(REAL_1BNA_A_4_5_ATOMS[idx]);
+    }
+    for (size_t idx = 0; idx < REAL_1BNA_A_6_7_ATOMS_LEN; idx++) {
+        if (REAL_1BNA_A_6_7_ATOMS[idx].label_seq_id == 6)
+            atoms.push_back(REAL_1BNA_A_6_7_ATOMS[idx]);
+    }
+    for (auto &atom : atoms) {
+        if (atom.label_seq_id != 4)
+            continue;
+        atom.label_comp_id = "5FA";
+        if (std::string{atom.label_atom_id} == "OP1")
+            atom.label_atom_id = "PA";
+    }
+
+    stru = LLKA_makeStructure(atoms.data(), atoms.size());
+    checkStructureStepMetrics(stru, 3);
+    LLKA_destroyStructure(&stru);
+}
+
 #define CHECK_QUAD(_a, _b, _c, _d, tor, quad) \
     EFF_expect(quad.a, std::string{_a}, std::string{"Atom a on torsion "} + LLKA_dinucleotideTorsionName(tor, false) + " is wrong") \
     EFF_expect(quad.b, std::string{_b}, std::string{"Atom b on torsion "} + LLKA_dinucleotideTorsionName(tor, false) + " is wrong") \
@@ -191,6 +412,8 @@ auto main(int, char **) -> int
     testNtC();
 
     testDifferenceAgainstReference();
+    testStepAtomMap();
+    testStructureStepMetrics();
 
     testTorsionNamesStructure();
     testTorsionNamesBases();
@@ -42,6 +42,27 @@ auto testExtractNucleotide(const LLKA_Structure *stru)
     LLKA_destroyStructure(&firstNucl);
 }
 
+static
+auto testKnownResidues()
+{
+    LLKA_BaseKind kind;
+
+    EFF_expect(LLKA_isNucleotideCompound("DA"), LLKA_TRUE, "DA is not recognized as a nucleotide");
+    EFF_expect(LLKA_isNucleotideCompound("ZDU"), LLKA_TRUE, "ZDU is not recognized as a nucleotide");
+    EFF_expect(LLKA_isNucleotideCompound("XTY"), LLKA_TRUE, "XTY is not recognized as a nucleotide");
+    EFF_expect(LLKA_isNucleotideCompound("HOH"), LLKA_FALSE, "HOH is recognized as a nucleotide");
+    EFF_expect(LLKA_isNucleotideCompound(""), LLKA_FALSE, "Empty name is recognized as a nucleotide");
+    EFF_expect(LLKA_isNucleotideCompound("DA_VERY_LONG"), LLKA_FALSE, "Overlong name is recognized as a nucleotide");
+
+    EFF_expect(LLKA_baseKind("DG", &kind), LLKA_OK, "Unexpected return code from LLKA_baseKind()");
+    EFF_expect(kind, LLKA_PURINE, "Wrong base kind");
+    EFF_expect(LLKA_baseKind("DC", &kind), LLKA_OK, "Unexpected return code from LLKA_baseKind()");
+    EFF_expect(kind, LLKA_PYRIMIDINE, "Wrong base kind");
+    EFF_expect(LLKA_baseKind("05A", &kind), LLKA_OK, "Unexpected return code from LLKA_baseKind()");
+    EFF_expect(kind, LLKA_NON_STANDARD_BASE, "Wrong base kind");
+    EFF_expect(LLKA_baseKind("GLY", &kind), LLKA_E_INVALID_ARGUMENT, "Unexpected return code from LLKA_baseKind()");
+}
+
 static
 auto testSugarPucker(const LLKA_Structure *stru)
 {
@@ -64,6 +85,42 @@ auto testSugarPucker(const LLKA_Structure *stru)
     LLKA_destroyStructureView(&nuclView);
 }
 
+static
+auto testRiboseMetricsMultiple(const LLKA_Structure *stru, size_t expectedCount)
+{
+    LLKA_RiboseMetricsMultiple multiple;
+    auto tRet = LLKA_riboseMetricsMultiple(stru, &multiple);
+    EFF_expect(tRet, LLKA_OK, "Unexpected return code from LLKA_riboseMetricsMultiple()");
+    EFF_expect(multiple.nAttemptedMetrics, expectedCount, "Wrong number of attempted ribose metrics");
+
+    for (size_t idx = 0; idx < multiple.nAttemptedMetrics; idx++) {
+        const auto &attempted = multiple.attemptedMetrics[idx];
+        EFF_expect(attempted.status, LLKA_OK, "Unexpected status of attempted ribose metrics");
+
+        const auto &atom = stru->atoms[attempted.firstAtomIdx];
+        auto nucl = LLKA_extractNucleotide(stru, atom.pdbx_PDB_model_num, atom.label_asym_id, atom.label_seq_id);
+        EFF_expect(nucl.nAtoms, attempted.nAtoms, "Wrong number of atoms of a residue");
+
+        LLKA_RiboseMetrics expected;
+        tRet = LLKA_riboseMetrics(&nucl, &expected);
+        EFF_expect(tRet, LLKA_OK, "Unexpected return code from LLKA_riboseMetrics()");
+
+        const auto &metrics = attempted.metrics;
+        EFF_cmpFlt(metrics.nus.nu_0, expected.nus.nu_0, "Wrong nus.nu_0");
+        EFF_cmpFlt(metrics.nus.nu_1, expected.nus.nu_1, "Wrong nus.nu_1");
+        EFF_cmpFlt(metrics.nus.nu_2, expected.nus.nu_2, "Wrong nus.nu_2");
+        EFF_cmpFlt(metrics.nus.nu_3, expected.nus.nu_3, "Wrong nus.nu_3");
+        EFF_cmpFlt(metrics.nus.nu_4, expected.nus.nu_4, "Wrong nus.nu_4");
+        EFF_cmpFlt(metrics.P, expected.P, "Wrong P");
+        EFF_cmpFlt(metrics.tMax, expected.tMax, "Wrong tMax");
+        EFF_expect(metrics.pucker, expected.pucker, "Wrong sugar pucker");
+
+        LLKA_destroyStructure(&nucl);
+    }
+
+    LLKA_destroyRiboseMetricsMultiple(&multiple);
+}
+
 auto main(int, char *[]) -> int
 {
     auto stru = LLKA_makeStructure(REAL_1BNA_A_3_4_ATOMS, REAL_1BNA_A_3_4_ATOMS_LEN);
@@ -71,7 +128,13 @@ auto main(int, char *[]) -> int
     testExtractNucleotide(&stru);
     testExtractRibose(&stru);
     testSugarPucker(&stru);
+    testRiboseMetricsMultiple(&stru, 2);
+    testKnownResidues();
+
+    LLKA_destroyStructure(&stru);
 
+    stru = LLKA_makeStructure(REAL_1DK1_B_26_28_ATOMS, REAL_1DK1_B_26_28_ATOMS_LEN);
+    testRiboseMetricsMultiple(&stru, 3);
     LLKA_destroyStructure(&stru);
 
     return 0;
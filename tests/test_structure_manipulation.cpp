@@ -75,6 +75,64 @@ auto testAppendStructure()
     LLKA_destroyStructure(&firstStru);
 }
 
+static
+auto testStructureBuilder()
+{
+    const LLKA_Atom atoms[] = {
+        { "C", "C5'", "1", "DC", "A", "C5'", "DC", "A", { 1.059, -3.973, 1.922 }, 1, 1, 1, 1, LLKA_NO_INSCODE, LLKA_NO_ALTID },
+        { "C", "C5'", "1", "DC", "A", "C5'", "DC", "A", { 1.059, -3.973, 1.922 }, 2, 1, 1, 1, LLKA_NO_INSCODE, LLKA_NO_ALTID },
+        { "C", "C5'", "1", "DC", "A", "C5'", "DC", "A", { 1.059, -3.973, 1.922 }, 3, 1, 1, 1, LLKA_NO_INSCODE, LLKA_NO_ALTID }
+    };
+    LLKA_Structure appended = LLKA_makeStructure(atoms, 3);
+
+    LLKA_StructureBuilder builder;
+    LLKA_initStructureBuilder(0, &builder);
+
+    const uint32_t N = 1000;
+    for (uint32_t idx = 0; idx < N; idx++) {
+        LLKA_Point c{ double(idx), 0.0, 0.0 };
+        LLKA_appendAtomFromParamsToBuilder(
+            idx + 1,
+            "C", "C4'", "1", "DA", "A",
+            nullptr, nullptr, nullptr,
+            1, LLKA_NO_ALTID, 1,
+            LLKA_NO_INSCODE,
+            1,
+            &c,
+            &builder
+        );
+    }
+    EFF_expect(builder.nAtoms, size_t(N), "structure builder, count after appending by params");
+    EFF_expect(builder.capacity >= builder.nAtoms, true, "structure builder, capacity");
+
+    LLKA_appendAtomToBuilder(&atoms[0], &builder);
+    LLKA_appendStructureToBuilder(&appended, &builder);
+
+    LLKA_Structure stru = LLKA_finishStructureBuilder(&builder);
+    EFF_expect(stru.nAtoms, size_t(N + 4), "structure builder, count");
+    EFF_expect(builder.nAtoms, 0UL, "structure builder, reset after finish");
+    EFF_expect(stru.atoms[N - 1].id, N, "structure builder, id of last atom appended by params");
+    EFF_expect(stru.atoms[N - 1].coords.x, double(N - 1), "structure builder, X coordinate");
+    EFF_expect(std::string{stru.atoms[N - 1].auth_comp_id}, std::string{"DA"}, "structure builder, auth_comp_id");
+    EFF_expect(LLKA_compareAtoms(&stru.atoms[N], &atoms[0], LLKA_FALSE), LLKA_TRUE, "structure builder, compare appended atom");
+    EFF_expect(LLKA_compareAtoms(&stru.atoms[N + 3], &atoms[2], LLKA_FALSE), LLKA_TRUE, "structure builder, compare appended structure");
+
+    LLKA_destroyStructure(&stru);
+
+    LLKA_initStructureBuilder(2, &builder);
+    LLKA_reserveStructureBuilder(10, &builder);
+    EFF_expect(builder.capacity, 10UL, "structure builder, reserved capacity");
+    LLKA_appendStructureToBuilder(&appended, &builder);
+    LLKA_destroyStructureBuilder(&builder);
+
+    LLKA_initStructureBuilder(5, &builder);
+    stru = LLKA_finishStructureBuilder(&builder);
+    EFF_expect(stru.nAtoms, 0UL, "structure builder, empty structure");
+    EFF_expect(stru.atoms, nullptr, "structure builder, empty structure atoms");
+
+    LLKA_destroyStructure(&appended);
+}
+
 static
 auto testComparison()
 {
@@ -188,13 +246,80 @@ auto testRemoval()
     }
 }
 
+static
+auto isCarbon(const LLKA_Atom *atom, void *userData) -> LLKA_Bool
+{
+    auto nCalls = static_cast<size_t *>(userData);
+    (*nCalls)++;
+
+    return std::strcmp(atom->type_symbol, "C") == 0 ? LLKA_TRUE : LLKA_FALSE;
+}
+
+static
+auto testBatchRemoval()
+{
+    const LLKA_Atom atoms[] = {
+        { "C", "C5'", "1", "DC", "A", "C5'", "DC", "A", { 1.059, -3.973, 1.922 }, 1, 1, 1, 1, LLKA_NO_INSCODE, LLKA_NO_ALTID },
+        { "N", "N1", "1", "DC", "A", "N1", "DC", "A", { 1.059, -3.973, 1.922 }, 2, 1, 1, 1, LLKA_NO_INSCODE, LLKA_NO_ALTID },
+        { "C", "C5'", "1", "DC", "A", "C5'", "DC", "A", { 1.059, -3.973, 1.922 }, 3, 1, 1, 1, LLKA_NO_INSCODE, LLKA_NO_ALTID },
+        { "N", "N3", "1", "DC", "A", "N3", "DC", "A", { 1.059, -3.973, 1.922 }, 4, 1, 1, 1, LLKA_NO_INSCODE, LLKA_NO_ALTID },
+        { "C", "C5'", "1", "DC", "A", "C5'", "DC", "A", { 1.059, -3.973, 1.922 }, 5, 1, 1, 1, LLKA_NO_INSCODE, LLKA_NO_ALTID }
+    };
+
+    // Remove by ids
+    {
+        LLKA_Structure stru = LLKA_makeStructure(atoms, 5);
+        const uint32_t ids[] = { 5, 1, 3, 42 };
+
+        auto removed = LLKA_removeAtomsByIds(ids, 4, &stru);
+
+        EFF_expect(removed, 3UL, "remove atoms by ids, removed count");
+        EFF_expect(stru.nAtoms, 2UL, "remove atoms by ids, count");
+        EFF_expect(stru.atoms[0].id, 2U, "remove atoms by ids, first atom");
+        EFF_expect(stru.atoms[1].id, 4U, "remove atoms by ids, second atom");
+
+        LLKA_destroyStructure(&stru);
+    }
+
+    // Remove by predicate
+    {
+        LLKA_Structure stru = LLKA_makeStructure(atoms, 5);
+        size_t nCalls = 0;
+
+        auto removed = LLKA_removeAtomsIf(isCarbon, &nCalls, &stru);
+
+        EFF_expect(nCalls, 5UL, "remove atoms by predicate, predicate calls");
+        EFF_expect(removed, 3UL, "remove atoms by predicate, removed count");
+        EFF_expect(stru.nAtoms, 2UL, "remove atoms by predicate, count");
+        EFF_expect(stru.atoms[0].label_atom_id, "N1", "remove atoms by predicate, first atom");
+        EFF_expect(stru.atoms[1].label_atom_id, "N3", "remove atoms by predicate, second atom");
+
+        LLKA_destroyStructure(&stru);
+    }
+
+    // Remove everything
+    {
+        LLKA_Structure stru = LLKA_makeStructure(atoms, 5);
+        const uint32_t ids[] = { 1, 2, 3, 4, 5 };
+
+        auto removed = LLKA_removeAtomsByIds(ids, 5, &stru);
+
+        EFF_expect(removed, 5UL, "remove all atoms, removed count");
+        EFF_expect(stru.nAtoms, 0UL, "remove all atoms, count");
+
+        LLKA_destroyStructure(&stru);
+    }
+}
+
 auto main(int, char **) -> int
 {
     testComparison();
     testDuplication();
     testAppendAtom();
     testAppendStructure();
+    testStructureBuilder();
     testRemoval();
+    testBatchRemoval();
     testFindAtoms();
 
     return EXIT_SUCCESS;
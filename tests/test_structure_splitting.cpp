@@ -32,6 +32,33 @@ auto testSplitAltIds()
     LLKA_destroyStructure(&stru);
 }
 
+static
+auto testSplitAltIdsView()
+{
+    LLKA_Structure stru = LLKA_makeStructure(REAL_1DK1_B_26_28_ATOMS, REAL_1DK1_B_26_28_ATOMS_LEN);
+
+    LLKA_AlternatePositions alts;
+    LLKA_StructureViews views = LLKA_splitByAltIdsView(&stru, &alts);
+
+    EFF_expect(views.nViews, 2UL, "wrong number of alt-id-splitted views")
+    EFF_expect(alts.nPositions, 2UL, "wrong number of alterate position identifiers")
+
+    EFF_expect(views.views[0].nAtoms, 68UL, "wrong number of atoms in splitted view")
+    EFF_expect(views.views[1].nAtoms, 68UL, "wrong number of atoms in splitted view")
+
+    EFF_expect(alts.positions[0], 'A', "wrong alternate position id")
+    EFF_expect(alts.positions[1], 'B', "wrong alternate position id")
+
+    EFF_expect(views.views[0].atoms[0], &stru.atoms[0], "view does not point to the source structure")
+    EFF_expect(views.views[0].atoms[67]->label_alt_id, 'A', "wrong alternate position id")
+    EFF_expect(views.views[1].atoms[0], &stru.atoms[0], "view does not point to the source structure")
+    EFF_expect(views.views[1].atoms[67]->label_alt_id, 'B', "wrong alternate position id")
+
+    LLKA_destroyStructureViews(&views);
+    LLKA_destroyAlternatePositions(&alts);
+    LLKA_destroyStructure(&stru);
+}
+
 static
 auto testSplitDinucleotides()
 {
@@ -57,6 +84,7 @@ auto testSplitDinucleotides()
 auto main(int, char **) -> int
 {
     testSplitAltIds();
+    testSplitAltIdsView();
     testSplitDinucleotides();
 
     return EXIT_SUCCESS;